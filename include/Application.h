@@ -4,6 +4,9 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <array>
+#include <chrono>
+#include <future>
 #include <imgui.h>  // For ImVec4, ImVec2 types
 
 struct GLFWwindow;
@@ -16,6 +19,9 @@ class PathfindingVisualizer;
 class GraphVisualizer;
 class SearchVisualizer;
 class TreeVisualizer;
+class TaskPool;
+class RetroEffects;
+class Renderer;
 
 class Application {
 public:
@@ -48,6 +54,13 @@ public:
     void EndRetroWindow();
 
 private:
+    // Frame pacing: how eagerly the loop produces the next frame
+    enum class FramePacing {
+        Full,       // A visualizer is playing or the user is interacting: every frame, up to the cap
+        Decorative, // Only retro effects move: at m_decorativeFrameRate
+        Idle        // Nothing moves: sleep until input, waking every IDLE_WAIT_SECONDS
+    };
+    
     void Update();
     void Render();
     void RenderUI();
@@ -90,8 +103,10 @@ private:
     
     // Core components
     std::shared_ptr<AudioManager> m_audioManager;
+    std::unique_ptr<RetroEffects> m_retroEffects;
+    std::unique_ptr<Renderer> m_renderer;
     
-    // Visualizers
+    // Visualizers; built on first use, except Sorting which is built during startup
     std::unique_ptr<SortingVisualizer> m_sortingVisualizer;
     std::unique_ptr<PathfindingVisualizer> m_pathfindingVisualizer;
     std::unique_ptr<GraphVisualizer> m_graphVisualizer;
@@ -103,6 +118,25 @@ private:
     bool InitializeImGui();
     void SetupImGuiStyle();
     void ApplyTheme(Theme theme);
+    
+    // Startup: the window and ImGui come up on the main thread, the rest runs on
+    // m_taskPool behind the splash screen
+    void StartStartupTasks();
+    // Collects finished tasks; true once all of them are done
+    bool PollStartupTasks();
+    void FinishStartupTasks(); // Blocks until every task is done
+    // Builds the visualizer for mode if it does not exist yet; also called from a startup task
+    void EnsureVisualizer(VisualizationMode mode);
+    
+    // Frame loop helpers
+    [[nodiscard]] FramePacing ChooseFramePacing() const;
+    [[nodiscard]] bool IsVisualizerAnimating() const;
+    void WaitForNextFrame(); // Sleeps or waits for events as the pacing allows, then polls
+    void SetVSync(bool enabled);
+    void RenderFramePacingControls();
+    // Time for decorative animations; frozen at 0 unless the retro effects quality is High
+    [[nodiscard]] float EffectTime() const;
+    void RenderProfiler();
 
     void RenderAlgorithmInfo();
     void RenderLicenses();
@@ -121,9 +155,40 @@ private:
     Theme m_currentTheme = Theme::Dark;
 
     
+    // Startup
+    std::unique_ptr<TaskPool> m_taskPool;
+    std::vector<std::future<void>> m_startupTasks;
+    size_t m_startupTaskCount = 0;
+    size_t m_startupTasksDone = 0;
+    bool m_startupComplete = false;
+    std::chrono::steady_clock::time_point m_startupBegin{};
+    double m_startupWindowMs = 0.0; // GLFW and ImGui, on the main thread
+    double m_startupReadyMs = 0.0;  // First frame that takes input
+    
+    // Frame pacing and timing
+    static constexpr double IDLE_WAIT_SECONDS = 0.5;
+    static constexpr int WAKE_FRAMES = 3;           // Full-rate frames after input, so ImGui settles
+    static constexpr size_t FRAME_HISTORY = 240;
+    FramePacing m_framePacing = FramePacing::Full;
+    bool m_vsync = true;
+    bool m_animateIdleEffects = true; // Off: idle windows only redraw on input
+    int m_frameRateCap = 0;           // Full-rate limit in frames per second; 0 for none
+    int m_decorativeFrameRate = 30;
+    int m_wakeFrames = 0;
+    std::chrono::steady_clock::time_point m_frameStart{};
+    std::array<float, FRAME_HISTORY> m_frameIntervals{}; // ms from one frame start to the next
+    std::array<float, FRAME_HISTORY> m_frameWorkTimes{}; // ms spent in Update, Render and swap
+    size_t m_frameHistoryCount = 0;
+    size_t m_frameHistoryNext = 0;
+    
+    // Profiler view
+    size_t m_profilerFrameAge = 0;   // Selected frame, counted back from the newest
+    bool m_profilerRefit = true;     // Reset the flame graph zoom to the selected frame
+    std::string m_traceStatus;
+    
     // Splash screen state
     float m_splashStartTime = 0.0f;
-    float m_splashDuration = 5.0f;  // Longer duration to enjoy the retro effects
+    float m_splashDuration = 1.0f;  // Minimum display time; the splash also waits for startup tasks
     float m_splashAnimationTime = 0.0f;
     bool m_showAlgorithmInfo = false;
     bool m_showLicenses = false;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "renderer/Renderer.h"
 #include <vector>
 #include <string>
 
@@ -32,11 +33,13 @@ public:
     };
 
 public:
-    GraphVisualizer(AudioManager* audioManager = nullptr);
+    GraphVisualizer(AudioManager* audioManager = nullptr, Renderer* renderer = nullptr);
     ~GraphVisualizer() = default;
     
     void Update();
     void Render();
+    // Algorithms here finish within one frame; nothing plays back
+    [[nodiscard]] bool IsAnimating() const { return false; }
     void RenderControls();
     void RenderGraph();
     void RenderStatistics();
@@ -61,6 +64,10 @@ private:
     AudioManager* m_audioManager = nullptr;
     bool m_audioEnabled = true;
     
+    // Drawing
+    Renderer* m_renderer = nullptr;
+    std::vector<Renderer::Instance> m_nodeInstances; // Rebuilt each frame, kept for its capacity
+    
     const char* m_algorithmNames[4] = {
         "Kruskal's MST", "Prim's MST", 
         "Topological Sort", "Strongly Connected Components"
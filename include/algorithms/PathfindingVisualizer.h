@@ -1,5 +1,6 @@
 #pragma once
 
+#include "renderer/Renderer.h"
 #include <vector>
 #include <queue>
 #include <stack>
@@ -56,7 +57,7 @@ public:
     };
 
 public:
-    PathfindingVisualizer(AudioManager* audioManager = nullptr);
+    PathfindingVisualizer(AudioManager* audioManager = nullptr, Renderer* renderer = nullptr);
     ~PathfindingVisualizer() = default;
     
     void Update();
@@ -79,6 +80,8 @@ public:
     
     // Getters
     [[nodiscard]] AnimationState GetState() const { return m_state; }
+    // Steps are advancing, so every frame changes
+    [[nodiscard]] bool IsAnimating() const { return m_state == AnimationState::Running; }
     [[nodiscard]] Algorithm GetAlgorithm() const { return m_currentAlgorithm; }
 
 private:
@@ -130,6 +133,10 @@ private:
     AudioManager* m_audioManager = nullptr;
     bool m_audioEnabled = true;
     
+    // Drawing
+    Renderer* m_renderer = nullptr;
+    std::vector<Renderer::Instance> m_cellInstances; // Rebuilt each frame, kept for its capacity
+    
     // Algorithm implementations
     void ExecuteAStar();
     void ExecuteDijkstra();
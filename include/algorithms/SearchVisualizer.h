@@ -38,6 +38,8 @@ public:
 
     void Render();
     void Update();
+    // Steps are advancing, so every frame changes
+    [[nodiscard]] bool IsAnimating() const { return m_isRunning && !m_isComplete; }
 
     void SetPerformanceCallback(PerformanceCallback callback) { m_performanceCallback = callback; }
     std::string GetAlgorithmName(SearchAlgorithm algorithm) const;
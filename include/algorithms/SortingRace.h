@@ -0,0 +1,105 @@
+#pragma once
+
+#include "algorithms/SortingVisualizer.h"
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace AlgorithmVisualizer {
+
+class TaskPool;
+
+// Runs several sorting algorithms side by side on one shared input. Each lane is
+// its own SortingVisualizer, so lanes share no state and every lane records its
+// steps on a worker thread of its own. Playback waits until all lanes are ready,
+// then advances every lane by one step per tick from a single clock, so a lane
+// finishes in proportion to how many steps its algorithm needed. Everything
+// reported comes from the run itself: recorded comparisons and swaps, wall time
+// spent generating, and when each lane crossed the line.
+class SortingRace {
+public:
+    enum class State {
+        Idle,
+        Generating,
+        Running,
+        Paused,
+        Finished
+    };
+
+    // Lanes keep a full copy of the array per step, which bounds the input size
+    static constexpr size_t MAX_ARRAY_SIZE = 200;
+    static constexpr size_t MIN_LANES = 2;
+
+    struct LaneResult {
+        std::string algorithm;
+        size_t steps = 0;
+        int comparisons = 0;
+        int swaps = 0;
+        double generationMs = 0.0; // Wall time on the worker, step recording included
+        double finishMs = 0.0;     // Playback time until the lane's last step
+        int place = 0;             // 1 for the first lane to finish
+    };
+
+    explicit SortingRace(Renderer* renderer = nullptr);
+    ~SortingRace();
+
+    SortingRace(const SortingRace&) = delete;
+    SortingRace& operator=(const SortingRace&) = delete;
+
+    // Replaces any current race; playback starts by itself once every lane is generated
+    void Start(const std::vector<int>& input, const std::vector<SortingVisualizer::SortingAlgorithm>& algorithms);
+    void Pause();
+    void Resume();
+    // Waits for any generation still running, then drops the lanes
+    void Reset();
+    void SetStepDelay(std::chrono::milliseconds delay) { m_stepDelay = delay; }
+
+    void Update();
+    // Grid of lane panels filling the available region
+    void Render();
+    // Measured results of the last finished race, by place
+    void RenderResultsTable() const;
+
+    [[nodiscard]] State GetState() const { return m_state; }
+    [[nodiscard]] bool IsActive() const { return m_state == State::Generating || m_state == State::Running; }
+    [[nodiscard]] const std::vector<LaneResult>& GetResults() const { return m_results; }
+
+private:
+    struct GenerationSpan {
+        int64_t startNs = 0;
+        int64_t endNs = 0;
+    };
+
+    struct Lane {
+        std::unique_ptr<SortingVisualizer> visualizer; // Belongs to its worker until generation is ready
+        std::future<GenerationSpan> generation;
+        bool ready = false;
+        bool finished = false;
+        LaneResult result;
+    };
+
+    void CollectGenerated();
+    void AdvanceLanes();
+    void RenderLane(size_t index, const ImVec2& size) const;
+    [[nodiscard]] double ElapsedMs() const;
+
+    Renderer* m_renderer = nullptr;
+    std::vector<Lane> m_lanes;
+    std::unique_ptr<TaskPool> m_pool; // After m_lanes, so it is joined before they go
+    std::vector<LaneResult> m_results;
+
+    State m_state = State::Idle;
+    size_t m_inputSize = 0;
+    size_t m_resultsInputSize = 0;
+    int m_finishedCount = 0;
+
+    std::chrono::milliseconds m_stepDelay{100};
+    std::chrono::steady_clock::time_point m_lastStep;
+    std::chrono::steady_clock::time_point m_playbackStart;
+    std::chrono::steady_clock::time_point m_pausedAt;
+};
+
+} // namespace AlgorithmVisualizer
@@ -1,15 +1,20 @@
 #pragma once
 
+#include "renderer/Renderer.h"
 #include <vector>
 #include <string>
 #include <chrono>
+#include <cstdint>
 #include <functional>
+#include <future>
 #include <memory>
 #include <random>
 
 namespace AlgorithmVisualizer {
 
 class AudioManager;
+class SortingRace;
+class TaskPool;
 
 class SortingVisualizer {
 public:
@@ -39,19 +44,23 @@ public:
         int pivotIndex = -1;
         bool swapped = false;
         std::string description;
+        int comparisons = 0; // Running totals when the step was recorded
+        int swaps = 0;
     };
 
     using PerformanceCallback = std::function<void(const std::string&, double, int, int)>;
 
 public:
-    SortingVisualizer(AudioManager* audioManager = nullptr);
-    ~SortingVisualizer() = default;
+    SortingVisualizer(AudioManager* audioManager = nullptr, Renderer* renderer = nullptr);
+    ~SortingVisualizer();
     
     void Update();
     void Render();
     void RenderControls();
     void RenderVisualization();
     void RenderStatistics();
+    // The bar chart alone, sized to fit; race lanes draw themselves with it
+    void RenderBars(const ImVec2& size) const;
     
     // Control methods
     void StartSorting();
@@ -60,6 +69,11 @@ public:
     void StepForward();
     void StepBackward();
     
+    // Renders the sound of the whole run, at the current speed, into a WAV file on a
+    // worker; Update collects the outcome into the status next to the export button
+    void StartSonificationExport(const std::string& path);
+    [[nodiscard]] bool IsExportingSonification() const { return m_sonificationResult.valid(); }
+    
     // Configuration
     void SetArraySize(int size);
     void SetAnimationSpeed(float speed);
@@ -70,10 +84,20 @@ public:
     
     // Getters
     [[nodiscard]] AnimationState GetState() const { return m_state; }
+    // Steps are advancing (here or in a race) or an export is pending, so every frame changes
+    [[nodiscard]] bool IsAnimating() const;
     [[nodiscard]] SortingAlgorithm GetAlgorithm() const { return m_currentAlgorithm; }
     [[nodiscard]] const std::vector<int>& GetArray() const { return m_array; }
     [[nodiscard]] size_t GetCurrentStep() const { return m_currentStepIndex; }
     [[nodiscard]] size_t GetTotalSteps() const { return m_sortingSteps.size(); }
+    [[nodiscard]] const std::vector<SortingStep>& GetSteps() const { return m_sortingSteps; }
+    [[nodiscard]] int GetComparisons() const { return m_comparisons; }
+    [[nodiscard]] int GetSwaps() const { return m_swaps; }
+    [[nodiscard]] const SortingRace* GetRace() const { return m_race.get(); }
+    
+    // Takes an input and records the current algorithm's steps without starting
+    // playback. Touches nothing shared, so race lanes call it on worker threads.
+    void LoadSteps(const std::vector<int>& input);
 
     void SetPerformanceCallback(PerformanceCallback callback) { m_performanceCallback = callback; }
 
@@ -103,11 +127,28 @@ private:
     void IntroSortHeapify(std::vector<int>& arr, int low, int high, int i);
     int IntroSortPartition(std::vector<int>& arr, int low, int high);
     
+    void RenderRaceControls();
+    void StartRace();
+    
     // Animation and recording
     void RecordStep(const std::vector<int>& array, int comp1 = -1, int comp2 = -1, 
                    int pivot = -1, bool swapped = false, const std::string& desc = "");
     void ClearSteps();
     void ExecuteCurrentStep();
+    void GenerateSteps();
+    
+    // What one step sounds like, so an export can replay a run without its arrays
+    struct StepSound {
+        enum class Kind : uint8_t { None, Swap, Comparison };
+        Kind kind = Kind::None;
+        float pitch = 1.0f;
+    };
+    static StepSound GetStepSound(const SortingStep& step);
+    static void PlayStepSound(AudioManager& audio, const StepSound& sound);
+    // Runs on the export worker; false if the WAV could not be written in full
+    static bool RenderSonification(const std::vector<StepSound>& sounds, double stepSeconds, float volume,
+                                   const std::string& path);
+    void PollSonificationExport();
     
     // Data members
     std::vector<int> m_array;
@@ -151,6 +192,20 @@ private:
     AudioManager* m_audioManager;
     bool m_audioEnabled = true;
     float m_audioVolume = 0.5f;
+    std::string m_sonificationStatus;
+    std::string m_sonificationPath;
+    std::unique_ptr<TaskPool> m_sonificationPool; // Created on the first export
+    std::future<bool> m_sonificationResult;
+    static constexpr double SONIFICATION_TAIL_SECONDS = 1.0; // Lets the completion chord ring out
+
+    // Race mode: the selected algorithms run side by side on the current array
+    std::unique_ptr<SortingRace> m_race;
+    bool m_raceMode = false;
+    bool m_raceSelection[9] = {true, true, true, true, true, true, false, false, false};
+    
+    // Drawing
+    Renderer* m_renderer = nullptr;
+    mutable std::vector<Renderer::Instance> m_barInstances; // Scratch for RenderBars, kept for its capacity
 
     // Performance tracking
     PerformanceCallback m_performanceCallback;
@@ -6,7 +6,21 @@
 #include <queue>
 #include <chrono>
 #include <functional>
+#include <random>
+#include <atomic>
+#include <thread>
+#include <future>
+#include <fmt/format.h>
 #include "audio/AudioManager.h"
+#include "algorithms/trees/AdaptiveRadixTree.h"
+#include "algorithms/trees/BTree.h"
+#include "algorithms/trees/Heaps.h"
+#include "algorithms/trees/PatriciaTrie.h"
+#include "algorithms/trees/RangeTrees.h"
+#include "algorithms/trees/SkipList.h"
+#include "algorithms/trees/SnapshotCell.h"
+#include "algorithms/trees/StaticSearchTree.h"
+#include "algorithms/trees/TreeBenchmarks.h"
 
 // Forward declarations
 struct ImDrawList;
@@ -15,13 +29,25 @@ struct ImVec2;
 namespace AlgorithmVisualizer {
 
 class AudioManager;
+class TaskPool;
 
 enum class TreeAlgorithm {
     BinarySearchTree,
     AVLTree,
     MinHeap,
     MaxHeap,
-    RedBlackTree
+    RedBlackTree,
+    BTree,
+    BPlusTree,
+    PairingHeap,
+    RadixHeap,
+    SkipList,
+    SplayTree,
+    Treap,
+    AdaptiveRadixTree,
+    SegmentTree,
+    FenwickTree,
+    PatriciaTrie
 };
 
 enum class TreeOperation {
@@ -38,8 +64,9 @@ struct TreeNode {
     std::shared_ptr<TreeNode> left;
     std::shared_ptr<TreeNode> right;
     int height = 1; // For AVL trees
+    int size = 1; // Nodes in this subtree, for order statistics
+    int priority = 0; // For treaps
     enum Color { RED, BLACK } color = RED; // For Red-Black trees
-    float x = 0, y = 0; // For visualization positioning
     bool isHighlighted = false;
     bool isNew = false;
     bool isDeleted = false;
@@ -47,6 +74,35 @@ struct TreeNode {
     TreeNode(int val) : value(val) {}
 };
 
+// Flat, render-ready copy of a TreeNode tree, rebuilt only when the tree changes.
+// x is the in-order rank, so every subtree covers the contiguous range [minX, minX + size).
+struct TreeLayoutNode {
+    int value = 0;
+    int priority = 0;
+    int depth = 0;
+    int left = -1;  // Index into the layout, -1 if absent
+    int right = -1;
+    int subtreeSize = 1;
+    int subtreeBottom = 0; // Deepest depth in the subtree
+    int x = 0;
+    int minX = 0;
+    bool isHighlighted = false;
+    bool isNew = false;
+    bool isDeleted = false;
+    bool isRed = false;
+};
+
+// Immutable layout handed to the renderer; whoever mutates the tree publishes a new one
+struct TreeSnapshot {
+    std::vector<TreeLayoutNode> nodes;
+    int height = 0;
+};
+
+enum class TreeJob {
+    BulkInsert,     // Insert random keys
+    MixedWorkload   // 50% insert, 25% delete, 25% search over a bounded key range
+};
+
 struct TreeStep {
     std::string description;
     std::shared_ptr<TreeNode> highlightedNode;
@@ -60,10 +116,14 @@ struct TreeStep {
 class TreeVisualizer {
 public:
     TreeVisualizer(std::shared_ptr<AlgorithmVisualizer::AudioManager> audioManager);
-    ~TreeVisualizer() = default;
+    ~TreeVisualizer();
 
     void Render();
     void Update();
+    // Steps are advancing, or a background job or benchmark has progress to show
+    [[nodiscard]] bool IsAnimating() const {
+        return (m_isRunning && !m_isComplete) || IsBackgroundJobRunning() || IsBenchmarkRunning();
+    }
 
     void SetPerformanceCallback(PerformanceCallback callback) { m_performanceCallback = callback; }
     std::string GetAlgorithmName(TreeAlgorithm algorithm) const;
@@ -72,6 +132,15 @@ private:
     void RenderControls();
     void RenderVisualization();
     void RenderStatistics();
+    void RenderBTree(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize);
+    void RenderPairingHeap(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize);
+    void RenderRadixHeap(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize);
+    void RenderSkipList(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize);
+    void RenderRadixTree(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize);
+    void RenderSegmentTree(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize);
+    void RenderFenwickTree(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize);
+    void RenderBenchmarks();
+    void RenderBenchmarkReport(const BenchmarkReport& report);
     
     // Tree operations
     void InsertValue(int value);
@@ -87,40 +156,202 @@ private:
     // AVL operations
     std::shared_ptr<TreeNode> AVLInsert(std::shared_ptr<TreeNode> root, int value);
     std::shared_ptr<TreeNode> AVLDelete(std::shared_ptr<TreeNode> root, int value);
+    std::shared_ptr<TreeNode> AVLRebalance(std::shared_ptr<TreeNode> node);
     std::shared_ptr<TreeNode> RotateLeft(std::shared_ptr<TreeNode> x);
     std::shared_ptr<TreeNode> RotateRight(std::shared_ptr<TreeNode> y);
     int GetHeight(std::shared_ptr<TreeNode> node);
     int GetBalance(std::shared_ptr<TreeNode> node);
-    void UpdateHeight(std::shared_ptr<TreeNode> node);
+    void UpdateHeight(std::shared_ptr<TreeNode> node); // Also refreshes the subtree size
+    void UpdateSubtree(const std::shared_ptr<TreeNode>& node); // UpdateHeight, recording a step if the size changed
+    
+    // Red-Black operations (left-leaning variant)
+    std::shared_ptr<TreeNode> RBInsert(std::shared_ptr<TreeNode> root, int value);
+    std::shared_ptr<TreeNode> RBDelete(std::shared_ptr<TreeNode> root, int value);
+    std::shared_ptr<TreeNode> RBInsertAt(std::shared_ptr<TreeNode> node, int value);
+    std::shared_ptr<TreeNode> RBDeleteAt(std::shared_ptr<TreeNode> node, int value);
+    std::shared_ptr<TreeNode> RBDeleteMin(std::shared_ptr<TreeNode> node);
+    std::shared_ptr<TreeNode> RBBalance(std::shared_ptr<TreeNode> node);
+    std::shared_ptr<TreeNode> MoveRedLeft(std::shared_ptr<TreeNode> node);
+    std::shared_ptr<TreeNode> MoveRedRight(std::shared_ptr<TreeNode> node);
+    std::shared_ptr<TreeNode> RBRotateLeft(std::shared_ptr<TreeNode> node); // Rotation that keeps the link colors
+    std::shared_ptr<TreeNode> RBRotateRight(std::shared_ptr<TreeNode> node);
+    void FlipColors(const std::shared_ptr<TreeNode>& node);
+    static bool IsRed(const TreeNode* node) { return node && node->color == TreeNode::RED; }
+    
+    // Order statistics over the subtree sizes, O(height) each
+    static int SubtreeSize(const TreeNode* node) { return node ? node->size : 0; }
+    std::shared_ptr<TreeNode> SelectNode(int rank); // 0-based
+    int CountBelow(int value, bool inclusive);
+    void SelectValue(int rank);                      // 1-based, as shown in the UI
+    void RankValue(int value);
+    void CountRangeValues(int low, int high);
+    void PercentileValue(int percentile);
+    
+    // Frozen read-only copy of a binary tree; searches use it until the next update
+    void FreezeTree();
+    void ThawTree(const char* reason);
+    void RenderFrozenLayout(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize);
+    
+    // Splay tree / treap operations
+    std::shared_ptr<TreeNode> Splay(std::shared_ptr<TreeNode> root, int value);
+    std::shared_ptr<TreeNode> SplayInsert(std::shared_ptr<TreeNode> root, int value);
+    std::shared_ptr<TreeNode> SplayDelete(std::shared_ptr<TreeNode> root, int value);
+    std::shared_ptr<TreeNode> TreapInsert(std::shared_ptr<TreeNode> root, int value);
+    std::shared_ptr<TreeNode> TreapDelete(std::shared_ptr<TreeNode> root, int value);
     
     // Heap operations
     void HeapInsert(int value);
     void HeapExtract();
     void HeapifyUp(int index);
     void HeapifyDown(int index);
+    void RebuildHeap();
+    
+    // Pairing / radix heap operations (items are handles, values are keys)
+    bool IsHandleHeapAlgorithm() const;
+    PriorityQueue* EnsurePriorityQueue();
+    int FindQueuedItem(int key) const;
+    void DecreaseKeyValue(int value, int newKey);
+    
+    // Skip list operations
+    void EnsureSkipList();
+    
+    // Adaptive radix tree operations
+    void EnsureRadixTree();
+    
+    // Patricia trie operations; the trie is keyed by the word field rather than Value
+    void EnsureTrie();
+    void RebuildTrie(); // Same keys under the selected child layout
+    void InsertWord(const std::string& word);
+    void EraseWord(const std::string& word);
+    void FindWord(const std::string& word);
+    void PrefixScanWords(const std::string& prefix);
+    void RangeScanWords(const std::string& low, const std::string& high);
+    void LoadDictionary(const std::string& path);
+    void RenderPatriciaTrie(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize);
+    
+    // Segment tree / Fenwick tree operations over [m_rangeLeft, m_rangeRight]
+    bool IsRangeTreeAlgorithm() const;
+    void EnsureRangeTree();
+    void RebuildRangeTree();
+    void RangeAddValues(int delta);
+    void RangeQueryValues(bool minimum);
+    
+    // B-tree / B+tree operations
+    bool IsBTreeAlgorithm() const;
+    void EnsureBTree();
+    void RebuildBTree();
+    void RangeScanValues(int low, int high);
+    
+    // Benchmarks
+    void RunNodeOrderBenchmark();
+    void RunPriorityQueueBenchmark();
+    void RunConcurrencyBenchmark();
+    void RunAccessPatternBenchmark();
+    void RunRadixTreeBenchmark();
+    void RunRangeQueryBenchmark();
+    void RunOrderStatisticBenchmark();
+    void RunStaticLayoutBenchmark();
+    void RunStringTrieBenchmark();
+    // Benchmarks run one at a time on a worker; Render polls for the report
+    void StartBenchmark(std::string name, std::function<BenchmarkReport()> run);
+    void PollBenchmark();
+    bool IsBenchmarkRunning() const { return m_benchmarkResult.valid(); }
+    
+    // Virtualized rendering of TreeNode-based trees
+    bool IsBinaryTreeAlgorithm() const;
+    static std::shared_ptr<const TreeSnapshot> MakeSnapshot(const TreeNode* root);
+    void BuildLayout();
+    void FitView(const TreeSnapshot& snapshot, const ImVec2& canvasSize);
+    float ViewUnitWidth() const;
+    float ViewLevelHeight() const;
+    void HandleViewInput(const ImVec2& canvasPos);
+    void RenderTreeLayout(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize);
+    
+    // Background mutation: while a job runs the worker owns m_root and the
+    // binary tree operations, and the UI only reads published snapshots
+    void StartBackgroundJob(TreeJob job, int operations);
+    void RunBackgroundJob(TreeJob job, int operations, unsigned int seed);
+    void PollBackgroundJob();
+    void FinishBackgroundJob();
+    bool IsBackgroundJobRunning() const { return m_jobThread.joinable(); }
+    void RenderBackgroundJob();
     
     // Utility functions
-    void CalculatePositions(std::shared_ptr<TreeNode> node, float x, float y, float spacing);
-    void DrawNode(std::shared_ptr<TreeNode> node, ImDrawList* drawList, ImVec2 offset);
-    void DrawEdge(std::shared_ptr<TreeNode> parent, std::shared_ptr<TreeNode> child, 
-                  ImDrawList* drawList, ImVec2 offset);
+    void InsertTreeNode(int value);
+    void DeleteTreeNode(int value);
+    bool FindTreeNode(int value);
+    void InsertRandomKeys(int count);
+    void DrawNode(const TreeLayoutNode& node, ImDrawList* drawList, const ImVec2& center, float radius) const;
+    void DrawEdge(ImDrawList* drawList, const ImVec2& from, const ImVec2& to) const;
+    void DrawCollapsedSubtree(const TreeLayoutNode& node, ImDrawList* drawList, const ImVec2& apex,
+                              float left, float right, float bottom) const;
     void ClearTree();
     void ResetVisualization();
     void RecordStep(const std::string& description, std::shared_ptr<TreeNode> highlighted = nullptr);
     void PlayStepSound(bool isComparison, bool isInsertion, bool isRotation);
     
-    // Tree traversal
-    void InorderTraversal(std::shared_ptr<TreeNode> node, std::vector<int>& result);
-    void PreorderTraversal(std::shared_ptr<TreeNode> node, std::vector<int>& result);
-    void PostorderTraversal(std::shared_ptr<TreeNode> node, std::vector<int>& result);
+    // Formats and records a step only while step recording is on (bulk operations turn it off)
+    template <typename... Args>
+    void RecordStep(const std::shared_ptr<TreeNode>& highlighted, fmt::format_string<Args...> format, Args&&... args) {
+        if (m_recordSteps) {
+            RecordStep(fmt::format(format, std::forward<Args>(args)...), highlighted);
+        }
+    }
+    
+    // Tree traversal, iterative so tree depth is not limited by the stack
+    void InorderTraversal(const TreeNode* node, std::vector<int>& result); // Records steps up to a limit
+    void PreorderTraversal(const TreeNode* node, std::vector<int>& result);
+    void PostorderTraversal(const TreeNode* node, std::vector<int>& result);
     void LevelOrderTraversal();
     
     // Data
     std::shared_ptr<TreeNode> m_root;
     std::vector<int> m_heap; // For heap visualization
+    std::unique_ptr<BTree> m_btree; // For B-tree / B+tree visualization
+    std::unique_ptr<PairingHeap> m_pairingHeap; // For pairing heap visualization
+    std::unique_ptr<RadixHeap> m_radixHeap; // For radix heap visualization
+    std::unique_ptr<SkipList> m_skipList; // For skip list visualization
+    std::vector<const SkipList::Node*> m_skipListPath; // Towers touched by the last search
+    std::unique_ptr<AdaptiveRadixTree> m_radixTree; // For adaptive radix tree visualization
+    std::unique_ptr<PatriciaTrie> m_trie; // For Patricia trie visualization
+    std::vector<const PatriciaTrie::Node*> m_triePath; // Nodes touched by the last word search
+    std::vector<std::string> m_trieMatches; // Result of the last prefix or range scan
+    std::unique_ptr<SegmentTree> m_segmentTree; // For segment tree visualization
+    std::unique_ptr<FenwickTree> m_fenwickTree; // For Fenwick tree visualization
+    std::vector<int64_t> m_rangeValues; // Element array behind the range trees
+    SegmentTree::Trace m_segmentTrace; // Nodes touched by the last range query
+    FenwickTree::Trace m_fenwickTrace;
+    std::unique_ptr<StaticSearchTree> m_frozenTree; // Binary tree frozen into an array layout
+    std::vector<int> m_frozenPath; // Slots visited by the last frozen search
     std::vector<TreeStep> m_steps;
+    bool m_recordSteps = true;
     std::shared_ptr<AlgorithmVisualizer::AudioManager> m_audioManager;
     
+    // Layout and view for TreeNode-based trees
+    SnapshotCell<TreeSnapshot> m_snapshot{std::make_shared<const TreeSnapshot>()};
+    bool m_layoutDirty = true;
+    bool m_autoFit = true;         // Refit on every change until the user zooms or pans
+    float m_viewScale = 1.0f;      // 1 = whole tree fits horizontally
+    float m_viewOffsetX = 0.0f;    // Screen position of rank 0 / depth 0 relative to the canvas
+    float m_viewOffsetY = 0.0f;
+    float m_fitUnitWidth = 40.0f;  // Pixels per in-order rank at scale 1
+    float m_fitLevelHeight = 60.0f;
+    int m_visibleNodes = 0;
+    int m_collapsedSubtrees = 0;
+    
+    // Background job
+    std::thread m_jobThread;
+    std::atomic<bool> m_jobCancel{false};
+    std::atomic<bool> m_jobFinished{false};
+    std::atomic<int> m_jobProgress{0};    // Operations completed by the worker
+    TreeJob m_jobKind = TreeJob::BulkInsert;
+    int m_jobOperations = 0;
+    int m_jobSize = 100000;
+    std::chrono::steady_clock::time_point m_jobStartTime;
+    std::chrono::steady_clock::time_point m_jobRateTime;
+    int m_jobRateProgress = 0;
+    double m_jobOpsPerSecond = 0.0;
+    
     // Algorithm state
     TreeAlgorithm m_currentAlgorithm = TreeAlgorithm::BinarySearchTree;
     TreeOperation m_currentOperation = TreeOperation::Insert;
@@ -146,8 +377,31 @@ private:
     
     // UI state
     bool m_showTraversal = false;
+    bool m_showSubtreeSizes = false;
+    int m_percentile = 50;
+    int m_frozenLayout = static_cast<int>(StaticSearchTree::Layout::VanEmdeBoas);
+    char m_trieWord[64] = "tree";
+    char m_trieRangeEnd[64] = "trie";
+    char m_dictionaryPath[256] = "/usr/share/dict/words";
+    int m_trieLayout = static_cast<int>(PatriciaTrie::ChildLayout::SortedArray);
     bool m_autoBalance = true;
     std::vector<int> m_traversalResult;
+    int m_btreeOrder = BTree::MIN_ORDER;
+    int m_rangeEnd = 75;
+    int m_rangeElements = 16;
+    int m_rangeLeft = 2;
+    int m_rangeRight = 11;
+    int m_heapArity = 2;
+    std::mt19937 m_treapRng{std::random_device{}()};
+    int m_newKey = 1;
+    
+    // Benchmarks
+    int m_benchmarkKeys = 100000;
+    BenchmarkReport m_benchmarkReport;
+    std::unique_ptr<TaskPool> m_benchmarkPool; // Created on the first run
+    std::future<BenchmarkReport> m_benchmarkResult;
+    std::string m_benchmarkName;
+    std::chrono::steady_clock::time_point m_benchmarkStartTime;
     
     // Performance tracking
     PerformanceCallback m_performanceCallback;
@@ -160,7 +414,18 @@ private:
         "AVL Tree",
         "Min Heap",
         "Max Heap",
-        "Red-Black Tree"
+        "Red-Black Tree",
+        "B-Tree",
+        "B+ Tree",
+        "Pairing Heap",
+        "Radix Heap",
+        "Skip List",
+        "Splay Tree",
+        "Treap",
+        "Adaptive Radix Tree",
+        "Segment Tree",
+        "Fenwick Tree",
+        "Patricia Trie"
     };
     
     static constexpr const char* s_operationNames[] = {
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <fmt/format.h>
+
+namespace AlgorithmVisualizer {
+
+// Adaptive radix tree (Leis et al., ICDE 2013) over byte-string keys. Inner nodes
+// pick the smallest of four layouts that fits their fan-out (Node4/16/48/256)
+// and change layout as children come and go. A path with a single child at
+// every level is compressed into the node's prefix (the first MAX_PREFIX bytes
+// are kept, the rest are checked against a leaf), and a leaf sits directly
+// below the first byte where its key becomes unique (lazy expansion).
+//
+// Keys must be prefix-free. Int keys are stored as 4 big-endian bytes with the
+// sign bit flipped, so byte order is numeric order. String keys get a NUL
+// terminator and must not contain NUL themselves. Keep to one kind per tree.
+class AdaptiveRadixTree {
+public:
+    enum class NodeType : uint8_t {
+        Leaf,
+        Node4,
+        Node16,
+        Node48,
+        Node256
+    };
+
+    static constexpr size_t MAX_PREFIX = 8;
+    static constexpr int NODE_TYPE_COUNT = 5;
+
+    struct Node {
+        NodeType type;
+        explicit Node(NodeType t) : type(t) {}
+    };
+
+    struct Leaf : Node {
+        std::string key; // Encoded key bytes
+        explicit Leaf(std::string_view k) : Node(NodeType::Leaf), key(k) {}
+    };
+
+    struct InnerNode : Node {
+        uint16_t childCount = 0;
+        uint32_t prefixLength = 0; // Length of the compressed path; only MAX_PREFIX bytes are stored
+        std::array<uint8_t, MAX_PREFIX> prefix{};
+        explicit InnerNode(NodeType t) : Node(t) {}
+    };
+
+    struct Node4 : InnerNode {
+        std::array<uint8_t, 4> keys{};
+        std::array<Node*, 4> children{};
+        Node4() : InnerNode(NodeType::Node4) {}
+    };
+
+    struct Node16 : InnerNode {
+        alignas(16) std::array<uint8_t, 16> keys{};
+        std::array<Node*, 16> children{};
+        Node16() : InnerNode(NodeType::Node16) {}
+    };
+
+    struct Node48 : InnerNode {
+        std::array<uint8_t, 256> childIndex{}; // Slot + 1 per key byte, 0 if absent
+        std::array<Node*, 48> children{};
+        Node48() : InnerNode(NodeType::Node48) {}
+    };
+
+    struct Node256 : InnerNode {
+        std::array<Node*, 256> children{};
+        Node256() : InnerNode(NodeType::Node256) {}
+    };
+
+    struct Stats {
+        uint64_t nodesVisited = 0;
+        uint64_t grows = 0;          // Node4 -> 16 -> 48 -> 256
+        uint64_t shrinks = 0;        // And back, plus Node4 collapsing into its only child
+        uint64_t prefixSplits = 0;
+        uint64_t leafExpansions = 0; // Lazily placed leaf pushed down under a new Node4
+    };
+
+    using StepCallback = std::function<void(const std::string&)>;
+    using KeyVisitor = std::function<void(std::string_view)>;
+
+    AdaptiveRadixTree() = default;
+    ~AdaptiveRadixTree();
+
+    AdaptiveRadixTree(const AdaptiveRadixTree&) = delete;
+    AdaptiveRadixTree& operator=(const AdaptiveRadixTree&) = delete;
+
+    bool Insert(int key);
+    bool Erase(int key);
+    bool Contains(int key) const;
+    std::vector<int> RangeScan(int low, int high) const;
+    std::vector<int> Keys() const;
+
+    bool InsertString(std::string_view key);
+    bool EraseString(std::string_view key);
+    bool ContainsString(std::string_view key) const;
+    std::vector<std::string> StringKeys() const;
+
+    // In-order walk over the encoded keys
+    void ForEach(const KeyVisitor& visit) const;
+    void Clear();
+
+    [[nodiscard]] size_t Size() const { return m_size; }
+    [[nodiscard]] int Height() const;
+    [[nodiscard]] size_t NodeCount(NodeType type) const { return m_nodeCounts[static_cast<size_t>(type)]; }
+    [[nodiscard]] size_t MemoryBytes() const;
+    [[nodiscard]] const Node* Root() const { return m_root; }
+    // Inner node created or re-laid-out by the last mutation, for highlighting
+    [[nodiscard]] const Node* LastChanged() const { return m_lastChanged; }
+    [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = Stats{}; }
+
+    void SetStepCallback(StepCallback callback) { m_stepCallback = std::move(callback); }
+
+    // Children of an inner node in key-byte order
+    static void ForEachChild(const InnerNode* node, const std::function<void(uint8_t, const Node*)>& visit);
+    static const char* NodeTypeName(NodeType type);
+    static int DecodeInt(std::string_view key);
+    static const char* SearchKernelName();
+
+private:
+    using IntKey = std::array<char, 4>;
+    static IntKey EncodeInt(int key);
+    static std::string TerminatedString(std::string_view key);
+    static uint8_t KeyByte(std::string_view key, size_t depth) {
+        return depth < key.size() ? static_cast<uint8_t>(key[depth]) : 0;
+    }
+
+    bool InsertKey(std::string_view key);
+    bool EraseKey(std::string_view key);
+    bool ContainsKey(std::string_view key) const;
+    bool InsertAt(Node*& ref, std::string_view key, size_t depth);
+    bool EraseAt(Node*& ref, std::string_view key, size_t depth);
+    void CollectRange(const Node* node, size_t depth, std::string_view low, std::string_view high,
+                      bool onLow, bool onHigh, std::vector<int>& out) const;
+
+    static Node** FindChild(InnerNode* node, uint8_t byte);
+    static const Node* FindChild(const InnerNode* node, uint8_t byte);
+    static const Leaf* Minimum(const Node* node);
+    static size_t PrefixMismatch(const InnerNode* node, std::string_view key, size_t depth);
+    static void CopyHeader(InnerNode* to, const InnerNode* from);
+
+    void AddChild(Node*& ref, uint8_t byte, Node* child);
+    void RemoveChild(Node*& ref, uint8_t byte, Node** slot);
+    template <typename T, typename... Args>
+    T* NewNode(Args&&... args);
+    void DeleteNode(Node* node);
+    void FreeSubtree(Node* node);
+    template <typename Visit>
+    static void WalkSubtree(const Node* node, Visit& visit);
+
+    template <typename... Args>
+    void EmitStep(fmt::format_string<Args...> format, Args&&... args) {
+        if (m_stepCallback) {
+            m_stepCallback(fmt::format(format, std::forward<Args>(args)...));
+        }
+    }
+
+    Node* m_root = nullptr;
+    size_t m_size = 0;
+    std::array<size_t, NODE_TYPE_COUNT> m_nodeCounts{};
+    const Node* m_lastChanged = nullptr;
+    mutable Stats m_stats;
+    StepCallback m_stepCallback;
+};
+
+} // namespace AlgorithmVisualizer
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstdint>
+#include <functional>
+#include <fmt/format.h>
+
+namespace AlgorithmVisualizer {
+
+// B-tree / B+tree over int keys with a configurable order (maximum keys per node).
+// In the B+tree variant all keys live in the leaves, internal keys are routing
+// separators and the leaves are chained left-to-right for range scans.
+class BTree {
+public:
+    enum class Variant {
+        BTree,
+        BPlusTree
+    };
+
+    static constexpr int MIN_ORDER = 4;
+    static constexpr int MAX_ORDER = 256;
+
+    struct Node {
+        bool leaf = true;
+        std::vector<int> keys;
+        std::vector<std::unique_ptr<Node>> children;
+        Node* next = nullptr; // Leaf chain (B+tree only)
+    };
+
+    struct Stats {
+        uint64_t nodesVisited = 0;
+        uint64_t splits = 0;
+        uint64_t merges = 0;
+        uint64_t borrows = 0;
+    };
+
+    using StepCallback = std::function<void(const std::string&)>;
+
+    explicit BTree(int order = MIN_ORDER, Variant variant = Variant::BTree);
+
+    bool Insert(int key);
+    bool Erase(int key);
+    bool Contains(int key) const;
+    std::vector<int> RangeScan(int low, int high) const;
+    std::vector<int> Keys() const;
+    void Clear();
+
+    [[nodiscard]] int GetOrder() const { return m_order; }
+    [[nodiscard]] Variant GetVariant() const { return m_variant; }
+    [[nodiscard]] size_t Size() const { return m_size; }
+    [[nodiscard]] size_t NodeCount() const { return m_nodeCount; }
+    [[nodiscard]] int Height() const;
+    [[nodiscard]] const Node* Root() const { return m_root.get(); }
+    [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = Stats{}; }
+
+    // Step recording for the visualizer; formatting is skipped when no callback is set
+    void SetStepCallback(StepCallback callback) { m_stepCallback = std::move(callback); }
+
+    // Intra-node search (SSE2/AVX2 when available): number of keys < key / <= key
+    static int NodeLowerBound(const int* keys, int count, int key);
+    static int NodeUpperBound(const int* keys, int count, int key);
+    static const char* SearchKernelName();
+
+private:
+    int MinKeys() const { return m_order / 2; }
+    int ChildIndex(const Node* node, int key) const;
+
+    bool InsertInto(Node* node, int key, int& promotedKey, std::unique_ptr<Node>& splitOff);
+    void SplitNode(Node* node, int& promotedKey, std::unique_ptr<Node>& splitOff);
+    bool EraseFrom(Node* node, int key);
+    void FixUnderflow(Node* parent, int childIndex);
+    void BorrowFromLeft(Node* parent, int childIndex);
+    void BorrowFromRight(Node* parent, int childIndex);
+    void MergeChildren(Node* parent, int leftIndex);
+    void CollectRange(const Node* node, int low, int high, std::vector<int>& out) const;
+
+    template <typename... Args>
+    void EmitStep(fmt::format_string<Args...> format, Args&&... args) {
+        if (m_stepCallback) {
+            m_stepCallback(fmt::format(format, std::forward<Args>(args)...));
+        }
+    }
+
+    std::unique_ptr<Node> m_root;
+    int m_order;
+    Variant m_variant;
+    size_t m_size = 0;
+    size_t m_nodeCount = 1;
+    mutable Stats m_stats;
+    StepCallback m_stepCallback;
+};
+
+} // namespace AlgorithmVisualizer
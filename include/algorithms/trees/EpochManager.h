@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <vector>
+#include <cstdint>
+
+namespace AlgorithmVisualizer {
+
+// Epoch-based reclamation for lock-free structures. Each thread uses a fixed
+// slot index; an object retired in epoch e is freed once the global epoch has
+// reached e + 2, i.e. after every thread active at retirement has left.
+class EpochManager {
+public:
+    static constexpr int MAX_THREADS = 64;
+
+    // RAII critical section: pointers read from the structure stay valid until it ends
+    class Guard {
+    public:
+        Guard(EpochManager& manager, int slot) : m_manager(manager), m_slot(slot) { m_manager.Enter(m_slot); }
+        ~Guard() { m_manager.Exit(m_slot); }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+    private:
+        EpochManager& m_manager;
+        int m_slot;
+    };
+
+    EpochManager() = default;
+    ~EpochManager();
+
+    EpochManager(const EpochManager&) = delete;
+    EpochManager& operator=(const EpochManager&) = delete;
+
+    void Enter(int slot);
+    void Exit(int slot);
+    // Must be called from inside a critical section of the same slot
+    void Retire(int slot, void* object, void (*deleter)(void*));
+
+    [[nodiscard]] uint64_t GlobalEpoch() const { return m_globalEpoch.load(std::memory_order_relaxed); }
+    // Only meaningful while no thread is using the manager
+    [[nodiscard]] uint64_t ReclaimedCount() const;
+
+private:
+    static constexpr uint64_t ACTIVE = 1;
+    static constexpr int ADVANCE_INTERVAL = 64;
+
+    struct Retired {
+        void* object;
+        void (*deleter)(void*);
+    };
+
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> state{0}; // (epoch << 1) | ACTIVE while inside a critical section
+        std::array<std::vector<Retired>, 3> limbo;
+        std::array<uint64_t, 3> limboEpoch{};
+        int retiresSinceAdvance = 0;
+        uint64_t reclaimed = 0;
+    };
+
+    void TryAdvance();
+    static void Free(std::vector<Retired>& list);
+
+    alignas(64) std::atomic<uint64_t> m_globalEpoch{0};
+    std::array<Slot, MAX_THREADS> m_slots;
+};
+
+} // namespace AlgorithmVisualizer
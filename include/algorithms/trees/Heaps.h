@@ -0,0 +1,131 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+namespace AlgorithmVisualizer {
+
+// Min-priority queue over integer items in [0, capacity) with unsigned keys.
+// Items double as handles for DecreaseKey, the way vertex ids do in Dijkstra.
+class PriorityQueue {
+public:
+    struct Entry {
+        int item;
+        uint32_t key;
+    };
+
+    virtual ~PriorityQueue() = default;
+
+    // Push fails if the item is out of range or already queued;
+    // DecreaseKey fails if the item is not queued or the key is not lower
+    virtual bool Push(int item, uint32_t key) = 0;
+    virtual bool DecreaseKey(int item, uint32_t key) = 0;
+    virtual Entry Pop() = 0; // Precondition: !Empty()
+    virtual bool Contains(int item) const = 0;
+    virtual uint32_t KeyOf(int item) const = 0;
+    virtual size_t Size() const = 0;
+    virtual void Clear() = 0;
+    virtual const char* Name() const = 0;
+
+    bool Empty() const { return Size() == 0; }
+};
+
+// Implicit d-ary heap with a position index for DecreaseKey; sifts move a hole
+// instead of swapping so each level costs one store
+class DaryHeap final : public PriorityQueue {
+public:
+    DaryHeap(int arity, size_t capacity);
+
+    bool Push(int item, uint32_t key) override;
+    bool DecreaseKey(int item, uint32_t key) override;
+    Entry Pop() override;
+    bool Contains(int item) const override;
+    uint32_t KeyOf(int item) const override;
+    size_t Size() const override { return m_heap.size(); }
+    void Clear() override;
+    const char* Name() const override;
+
+    [[nodiscard]] int GetArity() const { return m_arity; }
+
+private:
+    void SiftUp(size_t index);
+    void SiftDown(size_t index);
+
+    int m_arity;
+    std::vector<Entry> m_heap;
+    std::vector<int> m_position; // -1 when the item is not queued
+};
+
+// Pairing heap on an index-linked node pool (one node per item).
+// Pop uses the iterative two-pass pairing; DecreaseKey cuts the subtree and melds it with the root.
+class PairingHeap final : public PriorityQueue {
+public:
+    struct Node {
+        uint32_t key = 0;
+        int child = -1;
+        int sibling = -1;
+        int prev = -1; // Parent for a leftmost child, otherwise the left sibling
+        bool queued = false;
+    };
+
+    explicit PairingHeap(size_t capacity);
+
+    bool Push(int item, uint32_t key) override;
+    bool DecreaseKey(int item, uint32_t key) override;
+    Entry Pop() override;
+    bool Contains(int item) const override;
+    uint32_t KeyOf(int item) const override;
+    size_t Size() const override { return m_size; }
+    void Clear() override;
+    const char* Name() const override { return "Pairing heap"; }
+
+    [[nodiscard]] int Root() const { return m_root; }
+    [[nodiscard]] const Node& NodeAt(int item) const { return m_nodes[item]; }
+
+private:
+    int Meld(int a, int b);
+    int MergePairs(int first);
+
+    std::vector<Node> m_nodes;
+    std::vector<int> m_pairs; // Scratch for MergePairs
+    int m_root = -1;
+    size_t m_size = 0;
+};
+
+// Monotone radix heap: keys pushed must not be below the last popped key.
+// Entries sit in bucket floor(log2(key ^ last)) + 1; Pop redistributes the first
+// non-empty bucket around its minimum. DecreaseKey re-pushes and the old entry
+// is skipped lazily when it surfaces.
+class RadixHeap final : public PriorityQueue {
+public:
+    static constexpr int BUCKET_COUNT = 33;
+
+    explicit RadixHeap(size_t capacity);
+
+    bool Push(int item, uint32_t key) override;
+    bool DecreaseKey(int item, uint32_t key) override;
+    Entry Pop() override;
+    bool Contains(int item) const override;
+    uint32_t KeyOf(int item) const override;
+    size_t Size() const override { return m_size; }
+    void Clear() override;
+    const char* Name() const override { return "Radix heap"; }
+
+    [[nodiscard]] uint32_t LastKey() const { return m_last; }
+    [[nodiscard]] const std::vector<Entry>& Bucket(int index) const { return m_buckets[index]; }
+    [[nodiscard]] bool IsLive(const Entry& entry) const;
+
+private:
+    static int BucketIndex(uint32_t key, uint32_t last);
+
+    std::array<std::vector<Entry>, BUCKET_COUNT> m_buckets;
+    std::vector<Entry> m_redistribute; // Scratch for Pop
+    std::vector<uint32_t> m_keys;
+    std::vector<uint8_t> m_queued;
+    uint32_t m_last = 0;
+    size_t m_size = 0;
+};
+
+} // namespace AlgorithmVisualizer
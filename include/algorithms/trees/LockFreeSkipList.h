@@ -0,0 +1,69 @@
+#pragma once
+
+#include "algorithms/trees/EpochManager.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+namespace AlgorithmVisualizer {
+
+// Lock-free skip list set (Herlihy-Shavit / Fraser) over int keys in
+// (INT_MIN, INT_MAX). Deletion marks the low bit of a node's forward pointers,
+// top level first; traversals in Insert/Erase physically unlink marked nodes.
+// Unlinked nodes are reclaimed through an EpochManager.
+//
+// Every call takes the caller's thread slot in [0, EpochManager::MAX_THREADS);
+// two threads must never use the same slot concurrently.
+class LockFreeSkipList {
+public:
+    static constexpr int MAX_LEVEL = 16;
+
+    LockFreeSkipList();
+    ~LockFreeSkipList();
+
+    LockFreeSkipList(const LockFreeSkipList&) = delete;
+    LockFreeSkipList& operator=(const LockFreeSkipList&) = delete;
+
+    bool Insert(int key, int slot);
+    bool Erase(int key, int slot);
+    bool Contains(int key, int slot);
+
+    [[nodiscard]] size_t Size() const { return static_cast<size_t>(m_size.load(std::memory_order_relaxed)); }
+    [[nodiscard]] const EpochManager& Epochs() const { return m_epochs; }
+
+private:
+    struct Node {
+        int key;
+        int height;
+        // Inserter and deleter each drop one reference; the last one out unlinks and retires
+        std::atomic<int> handoff{2};
+        std::array<std::atomic<uintptr_t>, MAX_LEVEL> next;
+
+        Node(int k, int h) : key(k), height(h) {}
+    };
+
+    static constexpr uintptr_t MARK = 1;
+    static Node* Pointer(uintptr_t link) { return reinterpret_cast<Node*>(link & ~MARK); }
+    static bool IsMarked(uintptr_t link) { return (link & MARK) != 0; }
+    static uintptr_t Link(Node* node) { return reinterpret_cast<uintptr_t>(node); }
+    static void DeleteNode(void* node) { delete static_cast<Node*>(node); }
+
+    // Fills preds/succs around key at every level, unlinking marked nodes on the way.
+    // Returns whether an unmarked node with key is linked at level 0.
+    bool Find(int key, Node** preds, Node** succs);
+    void Release(Node* node, int slot);
+    int RandomLevel(int slot);
+
+    struct alignas(64) SlotState {
+        uint64_t rng = 0;
+    };
+
+    Node* m_head;
+    Node* m_tail;
+    std::atomic<long long> m_size{0};
+    std::array<SlotState, EpochManager::MAX_THREADS> m_slotState;
+    EpochManager m_epochs;
+};
+
+} // namespace AlgorithmVisualizer
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <istream>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <fmt/format.h>
+
+namespace AlgorithmVisualizer {
+
+// Patricia (path-compressed) trie over byte strings. Every edge carries a label
+// of one or more bytes, no two children of a node start with the same byte, and
+// an inner node that is not itself a key always has at least two children, so
+// the node count stays below twice the key count. Children are kept in one of
+// two representations, chosen per trie:
+//  - SortedArray: parallel arrays of first bytes and child pointers, the byte
+//                 array scanned with memchr; compact for the low fan-out of most nodes
+//  - Table256:    a direct 256-entry table per node; one indexed load per level,
+//                 at 2 KB a node
+// Keys may hold any byte, including NUL; the empty string is a valid key.
+class PatriciaTrie {
+public:
+    enum class ChildLayout : uint8_t {
+        SortedArray,
+        Table256
+    };
+
+    struct Node {
+        std::string edge;    // Label on the edge from the parent; empty only at the root
+        bool terminal = false; // A key ends at this node
+        ChildLayout layout;
+        uint16_t childCount = 0;
+        explicit Node(ChildLayout l) : layout(l) {}
+    };
+
+    struct ArrayNode : Node {
+        std::string bytes; // First byte of each child's edge, ascending; inline in the node up to 15 children
+        std::vector<Node*> children;
+        ArrayNode() : Node(ChildLayout::SortedArray) {}
+    };
+
+    struct TableNode : Node {
+        std::array<Node*, 256> children{};
+        TableNode() : Node(ChildLayout::Table256) {}
+    };
+
+    struct Stats {
+        uint64_t nodesVisited = 0;
+        uint64_t edgeSplits = 0; // An insert diverged inside an edge
+        uint64_t merges = 0;     // An erase left a node with one child, folded into it
+    };
+
+    using StepCallback = std::function<void(const std::string&)>;
+    using KeyVisitor = std::function<void(std::string_view)>;
+
+    explicit PatriciaTrie(ChildLayout layout = ChildLayout::SortedArray);
+    ~PatriciaTrie();
+
+    PatriciaTrie(const PatriciaTrie&) = delete;
+    PatriciaTrie& operator=(const PatriciaTrie&) = delete;
+
+    bool Insert(std::string_view key);
+    bool Erase(std::string_view key);
+    bool Contains(std::string_view key) const;
+    // Nodes a lookup passes through, root first; stops where the key leaves the trie
+    std::vector<const Node*> SearchPath(std::string_view key) const;
+
+    // Keys in byte order, stopping after limit results
+    std::vector<std::string> PrefixKeys(std::string_view prefix, size_t limit = SIZE_MAX) const;
+    std::vector<std::string> RangeKeys(std::string_view low, std::string_view high, size_t limit = SIZE_MAX) const; // Inclusive
+    void ForEach(const KeyVisitor& visit) const;
+    void ForEachWithPrefix(std::string_view prefix, const KeyVisitor& visit) const;
+    // Topmost node whose subtree holds exactly the keys starting with prefix, with the
+    // length of the path above its edge; nullptr if no key starts with prefix
+    std::pair<const Node*, size_t> FindPrefixNode(std::string_view prefix) const;
+
+    // One key per line; trailing '\r' is dropped and empty lines are skipped. Returns the number of new keys
+    size_t LoadWords(std::istream& input);
+    void Clear();
+
+    [[nodiscard]] ChildLayout Layout() const { return m_layout; }
+    [[nodiscard]] size_t Size() const { return m_size; }
+    [[nodiscard]] size_t NodeCount() const { return m_nodeCount; }
+    [[nodiscard]] int Height() const;
+    // Nodes, child arrays or tables, and edge labels that do not fit in the string's inline buffer
+    [[nodiscard]] size_t MemoryBytes() const;
+    [[nodiscard]] const Node* Root() const { return m_root; }
+    [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = Stats{}; }
+
+    void SetStepCallback(StepCallback callback) { m_stepCallback = std::move(callback); }
+
+    // Children in byte order
+    static void ForEachChild(const Node* node, const std::function<void(uint8_t, const Node*)>& visit);
+    static const char* LayoutName(ChildLayout layout);
+
+private:
+    Node* NewNode(std::string_view edge);
+    void DeleteNode(Node* node);
+    void FreeSubtree(Node* node);
+
+    static Node** FindChild(Node* node, uint8_t byte);
+    static const Node* FindChild(const Node* node, uint8_t byte);
+    static void AddChild(Node* node, Node* child);
+    static void RemoveChild(Node* node, uint8_t byte);
+    static Node* OnlyChild(Node* node);
+
+    // Depth-first walk in key order; visit returns false to stop. Returns false once stopped
+    template <typename Visit>
+    static bool Walk(const Node* node, std::string& key, Visit& visit);
+    template <typename Visit>
+    static bool WalkRange(const Node* node, std::string& key, std::string_view low, std::string_view high,
+                          Visit& visit);
+
+    template <typename... Args>
+    void EmitStep(fmt::format_string<Args...> format, Args&&... args) {
+        if (m_stepCallback) {
+            m_stepCallback(fmt::format(format, std::forward<Args>(args)...));
+        }
+    }
+
+    ChildLayout m_layout;
+    Node* m_root = nullptr;
+    size_t m_size = 0;
+    size_t m_nodeCount = 0;
+    mutable Stats m_stats;
+    StepCallback m_stepCallback;
+};
+
+} // namespace AlgorithmVisualizer
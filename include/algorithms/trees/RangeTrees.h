@@ -0,0 +1,114 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+
+namespace AlgorithmVisualizer {
+
+// Inclusive element range; every query and update requires 0 <= left <= right < Size()
+struct RangeQuery {
+    int left;
+    int right;
+};
+
+// Fenwick (binary indexed) tree supporting range add and range sum through the
+// two-tree form: prefix(i) = i * B1(i) - B2(i), where B1 holds the difference
+// array and B2 the difference weighted by position. Indices inside the tree are
+// 1-based; node i covers the elements (i - lowbit(i), i].
+class FenwickTree {
+public:
+    struct Stats {
+        uint64_t nodesTouched = 0;
+    };
+
+    // Nodes read by a range sum: prefix(right + 1) adds, prefix(left) subtracts
+    struct Trace {
+        std::vector<int> added;
+        std::vector<int> subtracted;
+    };
+
+    explicit FenwickTree(const std::vector<int64_t>& values = {});
+
+    void Assign(const std::vector<int64_t>& values); // O(n)
+    void RangeAdd(int left, int right, int64_t delta);
+    [[nodiscard]] int64_t RangeSum(int left, int right) const;
+    [[nodiscard]] std::vector<int64_t> SumBatch(const std::vector<RangeQuery>& queries) const;
+    [[nodiscard]] Trace TraceSum(int left, int right) const;
+
+    [[nodiscard]] int Size() const { return m_size; }
+    // Elements covered by a 1-based node, as a 0-based inclusive range
+    [[nodiscard]] static std::pair<int, int> NodeRange(int node) { return { node - (node & -node), node - 1 }; }
+    [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = Stats{}; }
+
+private:
+    void Update(int index, int64_t delta); // 1-based; index may be Size() + 1, which is a no-op
+    int64_t Prefix(int count) const;       // Sum of the first count elements
+
+    int m_size = 0;
+    std::vector<int64_t> m_diff;         // B1, 1-based
+    std::vector<int64_t> m_weightedDiff; // B2, 1-based
+    mutable Stats m_stats;
+};
+
+// Iterative bottom-up segment tree with lazy propagation (range add, range sum,
+// range min). Nodes are heap-indexed: the root is 1, node i has children 2i and
+// 2i + 1, and the leaves start at Leaves(), padded to a power of two. A pending
+// add lives on the highest nodes it fully covers; queries push the adds on the
+// two boundary paths down before combining, so no recursion is needed.
+class SegmentTree {
+public:
+    struct Stats {
+        uint64_t nodesTouched = 0; // Nodes combined or updated, excluding pushes
+        uint64_t pushes = 0;       // Lazy adds moved down to the children
+    };
+
+    // Nodes a query combines (the canonical cover) and the ancestors whose pending adds it pushes
+    struct Trace {
+        std::vector<int> cover;
+        std::vector<int> pushed;
+    };
+
+    explicit SegmentTree(const std::vector<int64_t>& values = {});
+
+    void Assign(const std::vector<int64_t>& values); // O(n)
+    void RangeAdd(int left, int right, int64_t delta);
+    int64_t RangeSum(int left, int right);
+    int64_t RangeMin(int left, int right);
+    // Pushes every pending add down once, then answers each query without touching the lazy tags
+    std::vector<int64_t> SumBatch(const std::vector<RangeQuery>& queries);
+    std::vector<int64_t> MinBatch(const std::vector<RangeQuery>& queries);
+    [[nodiscard]] Trace TraceQuery(int left, int right) const;
+
+    [[nodiscard]] int Size() const { return m_size; }
+    [[nodiscard]] int Leaves() const { return m_leaves; }
+    [[nodiscard]] int Height() const { return m_height; }
+    // Stored node contents; they exclude adds still pending on ancestors
+    [[nodiscard]] int64_t NodeSum(int node) const { return m_sum[node]; }
+    [[nodiscard]] int64_t NodeMin(int node) const { return m_min[node]; }
+    [[nodiscard]] int64_t NodeLazy(int node) const { return m_lazy[node]; }
+    [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = Stats{}; }
+
+private:
+    int64_t NodeLength(int node) const;
+    void Apply(int node, int64_t delta);
+    void Pull(int node); // Recompute ancestors of node from their children
+    void PushPath(int node); // Push pending adds on the root-to-node path
+    void PushAll();
+    template <typename Combine>
+    int64_t Query(int left, int right, const std::vector<int64_t>& values, int64_t identity, Combine combine,
+                  bool push);
+
+    int m_size = 0;
+    int m_leaves = 1;
+    int m_height = 0;
+    std::vector<int64_t> m_sum;
+    std::vector<int64_t> m_min;
+    std::vector<int64_t> m_lazy; // Pending add for the whole subtree, applied to this node already
+    Stats m_stats;
+};
+
+} // namespace AlgorithmVisualizer
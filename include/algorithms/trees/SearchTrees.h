@@ -0,0 +1,189 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace AlgorithmVisualizer {
+
+// Lightweight pointer-based search trees used as baselines by the tree benchmarks.
+// Unlike the TreeVisualizer node structures they record no steps, only counters.
+struct SearchTreeStats {
+    uint64_t comparisons = 0;
+    uint64_t rotations = 0;
+};
+
+class AVLTree {
+public:
+    AVLTree() = default;
+
+    bool Insert(int key);
+    bool Erase(int key);
+    bool Contains(int key) const;
+    std::vector<int> Keys() const; // In order
+    void Clear();
+
+    // Order statistics from the subtree sizes, O(log n) each
+    std::optional<int> Select(size_t rank) const; // rank-th smallest key, 0-based
+    size_t Rank(int key) const;                    // Keys less than key
+    size_t CountRange(int low, int high) const;    // Keys in [low, high]
+
+    [[nodiscard]] size_t Size() const { return m_size; }
+    [[nodiscard]] int Height() const;
+    [[nodiscard]] const SearchTreeStats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = SearchTreeStats{}; }
+
+private:
+    struct Node {
+        int key;
+        int height = 1;
+        size_t size = 1; // Keys in this subtree
+        std::unique_ptr<Node> left;
+        std::unique_ptr<Node> right;
+
+        explicit Node(int k) : key(k) {}
+    };
+    using NodePtr = std::unique_ptr<Node>;
+
+    NodePtr InsertAt(NodePtr node, int key, bool& inserted);
+    NodePtr EraseAt(NodePtr node, int key, bool& erased);
+    NodePtr Rebalance(NodePtr node);
+    NodePtr RotateLeft(NodePtr node);
+    NodePtr RotateRight(NodePtr node);
+    static int HeightOf(const Node* node) { return node ? node->height : 0; }
+    static void UpdateHeight(Node* node); // Height and subtree size from the children
+
+    NodePtr m_root;
+    size_t m_size = 0;
+    mutable SearchTreeStats m_stats;
+};
+
+// Left-leaning red-black tree (Sedgewick), the same variant the visualizer animates
+class RedBlackTree {
+public:
+    RedBlackTree() = default;
+
+    bool Insert(int key);
+    bool Erase(int key);
+    bool Contains(int key) const;
+    std::vector<int> Keys() const; // In order
+    void Clear();
+
+    // Order statistics from the subtree sizes, O(log n) each
+    std::optional<int> Select(size_t rank) const; // rank-th smallest key, 0-based
+    size_t Rank(int key) const;                    // Keys less than key
+    size_t CountRange(int low, int high) const;    // Keys in [low, high]
+
+    [[nodiscard]] size_t Size() const { return m_size; }
+    [[nodiscard]] int Height() const;
+    [[nodiscard]] const SearchTreeStats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = SearchTreeStats{}; }
+
+private:
+    struct Node {
+        int key;
+        bool red = true;
+        size_t size = 1; // Keys in this subtree
+        std::unique_ptr<Node> left;
+        std::unique_ptr<Node> right;
+
+        explicit Node(int k) : key(k) {}
+    };
+    using NodePtr = std::unique_ptr<Node>;
+
+    NodePtr InsertAt(NodePtr node, int key, bool& inserted);
+    NodePtr EraseAt(NodePtr node, int key);
+    NodePtr EraseMin(NodePtr node);
+    NodePtr RotateLeft(NodePtr node);
+    NodePtr RotateRight(NodePtr node);
+    NodePtr MoveRedLeft(NodePtr node);
+    NodePtr MoveRedRight(NodePtr node);
+    NodePtr Balance(NodePtr node);
+    static void FlipColors(Node* node);
+    static bool IsRed(const Node* node) { return node && node->red; }
+    static int HeightOf(const Node* node);
+    static void UpdateSize(Node* node);
+
+    NodePtr m_root;
+    size_t m_size = 0;
+    mutable SearchTreeStats m_stats;
+};
+
+// Top-down splay tree (Sleator-Tarjan). Every access splays the key (or its
+// neighbour) to the root, so Contains is not const. Nodes are raw pointers and
+// all traversals are iterative: sequential access can build an O(n) deep path.
+class SplayTree {
+public:
+    SplayTree() = default;
+    ~SplayTree();
+
+    SplayTree(const SplayTree&) = delete;
+    SplayTree& operator=(const SplayTree&) = delete;
+
+    bool Insert(int key);
+    bool Erase(int key);
+    bool Contains(int key);
+    void Clear();
+
+    [[nodiscard]] size_t Size() const { return m_size; }
+    [[nodiscard]] int Height() const;
+    [[nodiscard]] const SearchTreeStats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = SearchTreeStats{}; }
+
+private:
+    struct Node {
+        int key = 0;
+        Node* left = nullptr;
+        Node* right = nullptr;
+    };
+
+    Node* Splay(Node* root, int key);
+
+    Node* m_root = nullptr;
+    size_t m_size = 0;
+    SearchTreeStats m_stats;
+};
+
+// Treap: BST on keys, max-heap on random priorities, so the shape is that of a
+// random insertion order regardless of the actual order
+class Treap {
+public:
+    explicit Treap(unsigned int seed = 42) : m_rng(seed) {}
+
+    bool Insert(int key);
+    bool Erase(int key);
+    bool Contains(int key) const;
+    void Clear();
+
+    [[nodiscard]] size_t Size() const { return m_size; }
+    [[nodiscard]] int Height() const;
+    [[nodiscard]] const SearchTreeStats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = SearchTreeStats{}; }
+
+private:
+    struct Node {
+        int key;
+        uint32_t priority;
+        std::unique_ptr<Node> left;
+        std::unique_ptr<Node> right;
+
+        Node(int k, uint32_t p) : key(k), priority(p) {}
+    };
+    using NodePtr = std::unique_ptr<Node>;
+
+    NodePtr InsertAt(NodePtr node, int key, bool& inserted);
+    NodePtr EraseAt(NodePtr node, int key, bool& erased);
+    NodePtr RotateLeft(NodePtr node);
+    NodePtr RotateRight(NodePtr node);
+    static int HeightOf(const Node* node);
+
+    NodePtr m_root;
+    size_t m_size = 0;
+    std::mt19937 m_rng;
+    mutable SearchTreeStats m_stats;
+};
+
+} // namespace AlgorithmVisualizer
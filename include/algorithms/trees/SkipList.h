@@ -0,0 +1,77 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <random>
+#include <cstdint>
+#include <functional>
+#include <fmt/format.h>
+
+namespace AlgorithmVisualizer {
+
+// Sequential skip list over int keys. Each node has a tower of 1..MAX_LEVEL
+// forward pointers; tower heights are geometric with p = 1/2.
+class SkipList {
+public:
+    static constexpr int MAX_LEVEL = 16;
+
+    struct Node {
+        int key;
+        std::vector<Node*> next; // next[i] is the successor at level i; size() is the tower height
+
+        Node(int k, int height) : key(k), next(height, nullptr) {}
+    };
+
+    struct Stats {
+        uint64_t nodesVisited = 0;
+        uint64_t levelDrops = 0;
+    };
+
+    using StepCallback = std::function<void(const std::string&)>;
+
+    explicit SkipList(unsigned int seed = 42);
+    ~SkipList();
+
+    SkipList(const SkipList&) = delete;
+    SkipList& operator=(const SkipList&) = delete;
+
+    bool Insert(int key);
+    bool Erase(int key);
+    bool Contains(int key) const;
+    std::vector<int> Keys() const;
+    void Clear();
+
+    // Nodes whose towers a search for key passes through, head excluded
+    std::vector<const Node*> SearchPath(int key) const;
+
+    [[nodiscard]] size_t Size() const { return m_size; }
+    [[nodiscard]] int Level() const { return m_level; }
+    [[nodiscard]] const Node* Head() const { return m_head.get(); }
+    [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = Stats{}; }
+
+    // Step recording for the visualizer; formatting is skipped when no callback is set
+    void SetStepCallback(StepCallback callback) { m_stepCallback = std::move(callback); }
+
+private:
+    int RandomLevel();
+    // Fills update[i] with the last node at level i whose key is < key
+    Node* FindPredecessors(int key, Node* (&update)[MAX_LEVEL]);
+
+    template <typename... Args>
+    void EmitStep(fmt::format_string<Args...> format, Args&&... args) {
+        if (m_stepCallback) {
+            m_stepCallback(fmt::format(format, std::forward<Args>(args)...));
+        }
+    }
+
+    std::unique_ptr<Node> m_head;
+    int m_level = 1; // Number of levels in use
+    size_t m_size = 0;
+    std::mt19937 m_rng;
+    mutable Stats m_stats;
+    StepCallback m_stepCallback;
+};
+
+} // namespace AlgorithmVisualizer
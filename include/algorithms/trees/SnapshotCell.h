@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace AlgorithmVisualizer {
+
+// RCU-style publication point for immutable snapshots. A writer builds the next
+// version off to the side and swaps it in; readers take a counted reference and
+// may keep using it for as long as they like. The last holder of a superseded
+// version frees it, so reclamation needs no grace-period tracking.
+//
+// The mutex guards only the pointer copy, never the build or the read, so a
+// reader is never held up by a writer that is busy producing a snapshot.
+// (std::atomic<std::shared_ptr> does the same thing but is not available on
+// every standard library this project builds with.)
+template <typename T>
+class SnapshotCell {
+public:
+    SnapshotCell() = default;
+    explicit SnapshotCell(std::shared_ptr<const T> initial) : m_value(std::move(initial)) {}
+
+    SnapshotCell(const SnapshotCell&) = delete;
+    SnapshotCell& operator=(const SnapshotCell&) = delete;
+
+    [[nodiscard]] std::shared_ptr<const T> Load() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_value;
+    }
+
+    void Publish(std::shared_ptr<const T> value) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_value.swap(value);
+        }
+        // value now holds the previous version; if no reader has it, it is freed here, outside the lock
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    std::shared_ptr<const T> m_value;
+};
+
+} // namespace AlgorithmVisualizer
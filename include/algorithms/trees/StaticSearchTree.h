@@ -0,0 +1,70 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace AlgorithmVisualizer {
+
+// Read-only search tree frozen into one array. The keys form an implicit perfect
+// binary search tree (padded with INT_MAX up to 2^h - 1 slots); the layout only
+// decides where each tree node lives in the array:
+//  - Sorted:      in-order, i.e. a plain sorted array searched by bisection
+//  - Breadth:     level by level (Eytzinger), children of slot i at 2i + 1 and 2i + 2
+//  - VanEmdeBoas: the top half of the levels first, then every bottom subtree, each
+//                 laid out the same way recursively. Any root-to-leaf path touches
+//                 O(log_B n) blocks for every block size B, without knowing B.
+// vEB navigation follows Brodal, Fagerberg and Jacob: per-depth tables give each
+// node's slot from its breadth-first index and the slot of one ancestor on the path.
+class StaticSearchTree {
+public:
+    enum class Layout {
+        Sorted,
+        Breadth,
+        VanEmdeBoas
+    };
+
+    struct Stats {
+        uint64_t nodesVisited = 0;
+    };
+
+    StaticSearchTree(const std::vector<int>& sortedKeys, Layout layout);
+
+    bool Contains(int key) const;
+    // Slots visited by a search, root first
+    std::vector<int> SearchPath(int key) const;
+
+    [[nodiscard]] Layout GetLayout() const { return m_layout; }
+    [[nodiscard]] size_t Size() const { return m_size; }
+    [[nodiscard]] size_t SlotCount() const { return m_slots.size(); }
+    [[nodiscard]] int Height() const { return m_height; }
+    [[nodiscard]] int KeyAt(int slot) const { return m_slots[slot]; }
+    [[nodiscard]] bool IsPadding(int slot) const { return m_rankOfSlot[slot] >= static_cast<int>(m_size); }
+    [[nodiscard]] int DepthOfSlot(int slot) const { return m_depthOfSlot[slot]; }
+    [[nodiscard]] size_t MemoryBytes() const { return m_slots.size() * sizeof(int); }
+    [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = Stats{}; }
+
+    static const char* LayoutName(Layout layout);
+
+private:
+    void BuildVanEmdeBoasTables(int topDepth, int height);
+    int SlotOfNode(int node) const; // node is a 1-based breadth-first index
+
+    Layout m_layout;
+    size_t m_size = 0;
+    int m_height = 0;
+    bool m_hasMaxKey = false; // INT_MAX is also the padding value
+    std::vector<int> m_slots;
+    std::vector<int> m_rankOfSlot;  // In-order rank, for telling real keys from padding
+    std::vector<int> m_depthOfSlot;
+
+    // vEB tables per depth d >= 1: d roots the bottom subtrees of a split whose top
+    // subtree is rooted at depth m_topDepth[d] and holds m_topSize[d] nodes
+    std::vector<int> m_topSize;
+    std::vector<int> m_bottomSize;
+    std::vector<int> m_topDepth;
+    mutable Stats m_stats;
+};
+
+} // namespace AlgorithmVisualizer
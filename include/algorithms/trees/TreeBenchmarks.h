@@ -0,0 +1,127 @@
+#pragma once
+
+#include <vector>
+#include <string>
+
+namespace AlgorithmVisualizer {
+
+// Tabular result of an in-app benchmark, rendered by TreeVisualizer as an ImGui table
+struct BenchmarkReport {
+    std::string title;
+    std::vector<std::string> columns;
+    std::vector<std::vector<std::string>> rows;
+    std::vector<std::string> notes;
+    double totalMilliseconds = 0.0;
+    long long totalOperations = 0;
+};
+
+struct BTreeBenchmarkConfig {
+    int keyCount = 100000;
+    int lookupCount = 200000;
+    std::vector<int> orders = {4, 8, 16, 32, 64, 128, 256};
+    unsigned int seed = 42;
+};
+
+// Same random workload (insert all, look up, range scan, erase half) on B-trees and
+// B+trees of every configured order and on the AVL / red-black baselines
+BenchmarkReport RunBTreeBenchmark(const BTreeBenchmarkConfig& config);
+
+struct HeapBenchmarkConfig {
+    int vertexCount = 100000;
+    int sparseDegree = 4;
+    int denseDegree = 32;
+    unsigned int seed = 42;
+};
+
+// Dijkstra on random sparse and dense graphs (push / pop / decrease-key mix) plus a
+// push-all/pop-all run, for every priority queue and a lazy std::priority_queue baseline
+BenchmarkReport RunHeapBenchmark(const HeapBenchmarkConfig& config);
+
+struct AccessPatternBenchmarkConfig {
+    int keyCount = 100000;
+    int accessCount = 500000;
+    double zipfExponent = 1.0;
+    int workingSetSize = 1000;
+    int workingSetPhase = 50000; // Accesses before the working set moves
+    int updateEvery = 10;        // Every Nth access erases and re-inserts its key
+    unsigned int seed = 42;
+};
+
+// Replays uniform, Zipf, sequential and shifting working-set access streams on
+// AVL, red-black, splay and treap trees; reports per-operation comparisons and rotations
+BenchmarkReport RunAccessPatternBenchmark(const AccessPatternBenchmarkConfig& config);
+
+struct ConcurrentSetBenchmarkConfig {
+    std::vector<int> threadCounts = {1, 2, 4, 8};
+    int operationsPerThread = 200000;
+    int keyRange = 100000;
+    int insertPercent = 20;
+    int erasePercent = 20; // The rest are lookups
+    unsigned int seed = 42;
+};
+
+// Mixed insert/erase/lookup from N threads on the lock-free skip list and on a
+// mutex-protected AVL tree (both prefilled to half the key range), plus the
+// sequential skip list on one thread for reference
+BenchmarkReport RunConcurrentSetBenchmark(const ConcurrentSetBenchmarkConfig& config);
+
+struct RadixTreeBenchmarkConfig {
+    int keyCount = 100000;
+    int lookupCount = 200000;
+    int bplusOrder = 64;
+    unsigned int seed = 42;
+};
+
+// Inserts, point lookups, range scans and a full ordered scan on the adaptive radix
+// tree, a B+tree and the AVL / red-black baselines, over dense and sparse int keys;
+// ART and std::set are also compared on string keys
+BenchmarkReport RunRadixTreeBenchmark(const RadixTreeBenchmarkConfig& config);
+
+struct RangeQueryBenchmarkConfig {
+    int elementCount = 100000;
+    int updateCount = 100000;
+    int queryCount = 1000000;
+    int naiveQueryCount = 2000;
+    unsigned int seed = 42;
+};
+
+// Random range adds followed by range sum / min queries, one at a time and as a
+// batch, on the Fenwick and lazy segment trees; a plain array scan is the baseline
+BenchmarkReport RunRangeQueryBenchmark(const RangeQueryBenchmarkConfig& config);
+
+struct OrderStatisticBenchmarkConfig {
+    int keyCount = 100000;
+    int queryCount = 200000;
+    int naiveQueryCount = 100;
+    unsigned int seed = 42;
+};
+
+// Select, rank and count-in-range on the size-augmented AVL / red-black trees,
+// against answering the same queries from a fresh in-order traversal
+BenchmarkReport RunOrderStatisticBenchmark(const OrderStatisticBenchmarkConfig& config);
+
+struct StaticLayoutBenchmarkConfig {
+    int minKeyCount = 1 << 10;
+    int maxKeyCount = 1 << 24;    // 64 MB of keys, well past the last-level cache of current desktop CPUs
+    int maxAvlKeyCount = 1 << 22; // The pointer tree costs about 48 bytes a key; larger sizes skip it
+    int lookupCount = 1000000;
+    unsigned int seed = 42;
+};
+
+// Random lookups on a pointer-based AVL tree and on frozen sorted, breadth-first
+// and van Emde Boas layouts, at key counts from L1-sized up to beyond the last-level cache
+BenchmarkReport RunStaticLayoutBenchmark(const StaticLayoutBenchmarkConfig& config);
+
+struct StringTrieBenchmarkConfig {
+    int keyCount = 200000; // Synthetic words, used when no dictionary is given or it cannot be read
+    int lookupCount = 1000000;
+    int prefixQueryCount = 2000;
+    std::string dictionaryPath; // One word per line
+    unsigned int seed = 42;
+};
+
+// Memory per key, lookups and prefix scans on Patricia tries with both child
+// layouts against a sorted vector<string> and an unordered_set<string>
+BenchmarkReport RunStringTrieBenchmark(const StringTrieBenchmarkConfig& config);
+
+} // namespace AlgorithmVisualizer
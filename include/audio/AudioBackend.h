@@ -0,0 +1,32 @@
+#pragma once
+
+#include "audio/SoftwareMixer.h"
+#include <vector>
+
+namespace AlgorithmVisualizer {
+
+// Where AudioManager's sounds end up. The manager synthesizes clips once and
+// loads them into the backend, then hands it the voices left after coalescing,
+// one frame at a time:
+//   Open -> LoadClip... -> Start -> { Play... Advance }* -> Close
+// Play and Advance come from the thread that drives AudioManager::Update.
+class AudioBackend {
+public:
+    virtual ~AudioBackend() = default;
+
+    virtual bool Open(int sampleRate) = 0;
+    // False if output was lost on the way, such as a file that could not be written
+    virtual bool Close() = 0;
+    virtual void LoadClip(SoftwareMixer::ClipId clip, const std::vector<short>& samples) = 0;
+    // Clips are all loaded; begin playback
+    virtual bool Start() = 0;
+
+    virtual void Play(const SoftwareMixer::Event& event) = 0;
+    virtual void StopAll() = 0;
+    // Called once per frame with the audio time that passed; offline backends render it here
+    virtual void Advance(double elapsedSeconds) = 0;
+
+    [[nodiscard]] virtual const char* GetName() const = 0;
+};
+
+} // namespace AlgorithmVisualizer
@@ -1,19 +1,57 @@
 #pragma once
 
+#include "audio/AudioBackend.h"
+#include "audio/EventCoalescer.h"
+#include "audio/SoftwareMixer.h"
+#include "audio/SpscQueue.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <thread>
 #include <vector>
-#include <AL/al.h>
-#include <AL/alc.h>
 
 namespace AlgorithmVisualizer {
 
+// Front end for all sound. Clips are synthesized once at startup and loaded into
+// an AudioBackend: OpenAL for the speakers, Null to run the audio path without a
+// device, or WavFile to render a run into a file. If no OpenAL device can be
+// opened, Initialize falls back to Null rather than failing.
+//
+// Play* calls only push a small command onto a lock-free queue and never block.
+// Commands are drained in windows: each window's events are merged (see
+// EventCoalescer) and the result is handed to the backend, at most
+// GetMaxEventsPerSecond voices a second, so fast playback speeds do not turn into
+// thousands of sounds.
+//  - OpenAL: an audio thread owned by the manager drains the queue every
+//    WORKER_PERIOD and makes every backend (and so every AL) call; Update does
+//    nothing.
+//  - Null / WavFile: nothing runs in the background; Update or Advance drains
+//    on the caller's thread, so offline renders are deterministic.
+// The queue has one producer: Play*, SetEnabled and SetMaxEventsPerSecond must
+// all be called from the same thread (the UI thread).
 class AudioManager {
 public:
+    enum class BackendType {
+        OpenAL,
+        Null,
+        WavFile
+    };
+
+    // Classic: sines; Retro: square, saw and FM chip-synth voices
+    enum class SoundStyle {
+        Classic,
+        Retro
+    };
+
     AudioManager();
     ~AudioManager();
 
-    bool Initialize();
-    void Shutdown();
+    // outputPath is the file to write for WavFile and ignored otherwise
+    bool Initialize(BackendType backend = BackendType::OpenAL, const std::string& outputPath = {});
+    // False if the backend lost output, such as a WAV file that could not be written in full
+    bool Shutdown();
     
     // Sound generation and playback
     void PlayComparisonSound(float pitch = 1.0f);
@@ -33,18 +71,46 @@ public:
     void PlayEdgeAddSound();
     void PlayMSTCompleteSound();
     
-    // Tone generation for values
-    void PlayValueTone(int value, int maxValue, float duration = 0.1f);
+    // Tone for a value in [0, maxValue], played from the pre-built tone bank
+    // (pitch quantized to TONE_BANK_SIZE steps, fixed TONE_DURATION length)
+    void PlayValueTone(int value, int maxValue);
     
     // Volume and settings
     void SetMasterVolume(float volume); // 0.0f to 1.0f
     void SetEnabled(bool enabled);
+    void SetSoundStyle(SoundStyle style); // From the next sound on; nothing is reloaded
     
     [[nodiscard]] bool IsEnabled() const { return m_enabled; }
     [[nodiscard]] float GetMasterVolume() const { return m_masterVolume; }
-    
-    // Update (call this regularly to clean up finished sounds)
+    [[nodiscard]] SoundStyle GetSoundStyle() const { return m_soundStyle; }
+    
+    [[nodiscard]] BackendType GetBackendType() const { return m_backendType; }
+    
+    // Voices per second after merging; 0 for no cap
+    void SetMaxEventsPerSecond(float rate);
+    [[nodiscard]] float GetMaxEventsPerSecond() const { return m_maxEventsPerSecond; }
+    
+    // Monitoring; safe from any thread
+    struct QueueStats {
+        size_t depth = 0;        // Commands waiting to be drained
+        size_t capacity = 0;
+        uint64_t dropped = 0;    // Queue was full; the command was discarded
+        uint64_t processed = 0;
+    };
+    [[nodiscard]] QueueStats GetQueueStats() const;
+    [[nodiscard]] EventCoalescer::Stats GetCoalescerStats() const;
+    // Sounds the OpenAL device lost; all zero for the offline backends
+    struct DeviceStats {
+        bool streaming = false;        // Mixed into one stream rather than a source per voice
+        uint64_t streamUnderruns = 0;  // The stream ran dry and had to be restarted
+        uint64_t sourcesExhausted = 0; // Every source was still playing; the sound was dropped
+    };
+    [[nodiscard]] DeviceStats GetDeviceStats() const;
+    
+    // Update (call once per frame: for offline backends, plays the frame's merged sounds, timed by the wall clock)
     void Update();
+    // Same, but advances an offline backend by a fixed amount of audio time; ignored while the audio thread runs
+    void Advance(double seconds);
 
     // Pathfinding audio
     void PlayPathfindingExplore();
@@ -71,38 +137,92 @@ public:
     void PlayTreeComparison();
 
 private:
-    // OpenAL context
-    ALCdevice* m_device = nullptr;
-    ALCcontext* m_context = nullptr;
-    
-    // Sound buffers and sources
-    ALuint m_comparisonBuffer = 0;
-    ALuint m_swapBuffer = 0;
-    ALuint m_completionBuffer = 0;
-    ALuint m_errorBuffer = 0;
-    
-    std::vector<ALuint> m_sources;
-    static constexpr size_t MAX_SOURCES = 32;
+    // Clip ids within one style's set; value tones follow FIRST_TONE_CLIP
+    enum Clip : SoftwareMixer::ClipId {
+        CLIP_COMPARISON,
+        CLIP_SWAP,
+        CLIP_COMPLETION,
+        CLIP_ERROR,
+        FIRST_TONE_CLIP
+    };
+    
+    // Value tones, built once in Initialize so playing one never allocates
+    static constexpr int TONE_BANK_SIZE = 128;
+    static constexpr float TONE_MIN_FREQUENCY = 200.0f;
+    static constexpr float TONE_MAX_FREQUENCY = 1000.0f;
+    static constexpr float TONE_DURATION = 0.1f;
+    static constexpr int SAMPLE_RATE = 44100;
+    
+    // Each style's set is loaded into the backend CLIPS_PER_STYLE ids after the previous one
+    static constexpr int CLIPS_PER_STYLE = FIRST_TONE_CLIP + TONE_BANK_SIZE;
+    static constexpr int STYLE_COUNT = 2;
+    static_assert(CLIPS_PER_STYLE * STYLE_COUNT <= SoftwareMixer::STOP_ALL, "clip ids would reach STOP_ALL");
+    
+    std::unique_ptr<AudioBackend> m_backend;
+    BackendType m_backendType = BackendType::Null;
+    
+    // Coalescing families, in priority order for the rate limit: rare outcome sounds first
+    enum Family : size_t {
+        FAMILY_COMPLETION,
+        FAMILY_ERROR,
+        FAMILY_SWAP,
+        FAMILY_COMPARISON,
+        FAMILY_TONE,
+        FAMILY_COUNT
+    };
+    EventCoalescer m_coalescer{FAMILY_COUNT};
+    std::chrono::steady_clock::time_point m_lastFlush{};
+    
+    // Commands from the UI thread; plain data so the queue can copy them around
+    struct Command {
+        enum class Kind : uint8_t {
+            Play,
+            StopAll,
+            SetRate
+        };
+        Kind kind = Kind::Play;
+        SoftwareMixer::Event event; // Play; SetRate carries the rate in event.gain
+    };
+    static constexpr size_t COMMAND_QUEUE_SIZE = 4096;
+    static constexpr std::chrono::milliseconds WORKER_PERIOD{16}; // One coalescing window, about a frame
+    SpscQueue<Command, COMMAND_QUEUE_SIZE> m_commands;
+    std::atomic<uint64_t> m_droppedCommands{0};
+    std::atomic<uint64_t> m_processedCommands{0};
+    
+    // Audio thread
+    std::thread m_worker;
+    std::atomic<bool> m_workerRunning{false};
+    
+    // Coalescer counters, copied out after every window for GetCoalescerStats
+    std::atomic<uint64_t> m_statsReceived{0};
+    std::atomic<uint64_t> m_statsPlayed{0};
+    std::atomic<uint64_t> m_statsMerged{0};
+    std::atomic<uint64_t> m_statsRateLimited{0};
+    // Device counters, copied out the same way since only the audio thread may touch the backend
+    std::atomic<bool> m_statsStreaming{false};
+    std::atomic<uint64_t> m_statsUnderruns{0};
+    std::atomic<uint64_t> m_statsSourcesExhausted{0};
     
     // Settings
     float m_masterVolume = 0.5f;
+    float m_maxEventsPerSecond = 120.0f;
+    SoundStyle m_soundStyle = SoundStyle::Classic;
     bool m_enabled = true;
     bool m_initialized = false;
     
     // Helper methods
-    ALuint GetAvailableSource();
-    void GenerateToneBuffer(ALuint buffer, float frequency, float duration, float amplitude = 0.3f);
-    void GenerateBeepBuffer(ALuint buffer, float frequency, float duration);
-    void GenerateClickBuffer(ALuint buffer);
-    void GenerateSuccessBuffer(ALuint buffer);
-    
-    // Cleanup
-    void CleanupBuffers();
-    void CleanupSources();
-    
-    // Error checking
-    bool CheckALError(const char* operation);
-    bool CheckALCError(const char* operation);
+    void Play(SoftwareMixer::ClipId clip, float pitch, float gain);
+    void Submit(const Command& command);
+    // Drains the queue, closes the coalescing window and advances the backend
+    void Pump(double seconds);
+    void WorkerLoop();
+    static SoftwareMixer::ClipId StyleClip(SoundStyle style, int clip);
+    static std::vector<short> GenerateTone(SoundStyle style, float frequency, float duration, float amplitude = 0.3f);
+    static std::vector<short> GenerateBeep(SoundStyle style, float frequency, float duration);
+    static std::vector<short> GenerateClick(SoundStyle style);
+    static std::vector<short> GenerateSuccess(SoundStyle style);
+    void LoadClips();
+    static std::unique_ptr<AudioBackend> CreateBackend(BackendType type, const std::string& outputPath);
 };
 
 } // namespace AlgorithmVisualizer 
\ No newline at end of file
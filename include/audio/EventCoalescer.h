@@ -0,0 +1,58 @@
+#pragma once
+
+#include "audio/SoftwareMixer.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace AlgorithmVisualizer {
+
+// Merges the sound events of one window (a frame) before they are played. Events
+// are grouped into families; however many arrive in a family, at most CHORD_SIZE
+// voices come out: the lowest and highest by the caller's key (pitch, say) and the
+// most recent, so a burst is heard as a chord spanning what happened. Gain grows
+// with the log of the event count, so density is audible without getting loud.
+// A token bucket then caps the voices per second, spending tokens on families in
+// index order, so lower-numbered families get priority.
+class EventCoalescer {
+public:
+    using Event = SoftwareMixer::Event;
+    static constexpr size_t CHORD_SIZE = 3;
+
+    struct Stats {
+        uint64_t received = 0;
+        uint64_t played = 0;
+        uint64_t merged = 0;      // Folded into another voice of the same window
+        uint64_t rateLimited = 0; // Would have played, but the budget was spent
+    };
+
+    explicit EventCoalescer(size_t familyCount);
+
+    void Add(size_t family, const Event& event, float key);
+    // Closes the window and returns the voices to play; valid until the next call
+    const std::vector<Event>& Flush(double elapsedSeconds);
+    void Clear();
+
+    // 0 lifts the cap
+    void SetMaxEventsPerSecond(float rate);
+    [[nodiscard]] float GetMaxEventsPerSecond() const { return m_maxEventsPerSecond; }
+    [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+
+private:
+    struct Window {
+        uint32_t count = 0;
+        Event lowest;
+        Event highest;
+        Event latest;
+        float lowestKey = 0.0f;
+        float highestKey = 0.0f;
+    };
+
+    std::vector<Window> m_windows;
+    std::vector<Event> m_output;
+    float m_maxEventsPerSecond = 120.0f;
+    double m_tokens = 0.0;
+    Stats m_stats;
+};
+
+} // namespace AlgorithmVisualizer
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "audio/AudioBackend.h"
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace AlgorithmVisualizer {
+
+// Backends without a device: the mixer is rendered on the calling thread, as
+// many frames as Advance says have passed, so a run can be rendered at any speed
+// and always comes out the same. Subclasses decide what happens to each block.
+class MixerBackend : public AudioBackend {
+public:
+    bool Open(int sampleRate) override;
+    bool Close() override;
+    void LoadClip(SoftwareMixer::ClipId clip, const std::vector<short>& samples) override;
+    bool Start() override { return m_mixer != nullptr; }
+
+    void Play(const SoftwareMixer::Event& event) override;
+    void StopAll() override;
+    void Advance(double elapsedSeconds) override;
+
+    [[nodiscard]] uint64_t FramesRendered() const { return m_framesRendered; }
+    [[nodiscard]] SoftwareMixer::Stats GetMixerStats() const;
+
+protected:
+    virtual void WriteBlock(const short* samples, size_t frames) = 0;
+
+    std::unique_ptr<SoftwareMixer> m_mixer;
+
+private:
+    static constexpr size_t BLOCK_FRAMES = 1024;
+    std::array<short, BLOCK_FRAMES> m_block{};
+    double m_pendingFrames = 0.0; // Fractional frames carried between Advance calls
+    uint64_t m_framesRendered = 0;
+};
+
+// Mixes and throws the result away: the audio path runs in full without hardware
+class NullBackend : public MixerBackend {
+public:
+    [[nodiscard]] const char* GetName() const override { return "Null"; }
+
+protected:
+    void WriteBlock(const short*, size_t) override {}
+};
+
+// Writes the mix to a 16-bit mono PCM WAV file; the header sizes are filled in on Close,
+// which also reports whether every block and the header made it to disk
+class WavFileBackend : public MixerBackend {
+public:
+    explicit WavFileBackend(std::string path) : m_path(std::move(path)) {}
+    ~WavFileBackend() override;
+
+    bool Open(int sampleRate) override;
+    bool Close() override;
+    [[nodiscard]] const char* GetName() const override { return "WAV file"; }
+    [[nodiscard]] const std::string& GetPath() const { return m_path; }
+
+protected:
+    void WriteBlock(const short* samples, size_t frames) override;
+
+private:
+    void WriteHeader(uint32_t dataBytes);
+
+    std::string m_path;
+    std::ofstream m_file;
+    int m_sampleRate = 0;
+    uint64_t m_dataBytes = 0;
+};
+
+} // namespace AlgorithmVisualizer
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "audio/AudioBackend.h"
+#include "audio/SourcePool.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <AL/al.h>
+#include <AL/alc.h>
+
+namespace AlgorithmVisualizer {
+
+// Plays through the default OpenAL device, on one of two paths:
+//  - Mixer:   voices are posted to a SoftwareMixer; a stream thread renders the
+//             mix and keeps one streaming AL source fed. The calling thread never
+//             enters the AL driver, and polyphony is not tied to sources.
+//  - Sources: each voice is started on its own AL source from a pool of
+//             MAX_SOURCES, and dropped when all of them are busy. Used if the
+//             stream cannot be set up.
+class OpenALBackend : public AudioBackend {
+public:
+    enum class PlaybackPath {
+        Mixer,
+        Sources
+    };
+
+    struct StreamStats {
+        SoftwareMixer::Stats mixer;
+        uint64_t underruns = 0; // The stream source ran dry and had to be restarted
+        size_t pendingEvents = 0;
+    };
+
+    OpenALBackend() = default;
+    ~OpenALBackend() override;
+
+    bool Open(int sampleRate) override;
+    bool Close() override;
+    void LoadClip(SoftwareMixer::ClipId clip, const std::vector<short>& samples) override;
+    bool Start() override;
+
+    void Play(const SoftwareMixer::Event& event) override;
+    void StopAll() override;
+    void Advance(double elapsedSeconds) override;
+
+    [[nodiscard]] const char* GetName() const override { return "OpenAL"; }
+
+    // Falls back to Sources if the stream fails to start; returns the path in use
+    PlaybackPath SetPlaybackPath(PlaybackPath path);
+    [[nodiscard]] PlaybackPath GetPlaybackPath() const { return m_playbackPath; }
+    [[nodiscard]] StreamStats GetStreamStats() const;
+    [[nodiscard]] const SourcePool::Stats& GetSourcePoolStats() const { return m_sourcePool.GetStats(); }
+
+private:
+    // OpenAL context
+    ALCdevice* m_device = nullptr;
+    ALCcontext* m_context = nullptr;
+    int m_sampleRate = 0;
+    
+    // Clip buffers and sources
+    std::vector<ALuint> m_buffers;     // Indexed by clip id
+    std::vector<float> m_clipSeconds;  // Length at pitch 1, for booking sources
+    std::vector<ALuint> m_sources;
+    SourcePool m_sourcePool;
+    static constexpr size_t MAX_SOURCES = 32;
+    
+    // Mixer stream: STREAM_BUFFER_COUNT blocks of STREAM_BLOCK_FRAMES queued on one
+    // source (about 46 ms in flight at 44.1 kHz), topped up by m_streamThread
+    static constexpr int STREAM_BUFFER_COUNT = 4;
+    static constexpr int STREAM_BLOCK_FRAMES = 512;
+    std::unique_ptr<SoftwareMixer> m_mixer;
+    ALuint m_streamSource = 0;
+    std::array<ALuint, STREAM_BUFFER_COUNT> m_streamBuffers{};
+    std::thread m_streamThread;
+    std::atomic<bool> m_streamRunning{false};
+    std::atomic<uint64_t> m_streamUnderruns{0};
+    PlaybackPath m_playbackPath = PlaybackPath::Sources;
+    
+    bool StartStream();
+    void StopStream();
+    void StreamLoop();
+    void FillStreamBuffer(ALuint buffer, std::array<short, STREAM_BLOCK_FRAMES>& block);
+    
+    // Cleanup
+    void CleanupBuffers();
+    void CleanupSources();
+    void CleanupStream();
+    
+    // Error checking
+    bool CheckALError(const char* operation);
+};
+
+} // namespace AlgorithmVisualizer
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "audio/SpscQueue.h"
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace AlgorithmVisualizer {
+
+// Mixes short one-shot sounds into a single mono 16-bit stream. Clips are
+// registered up front as PCM; a play event starts a voice that reads its clip at
+// a given rate (pitch) and gain, with linear interpolation when the rate is not 1.
+// Events come in through an SPSC queue, so one thread posts and another renders,
+// and neither ever waits on the other. Polyphony is bounded only by MAX_VOICES;
+// past that the voice closest to its end is cut short rather than dropping the
+// new event.
+class SoftwareMixer {
+public:
+    using ClipId = uint16_t;
+    static constexpr ClipId STOP_ALL = 0xFFFF; // Event that silences every voice
+    static constexpr size_t MAX_VOICES = 256;
+    static constexpr size_t EVENT_QUEUE_SIZE = 1024;
+
+    struct Event {
+        ClipId clip = 0;
+        float pitch = 1.0f;
+        float gain = 1.0f;
+    };
+
+    struct Stats {
+        uint64_t eventsPlayed = 0;
+        uint64_t eventsDropped = 0; // Queue was full when posted
+        uint64_t voicesStolen = 0;
+        uint64_t blocksRendered = 0;
+        uint32_t activeVoices = 0;
+        uint32_t peakVoices = 0;
+    };
+
+    explicit SoftwareMixer(int sampleRate);
+
+    SoftwareMixer(const SoftwareMixer&) = delete;
+    SoftwareMixer& operator=(const SoftwareMixer&) = delete;
+
+    // Registration is not synchronized with Render; do it before rendering starts
+    void SetClip(ClipId clip, const std::vector<short>& samples);
+
+    // Producer thread; false (and counted) if the queue is full
+    bool Post(const Event& event);
+
+    // Consumer thread: applies pending events, then mixes the next frames
+    void Render(short* output, size_t frames);
+
+    // Any thread; counters are read individually, so the set is only roughly consistent
+    [[nodiscard]] Stats GetStats() const;
+    [[nodiscard]] size_t PendingEvents() const { return m_events.SizeApprox(); }
+    [[nodiscard]] int SampleRate() const { return m_sampleRate; }
+
+private:
+    struct Voice {
+        const std::vector<float>* samples;
+        double position;
+        double step;
+        float gain;
+    };
+
+    void Start(const Event& event);
+    // Adds one voice into m_mix; false once it has run off the end of its clip
+    bool MixVoice(Voice& voice, size_t frames);
+
+    int m_sampleRate;
+    std::vector<std::vector<float>> m_clips;
+    std::vector<Voice> m_voices; // Active voices only, in no particular order
+    std::vector<float> m_mix;
+    SpscQueue<Event, EVENT_QUEUE_SIZE> m_events;
+
+    std::atomic<uint64_t> m_eventsPlayed{0};
+    std::atomic<uint64_t> m_eventsDropped{0};
+    std::atomic<uint64_t> m_voicesStolen{0};
+    std::atomic<uint64_t> m_blocksRendered{0};
+    std::atomic<uint32_t> m_activeVoices{0};
+    std::atomic<uint32_t> m_peakVoices{0};
+};
+
+} // namespace AlgorithmVisualizer
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include <AL/al.h>
+
+namespace AlgorithmVisualizer {
+
+// Hands out AL sources for one-shot sounds without polling them. Every acquired
+// source is filed under the time its sound is known to end (clip length / pitch,
+// plus a margin for device latency); once that time passes it goes back on the
+// free list. AL is only asked about a source when the free list is empty, in case
+// the earliest-ending one finished early (e.g. was stopped). Acquire is O(log n)
+// in the sources in flight, and a frame with nothing due costs one comparison.
+class SourcePool {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Stats {
+        uint64_t acquired = 0;
+        uint64_t reclaimedByTime = 0;
+        uint64_t reclaimedByQuery = 0; // Found stopped by the AL fallback check
+        uint64_t exhausted = 0;        // Every source still playing; the sound was dropped
+    };
+
+    // Takes over the given sources, all free
+    void Reset(const std::vector<ALuint>& sources);
+    void Clear();
+
+    // A free source, booked until now + duration; 0 if every source is still playing
+    ALuint Acquire(Clock::time_point now, Clock::duration duration);
+    // Frees the sources whose sounds are over
+    void ReclaimExpired(Clock::time_point now);
+    // After the caller stopped every source
+    void ReleaseAll();
+
+    [[nodiscard]] size_t FreeCount() const { return m_free.size(); }
+    [[nodiscard]] size_t BusyCount() const { return m_busy.size(); }
+    [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+
+private:
+    struct Booking {
+        Clock::time_point end;
+        ALuint source;
+        bool operator>(const Booking& other) const { return end > other.end; }
+    };
+
+    void PopEarliest();
+
+    std::vector<ALuint> m_free;
+    std::vector<Booking> m_busy; // Min-heap on end time
+    Stats m_stats;
+};
+
+} // namespace AlgorithmVisualizer
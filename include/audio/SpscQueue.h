@@ -0,0 +1,72 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace AlgorithmVisualizer {
+
+// Bounded lock-free ring for exactly one producer thread and one consumer thread.
+// Head and tail are free-running counters on separate cache lines; each side also
+// keeps a private copy of the other side's counter and only reloads it when the
+// ring looks full (producer) or empty (consumer), so the common case touches no
+// shared line but its own. Neither side ever blocks or allocates.
+template <typename T, size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "Items are copied in and out by value");
+
+public:
+    SpscQueue() = default;
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Producer side; false if the ring is full
+    bool TryPush(const T& item) {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cachedHead == Capacity) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail - m_cachedHead == Capacity) {
+                return false;
+            }
+        }
+        m_items[tail & MASK] = item;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side; false if the ring is empty
+    bool TryPop(T& item) {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_cachedTail) {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head == m_cachedTail) {
+                return false;
+            }
+        }
+        item = m_items[head & MASK];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Safe from any thread, but only a snapshot
+    [[nodiscard]] size_t SizeApprox() const {
+        const size_t head = m_head.load(std::memory_order_acquire);
+        const size_t tail = m_tail.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    static constexpr size_t CAPACITY = Capacity;
+
+private:
+    static constexpr size_t MASK = Capacity - 1;
+
+    alignas(64) std::atomic<size_t> m_head{0}; // Written by the consumer
+    size_t m_cachedTail = 0;                   // Consumer's last view of m_tail
+    alignas(64) std::atomic<size_t> m_tail{0}; // Written by the producer
+    size_t m_cachedHead = 0;                   // Producer's last view of m_head
+    alignas(64) std::array<T, Capacity> m_items{};
+};
+
+} // namespace AlgorithmVisualizer
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+namespace AlgorithmVisualizer {
+
+// Oscillators and envelopes for building sound clips, on float buffers in [-1, 1].
+// No loop calls into libm per sample:
+//  - Sine runs LANES rotating phasors side by side (each advanced by LANES steps
+//    at a time with one complex multiply), so the lanes are independent and the
+//    loop vectorizes.
+//  - Square, saw and triangle come from a phase accumulator, reset every block so
+//    the phase stays exact in single precision. They are not band-limited,
+//    which suits the chiptune sound they are used for.
+//  - FM uses a polynomial sine (max error about 0.001) for the same reason.
+//  - Envelopes are split into straight-line loops with no per-sample branches;
+//    exponential decay is a per-lane running product.
+class Synth {
+public:
+    enum class Waveform {
+        Sine,
+        Square,
+        Saw,
+        Triangle
+    };
+
+    // Adds amplitude * waveform(frequency) to out
+    static void AddOscillator(std::span<float> out, Waveform waveform, float frequency, float amplitude,
+                              int sampleRate);
+    // Two-operator FM: sin(carrier + index * sin(ratio * carrier)), added to out
+    static void AddFM(std::span<float> out, float frequency, float ratio, float index, float amplitude,
+                      int sampleRate);
+
+    // Linear ramps over the first and last fadeFraction of the buffer
+    static void ApplyFades(std::span<float> out, float fadeFraction);
+    // Multiplies by exp(-rate * t)
+    static void ApplyDecay(std::span<float> out, float rate, int sampleRate);
+
+    static std::vector<short> ToPcm16(std::span<const float> samples);
+
+private:
+    static constexpr size_t LANES = 8;
+};
+
+} // namespace AlgorithmVisualizer
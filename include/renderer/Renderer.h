@@ -1,15 +1,114 @@
 #pragma once
 
+#include <imgui.h>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
 namespace AlgorithmVisualizer {
 
+// Draws large batches of rectangles or circles (bars, grid cells, graph nodes)
+// with one instanced draw call per batch, into an offscreen texture that is then
+// placed in the ImGui draw list as a single image. Callers fill a compact
+// instance array each frame; the renderer streams it into a ring of three
+// buffer regions, persistently mapped when the driver has GL_ARB_buffer_storage
+// and mapped unsynchronized per batch otherwise, with a fence per region so the
+// CPU never overwrites data the GPU has yet to read.
+//
+// All methods must be called on the thread that owns the GL context. If the GL
+// functions or shaders are unavailable, Draw falls back to ImDrawList
+// primitives, so callers never need a second code path.
 class Renderer {
 public:
+    enum class Shape : uint32_t { Rect, Circle };
+
+    static constexpr size_t PALETTE_SIZE = 16;
+    static constexpr size_t REGION_COUNT = 3;
+    static constexpr size_t INSTANCES_PER_FRAME = 65536; // Per region; a frame's batches share it
+
+    // 20 bytes; position and size are in pixels relative to the batch origin
+    struct Instance {
+        float x = 0.0f;
+        float y = 0.0f;
+        float width = 0.0f;
+        float height = 0.0f;
+        uint32_t colorIndex = 0; // Into Batch::palette
+    };
+
+    struct Batch {
+        Shape shape = Shape::Rect;
+        std::span<const ImU32> palette;   // At most PALETTE_SIZE colors
+        std::span<const Instance> instances;
+        ImU32 outlineColor = 0;           // Drawn inside each instance's edge
+        float outlineWidth = 0.0f;
+    };
+
+    struct Stats {
+        uint32_t batches = 0;       // Last frame
+        uint32_t instances = 0;     // Last frame
+        uint64_t truncated = 0;     // Instances that did not fit in a region, since startup
+        uint64_t stalls = 0;        // Frames that waited on the GPU for a free region
+        bool persistentMapped = false;
+        bool gpu = false;           // False when drawing through the ImDrawList fallback
+    };
+
     Renderer() = default;
     ~Renderer() = default;
-    
-    void Initialize();
-    void Render();
+    Renderer(const Renderer&) = delete;
+    Renderer& operator=(const Renderer&) = delete;
+
+    // Needs a current GL 3.3 context; false leaves the renderer on the fallback path
+    bool Initialize();
+    // Once per frame before any Draw: fences the last region and moves to the next
+    void BeginFrame();
+    // Renders the batch over [pos, pos + size) of the draw list
+    void Draw(ImDrawList* drawList, const ImVec2& pos, const ImVec2& size, const Batch& batch);
     void Shutdown();
+
+    // The fallback path: one ImDrawList primitive per instance, for when there is no renderer
+    static void DrawWithImGui(ImDrawList* drawList, const ImVec2& pos, const Batch& batch);
+
+    [[nodiscard]] bool IsInitialized() const { return m_initialized; }
+    [[nodiscard]] Stats GetStats() const;
+
+private:
+    struct Target {
+        unsigned int framebuffer = 0;
+        unsigned int texture = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    bool CreateProgram();
+    bool CreateStreamBuffer();
+    // Binds the next free target's framebuffer; null if it cannot be made complete
+    Target* AcquireTarget(int width, int height);
+    // Copies instances into the current region; returns the first instance's byte offset
+    size_t Stream(std::span<const Instance> instances);
+
+    bool m_initialized = false;
+    bool m_persistent = false;
+
+    unsigned int m_program = 0;
+    unsigned int m_vertexArray = 0;
+    unsigned int m_buffer = 0;
+    void* m_mapped = nullptr; // Whole buffer, when persistently mapped
+    int m_viewportLocation = -1;
+    int m_paletteLocation = -1;
+    int m_outlineLocation = -1;
+    int m_outlineWidthLocation = -1;
+    int m_shapeLocation = -1;
+
+    void* m_fences[REGION_COUNT] = {}; // GLsync per region, signalled once the GPU is done with it
+    size_t m_region = 0;
+    size_t m_regionUsed = 0; // Instances written to the current region this frame
+
+    std::vector<Target> m_targets; // Each batch in a frame needs its own texture until ImGui draws it
+    size_t m_targetsUsed = 0;
+
+    Stats m_frameStats;
+    Stats m_lastFrameStats;
 };
 
-} // namespace AlgorithmVisualizer 
\ No newline at end of file
+} // namespace AlgorithmVisualizer
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <imgui.h>
+#include <utility>
+#include <vector>
+
+namespace AlgorithmVisualizer {
+
+// Background effects (scanlines, grid, dot field) drawn from small tiled
+// textures made once, instead of as hundreds of lines and circles per panel
+// per frame. Each effect is a single textured quad whose UVs repeat the tile;
+// animation moves only the UVs and the tint, so the per-frame cost no longer
+// grows with the panel size.
+//
+// Textures are created on first use, so drawing must happen with the GL
+// context current; Shutdown releases them and must run before the context goes.
+class RetroEffects {
+public:
+    enum class Quality {
+        Off,  // Effects are not drawn
+        Low,  // Drawn once per frame but static, so an idle window has nothing to redraw for
+        High  // Animated
+    };
+
+    RetroEffects() = default;
+    ~RetroEffects() = default;
+
+    RetroEffects(const RetroEffects&) = delete;
+    RetroEffects& operator=(const RetroEffects&) = delete;
+
+    void SetQuality(Quality quality) { m_quality = quality; }
+    [[nodiscard]] Quality GetQuality() const { return m_quality; }
+    [[nodiscard]] bool IsAnimated() const { return m_quality == Quality::High; }
+
+    void DrawScanlines(ImDrawList* drawList, const ImVec2& pos, const ImVec2& size, float intensity, float time);
+    void DrawGrid(ImDrawList* drawList, const ImVec2& pos, const ImVec2& size, float spacing, float alpha, float time);
+    // count is the number of dots the area should hold on average
+    void DrawDots(ImDrawList* drawList, const ImVec2& pos, const ImVec2& size, int count, float time);
+
+    void Shutdown();
+
+    static const char* QualityName(Quality quality);
+
+private:
+    unsigned int GetScanlineTexture();
+    unsigned int GetGridTexture(int spacing);
+    unsigned int GetDotTexture();
+    // White RGBA tile with the given alpha per pixel, repeating in both directions
+    static unsigned int CreateTexture(int width, int height, const std::vector<unsigned char>& alpha, bool smooth);
+
+    Quality m_quality = Quality::High;
+    unsigned int m_scanlineTexture = 0;
+    unsigned int m_dotTexture = 0;
+    std::vector<std::pair<int, unsigned int>> m_gridTextures; // By spacing in pixels
+};
+
+} // namespace AlgorithmVisualizer
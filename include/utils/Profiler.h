@@ -0,0 +1,90 @@
+#pragma once
+
+#include "utils/TraceWriter.h"
+#include <cstdint>
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace AlgorithmVisualizer {
+
+// Scoped CPU profiler. PROFILE_SCOPE("Name") times the enclosing block; each
+// thread writes finished zones into its own lock-free ring (registered on the
+// thread's first zone), so timing a block costs two clock reads and a push.
+// Once a frame, the UI thread calls EndFrame, which drains every ring into a
+// Frame and keeps the last HISTORY_FRAMES of them for display.
+//
+// While a trace is open, EndFrame also streams each frame's zones, a span for
+// the frame itself and any TraceSpan calls to a Chrome trace-event file.
+//
+// Zone names must outlive the profiler: string literals or __func__.
+class Profiler {
+public:
+    static constexpr size_t HISTORY_FRAMES = 240;
+    static constexpr size_t ZONES_PER_THREAD = 4096; // Ring size; a thread finishing more in one frame drops the rest
+    static constexpr uint32_t FRAME_TRACK = 1000;     // Trace rows after the threads
+    static constexpr uint32_t SPAN_TRACK = 1001;
+
+    struct Zone {
+        const char* name;
+        int64_t startNs;  // Since the profiler's epoch
+        int64_t endNs;
+        uint32_t depth;   // Nesting level on its own thread, 0 outermost
+        uint32_t thread;  // Index into ThreadNames()
+    };
+
+    struct Frame {
+        int64_t startNs = 0;
+        int64_t endNs = 0;
+        std::vector<Zone> zones; // Zones drained at the end of this frame, from every thread
+    };
+
+    // Recording is on by default; when off a zone costs one relaxed load and
+    // EndFrame leaves the history untouched
+    static void SetEnabled(bool enabled);
+    [[nodiscard]] static bool IsEnabled();
+
+    // Label for the calling thread in the timeline
+    static void SetThreadName(const char* name);
+
+    // UI thread only
+    static void EndFrame();
+    [[nodiscard]] static const std::deque<Frame>& Frames(); // Oldest first
+    [[nodiscard]] static std::vector<std::string> ThreadNames();
+    [[nodiscard]] static uint64_t DroppedZones();
+    
+    // Trace capture; starting one turns recording on. UI thread only
+    static bool StartTrace(const std::string& path);
+    static void StopTrace();
+    [[nodiscard]] static bool IsTracing();
+    [[nodiscard]] static TraceWriter::Stats GetTraceStats();
+    [[nodiscard]] static const std::string& GetTracePath();
+    // A span outside any thread's zone stack, such as a whole algorithm run; args as in TraceWriter::Event
+    static void TraceSpan(std::string label, const char* category, int64_t startNs, int64_t endNs, std::string args = {});
+
+    [[nodiscard]] static int64_t NowNs();
+    static void Record(const char* name, int64_t startNs, int64_t endNs, uint32_t depth);
+};
+
+class ProfileZone {
+public:
+    explicit ProfileZone(const char* name);
+    ~ProfileZone();
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* m_name;
+    int64_t m_startNs = 0;
+    uint32_t m_depth = 0;
+    bool m_active;
+};
+
+} // namespace AlgorithmVisualizer
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ::AlgorithmVisualizer::ProfileZone PROFILE_CONCAT(profileZone_, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__func__)
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace AlgorithmVisualizer {
+
+// Small fixed-size pool of worker threads draining one FIFO queue. Submit hands
+// back a future for the task's result; an exception thrown by the task is stored
+// in the future and rethrown by get(). Destroying the pool runs whatever is still
+// queued, then joins the workers.
+class TaskPool {
+public:
+    explicit TaskPool(size_t threadCount = DefaultThreadCount());
+    ~TaskPool();
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    template <typename F>
+    std::future<std::invoke_result_t<F>> Submit(F&& task) {
+        using Result = std::invoke_result_t<F>;
+        // std::function needs a copyable target, so the packaged_task is shared
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        std::future<Result> future = packaged->get_future();
+        Enqueue([packaged] { (*packaged)(); });
+        return future;
+    }
+
+    [[nodiscard]] size_t ThreadCount() const { return m_threads.size(); }
+
+    // Hardware threads less one for the caller, between 1 and 4
+    static size_t DefaultThreadCount();
+
+private:
+    void Enqueue(std::function<void()> task);
+    void WorkerLoop();
+
+    std::vector<std::thread> m_threads;
+    std::deque<std::function<void()>> m_queue;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    bool m_stopping = false;
+};
+
+} // namespace AlgorithmVisualizer
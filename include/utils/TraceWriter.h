@@ -0,0 +1,74 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace AlgorithmVisualizer {
+
+// Streams Chrome trace-event JSON ({"traceEvents": [...]}) to a file from a
+// background thread, for chrome://tracing, Perfetto or Speedscope. Producers
+// hand over whole batches under one lock; the writer formats and writes them
+// outside it. At most MAX_QUEUED_EVENTS wait at once, and a batch that would go
+// past that is dropped and counted, so a slow disk costs events rather than memory.
+class TraceWriter {
+public:
+    static constexpr size_t MAX_QUEUED_EVENTS = 1 << 16;
+
+    struct Event {
+        const char* name = nullptr; // Static string; label is used instead when set
+        std::string label;
+        const char* category = "zone";
+        int64_t startNs = 0;        // Profiler clock
+        int64_t durationNs = 0;
+        uint32_t thread = 0;
+        std::string args;           // JSON object body without braces, e.g. "\"swaps\": 12"; may be empty
+    };
+
+    struct Stats {
+        uint64_t written = 0;
+        uint64_t dropped = 0;
+        size_t queued = 0;
+    };
+
+    TraceWriter() = default;
+    ~TraceWriter();
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    bool Open(const std::string& path);
+    // Writes what is queued, names the tracks (tid, name) and closes the JSON
+    void Close(const std::vector<std::pair<uint32_t, std::string>>& trackNames);
+
+    // Any thread; takes the events
+    void Submit(std::vector<Event>&& batch);
+
+    [[nodiscard]] bool IsOpen() const { return m_file != nullptr; }
+    [[nodiscard]] const std::string& GetPath() const { return m_path; }
+    [[nodiscard]] Stats GetStats();
+
+private:
+    void WriterLoop();
+    void WriteBatch(const std::vector<Event>& batch, std::string& text);
+
+    std::FILE* m_file = nullptr;
+    std::string m_path;
+    bool m_firstEvent = true; // Writer thread only, until Close
+
+    std::thread m_writer;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::vector<std::vector<Event>> m_batches;
+    size_t m_queuedEvents = 0;
+    uint64_t m_written = 0;
+    uint64_t m_dropped = 0;
+    bool m_stopping = false;
+};
+
+} // namespace AlgorithmVisualizer
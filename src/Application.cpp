@@ -1,10 +1,15 @@
 #include "Application.h"
 #include "algorithms/SortingVisualizer.h"
+#include "algorithms/SortingRace.h"
 #include "algorithms/PathfindingVisualizer.h"
 #include "algorithms/GraphVisualizer.h"
 #include "algorithms/SearchVisualizer.h"
 #include "algorithms/TreeVisualizer.h"
 #include "audio/AudioManager.h"
+#include "renderer/Renderer.h"
+#include "renderer/RetroEffects.h"
+#include "utils/Profiler.h"
+#include "utils/TaskPool.h"
 
 #include <imgui.h>
 #include <imgui_impl_glfw.h>
@@ -18,6 +23,9 @@
 #include <cstdlib>
 #include <iostream>
 #include <cmath>
+#include <algorithm>
+#include <thread>
+#include <string_view>
 
 #if defined(__APPLE__)
 #include <OpenGL/gl.h>
@@ -30,7 +38,8 @@ namespace AlgorithmVisualizer {
 // Global application instance for retro UI effects
 Application* g_application = nullptr;
 
-Application::Application() {
+Application::Application()
+    : m_retroEffects(std::make_unique<RetroEffects>()), m_renderer(std::make_unique<Renderer>()) {
     g_application = this;
 }
 
@@ -39,6 +48,9 @@ Application::~Application() {
 }
 
 bool Application::Initialize() {
+    m_startupBegin = std::chrono::steady_clock::now();
+    Profiler::SetThreadName("Main");
+    
     if (!InitializeGLFW()) {
         return false;
     }
@@ -47,70 +59,223 @@ bool Application::Initialize() {
         return false;
     }
     
-    // Initialize audio manager
-    m_audioManager = std::make_shared<AlgorithmVisualizer::AudioManager>();
-    if (!m_audioManager->Initialize()) {
-        std::cerr << "Warning: Failed to initialize audio manager" << std::endl;
-    }
+    m_renderer->Initialize(); // On failure it reports why and visualizers draw through ImGui
     
-    // Initialize visualizers with audio manager and performance callback
-    m_sortingVisualizer = std::make_unique<SortingVisualizer>(m_audioManager.get());
-    m_pathfindingVisualizer = std::make_unique<PathfindingVisualizer>(m_audioManager.get());
-    m_graphVisualizer = std::make_unique<GraphVisualizer>(m_audioManager.get());
-    m_searchVisualizer = std::make_unique<SearchVisualizer>(m_audioManager);
-    m_treeVisualizer = std::make_unique<TreeVisualizer>(m_audioManager);
+    m_startupWindowMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_startupBegin).count();
+    StartStartupTasks();
     
-    // Set up performance reporting callbacks
-    m_sortingVisualizer->SetPerformanceCallback(
-        [this](const std::string& name, double time, int comparisons, int swaps) {
-            this->ReportAlgorithmPerformance(name, time, comparisons, swaps);
-        }
-    );
+    std::cout << "Application initialized successfully" << std::endl;
+    return true;
+}
+
+void Application::StartStartupTasks() {
+    m_audioManager = std::make_shared<AlgorithmVisualizer::AudioManager>();
+    m_taskPool = std::make_unique<TaskPool>();
     
-    m_searchVisualizer->SetPerformanceCallback(
-        [this](const std::string& name, double time, int comparisons, int swaps) {
-            this->ReportAlgorithmPerformance(name, time, comparisons, swaps);
+    // Audio device and tone bank
+    m_startupTasks.push_back(m_taskPool->Submit([this] {
+        PROFILE_SCOPE("Startup::Audio");
+        if (!m_audioManager->Initialize()) {
+            std::cerr << "Warning: Failed to initialize audio manager" << std::endl;
         }
-    );
+    }));
     
-    m_treeVisualizer->SetPerformanceCallback(
-        [this](const std::string& name, double time, int comparisons, int swaps) {
-            this->ReportAlgorithmPerformance(name, time, comparisons, swaps);
+    // The first visualizer shown, with its data; the others wait for first use
+    m_startupTasks.push_back(m_taskPool->Submit([this] {
+        PROFILE_SCOPE("Startup::SortingVisualizer");
+        EnsureVisualizer(VisualizationMode::Sorting);
+    }));
+    
+    m_startupTaskCount = m_startupTasks.size();
+}
+
+bool Application::PollStartupTasks() {
+    if (m_startupComplete) {
+        return true;
+    }
+    
+    for (auto it = m_startupTasks.begin(); it != m_startupTasks.end();) {
+        if (it->wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            it->get(); // Rethrows anything the task threw
+            it = m_startupTasks.erase(it);
+            m_startupTasksDone++;
+        } else {
+            ++it;
         }
-    );
+    }
+    if (!m_startupTasks.empty()) {
+        return false;
+    }
     
-    std::cout << "Application initialized successfully" << std::endl;
+    m_taskPool.reset();
+    m_startupComplete = true;
+    m_startupReadyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_startupBegin).count();
+    fmt::print("Startup: interactive after {:.0f} ms (window and ImGui {:.0f} ms)\n", m_startupReadyMs, m_startupWindowMs);
     return true;
 }
 
+void Application::FinishStartupTasks() {
+    for (std::future<void>& task : m_startupTasks) {
+        task.wait();
+    }
+    m_startupTasks.clear();
+    m_taskPool.reset();
+}
+
+void Application::EnsureVisualizer(VisualizationMode mode) {
+    auto reportPerformance = [this](const std::string& name, double time, int comparisons, int swaps) {
+        this->ReportAlgorithmPerformance(name, time, comparisons, swaps);
+    };
+    
+    switch (mode) {
+        case VisualizationMode::Sorting:
+            if (!m_sortingVisualizer) {
+                m_sortingVisualizer = std::make_unique<SortingVisualizer>(m_audioManager.get(), m_renderer.get());
+                m_sortingVisualizer->SetPerformanceCallback(reportPerformance);
+            }
+            break;
+        case VisualizationMode::Pathfinding:
+            if (!m_pathfindingVisualizer) {
+                m_pathfindingVisualizer = std::make_unique<PathfindingVisualizer>(m_audioManager.get(), m_renderer.get());
+            }
+            break;
+        case VisualizationMode::Graph:
+            if (!m_graphVisualizer) {
+                m_graphVisualizer = std::make_unique<GraphVisualizer>(m_audioManager.get(), m_renderer.get());
+            }
+            break;
+        case VisualizationMode::Search:
+            if (!m_searchVisualizer) {
+                m_searchVisualizer = std::make_unique<SearchVisualizer>(m_audioManager);
+                m_searchVisualizer->SetPerformanceCallback(reportPerformance);
+            }
+            break;
+        case VisualizationMode::Tree:
+            if (!m_treeVisualizer) {
+                m_treeVisualizer = std::make_unique<TreeVisualizer>(m_audioManager);
+                m_treeVisualizer->SetPerformanceCallback(reportPerformance);
+            }
+            break;
+    }
+}
+
 void Application::Run() {
+    m_frameStart = std::chrono::steady_clock::now();
     while (!glfwWindowShouldClose(m_window)) {
-        glfwPollEvents();
+        const auto previousStart = m_frameStart;
+        {
+            PROFILE_SCOPE("Application::WaitForNextFrame");
+            WaitForNextFrame();
+        }
+        m_frameStart = std::chrono::steady_clock::now();
         
         Update();
         Render();
         
-        glfwSwapBuffers(m_window);
+        {
+            PROFILE_SCOPE("SwapBuffers");
+            glfwSwapBuffers(m_window);
+        }
+        
+        const auto frameEnd = std::chrono::steady_clock::now();
+        m_frameIntervals[m_frameHistoryNext] = std::chrono::duration<float, std::milli>(m_frameStart - previousStart).count();
+        m_frameWorkTimes[m_frameHistoryNext] = std::chrono::duration<float, std::milli>(frameEnd - m_frameStart).count();
+        m_frameHistoryNext = (m_frameHistoryNext + 1) % FRAME_HISTORY;
+        m_frameHistoryCount = std::min(m_frameHistoryCount + 1, FRAME_HISTORY);
+        Profiler::EndFrame();
+    }
+}
+
+bool Application::IsVisualizerAnimating() const {
+    switch (m_currentVisualizer) {
+        case VisualizationMode::Sorting:
+            return m_sortingVisualizer && m_sortingVisualizer->IsAnimating();
+        case VisualizationMode::Pathfinding:
+            return m_pathfindingVisualizer && m_pathfindingVisualizer->IsAnimating();
+        case VisualizationMode::Graph:
+            return m_graphVisualizer && m_graphVisualizer->IsAnimating();
+        case VisualizationMode::Search:
+            return m_searchVisualizer && m_searchVisualizer->IsAnimating();
+        case VisualizationMode::Tree:
+            return m_treeVisualizer && m_treeVisualizer->IsAnimating();
     }
+    return false;
+}
+
+Application::FramePacing Application::ChooseFramePacing() const {
+    if (m_appState == AppState::Splash) {
+        return FramePacing::Decorative;
+    }
+    // A held button or slider drag must track the mouse exactly
+    if (IsVisualizerAnimating() || ImGui::IsAnyItemActive() || m_wakeFrames > 0) {
+        return FramePacing::Full;
+    }
+    return m_animateIdleEffects && m_retroEffects->IsAnimated() ? FramePacing::Decorative : FramePacing::Idle;
+}
+
+void Application::WaitForNextFrame() {
+    m_framePacing = ChooseFramePacing();
+    if (m_wakeFrames > 0) {
+        m_wakeFrames--;
+    }
+    
+    if (m_framePacing == FramePacing::Full) {
+        if (m_frameRateCap > 0) {
+            std::this_thread::sleep_until(m_frameStart + std::chrono::duration<double>(1.0 / m_frameRateCap));
+        }
+        glfwPollEvents();
+        return;
+    }
+    
+    // Wait out the rest of this frame's slot; any input ends the wait early
+    const double period = m_framePacing == FramePacing::Decorative ? 1.0 / std::max(m_decorativeFrameRate, 1) : IDLE_WAIT_SECONDS;
+    const auto deadline = m_frameStart + std::chrono::duration<double>(period);
+    const double remaining = std::chrono::duration<double>(deadline - std::chrono::steady_clock::now()).count();
+    if (remaining <= 0.0) {
+        glfwPollEvents();
+        return;
+    }
+    glfwWaitEventsTimeout(remaining);
+    if (std::chrono::steady_clock::now() + std::chrono::milliseconds(1) < deadline) {
+        // Woken by an event rather than the timeout
+        m_wakeFrames = WAKE_FRAMES;
+    }
+}
+
+void Application::SetVSync(bool enabled) {
+    m_vsync = enabled;
+    glfwSwapInterval(enabled ? 1 : 0);
 }
 
 void Application::Shutdown() {
+    // The window may close during the splash, with tasks still running
+    FinishStartupTasks();
+    Profiler::StopTrace();
+    m_retroEffects->Shutdown(); // Textures go while the GL context is still current
+    m_renderer->Shutdown();
     CleanupImGui();
     CleanupGLFW();
 }
 
 void Application::Update() {
+    PROFILE_SCOPE("Application::Update");
     // Start the Dear ImGui frame
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
     ImGui::NewFrame();
     
+    // Nothing below is ready until the startup tasks are
+    if (!PollStartupTasks()) {
+        return;
+    }
+    
     // Update audio manager
     if (m_audioManager) {
         m_audioManager->Update();
     }
     
     // Update current visualizer
+    EnsureVisualizer(m_currentVisualizer);
     switch (m_currentVisualizer) {
         case VisualizationMode::Sorting:
             m_sortingVisualizer->Update();
@@ -131,6 +296,9 @@ void Application::Update() {
 }
 
 void Application::Render() {
+    PROFILE_SCOPE("Application::Render");
+    m_renderer->BeginFrame();
+    
     // Update splash screen timing
     if (m_appState == AppState::Splash) {
         // Cap delta time to prevent splash screen from being skipped on first frame
@@ -145,9 +313,9 @@ void Application::Render() {
         
 
         
-        // Allow skipping only after minimum display time (0.5 seconds)
-        bool canSkip = m_splashAnimationTime >= 0.5f && (ImGui::IsKeyPressed(ImGuiKey_Space) || ImGui::IsMouseClicked(0));
-        if (m_splashAnimationTime >= m_splashDuration || canSkip) {
+        // Leave once loading is done: on a key or click, or after the minimum display time
+        bool canSkip = m_startupComplete && (ImGui::IsKeyPressed(ImGuiKey_Space) || ImGui::IsMouseClicked(0));
+        if ((m_startupComplete && m_splashAnimationTime >= m_splashDuration) || canSkip) {
             m_appState = AppState::Running;
         }
     }
@@ -203,7 +371,9 @@ void Application::RenderSplashScreen() {
         
         // Retro loading screen (starting simple and building up)
         
-        float progress = m_splashAnimationTime / m_splashDuration;
+        // Follows the startup tasks, but never faster than the minimum display time
+        float taskProgress = m_startupTaskCount > 0 ? static_cast<float>(m_startupTasksDone) / m_startupTaskCount : 1.0f;
+        float progress = std::min(m_splashAnimationTime / m_splashDuration, taskProgress);
         float pulse = (sin(m_splashAnimationTime * 4.0f) + 1.0f) * 0.5f; // Pulsing effect
         
         ImGui::Spacing();
@@ -280,7 +450,7 @@ void Application::RenderSplashScreen() {
         ImGui::Spacing();
         
         // Skip instruction
-        if (m_splashAnimationTime > 0.5f) {
+        if (m_startupComplete) {
             ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.7f, 0.7f, 0.7f, 0.5f + pulse * 0.3f)); // Pulsing gray
             ImGui::Text("        [ PRESS SPACE OR CLICK TO SKIP ]");
             ImGui::PopStyleColor();
@@ -392,6 +562,15 @@ void Application::RenderMenuBar() {
         }
         
         if (ImGui::BeginMenu("Themes")) {
+            if (ImGui::BeginMenu("Retro Effects")) {
+                for (RetroEffects::Quality quality : {RetroEffects::Quality::Off, RetroEffects::Quality::Low, RetroEffects::Quality::High}) {
+                    if (ImGui::MenuItem(RetroEffects::QualityName(quality), nullptr, m_retroEffects->GetQuality() == quality)) {
+                        m_retroEffects->SetQuality(quality);
+                    }
+                }
+                ImGui::EndMenu();
+            }
+            ImGui::Separator();
             if (ImGui::MenuItem("Dark", nullptr, m_currentTheme == Theme::Dark)) {
                 m_currentTheme = Theme::Dark;
                 ApplyTheme(m_currentTheme);
@@ -459,6 +638,7 @@ void Application::RenderMainContent() {
                                    ImGuiWindowFlags_NoBringToFrontOnFocus | ImGuiWindowFlags_NoNavFocus;
     
     if (ImGui::Begin("MainContent", nullptr, window_flags)) {
+        EnsureVisualizer(m_currentVisualizer); // The menu may have switched since Update
         switch (m_currentVisualizer) {
             case VisualizationMode::Sorting:
                 m_sortingVisualizer->Render();
@@ -504,7 +684,7 @@ bool Application::InitializeGLFW() {
     }
     
     glfwMakeContextCurrent(m_window);
-    glfwSwapInterval(1); // Enable vsync
+    glfwSwapInterval(m_vsync ? 1 : 0);
     
     return true;
 }
@@ -561,6 +741,10 @@ bool Application::InitializeImGui() {
 }
 
 // Retro UI Effects Implementation
+float Application::EffectTime() const {
+    return m_retroEffects->IsAnimated() ? static_cast<float>(ImGui::GetTime()) : 0.0f;
+}
+
 ImVec4 Application::GetRainbowColor(float progress, float time) {
     // Create a shifting rainbow effect based on progress and time
     float hue = fmod(progress * 360.0f + time * 30.0f, 360.0f) / 360.0f;
@@ -594,7 +778,7 @@ void Application::DrawAnimatedProgressBar(float progress, const ImVec2& size, co
     ImVec2 barSize = (size.x < 0) ? ImVec2(ImGui::GetContentRegionAvail().x, 20) : size;
     
     // Get current time for animations
-    float time = ImGui::GetTime();
+    float time = EffectTime();
     
     // Background
     ImU32 bgColor = IM_COL32(40, 40, 40, 255);
@@ -654,7 +838,7 @@ void Application::DrawAnimatedProgressBar(float progress, const ImVec2& size, co
 }
 
 void Application::DrawGlowingButton(const char* label, const ImVec4& glowColor) {
-    float time = ImGui::GetTime();
+    float time = EffectTime();
     float glowIntensity = 0.5f + 0.3f * sin(time * 2.0f);
     
     // Push glowing style
@@ -678,23 +862,32 @@ void Application::DrawGlowingButton(const char* label, const ImVec4& glowColor)
 }
 
 void Application::DrawAnimatedSeparator(float width) {
-    float time = ImGui::GetTime();
+    if (m_retroEffects->GetQuality() == RetroEffects::Quality::Off) {
+        ImGui::Separator();
+        return;
+    }
+    PROFILE_SCOPE("Effects::Separator");
+    float time = EffectTime();
     ImDrawList* drawList = ImGui::GetWindowDrawList();
     ImVec2 cursorPos = ImGui::GetCursorScreenPos();
     float separatorWidth = (width < 0) ? ImGui::GetContentRegionAvail().x : width;
     
-    // Animated line with color shifting
-    for (int i = 0; i < (int)separatorWidth; i += 4) {
-        float progress = (float)i / separatorWidth;
+    // Gradient segments: the GPU blends between the stops, so a few wide quads replace a line every 4px
+    constexpr float SEGMENT = 32.0f;
+    auto stopColor = [&](float x) {
+        float progress = separatorWidth > 0.0f ? x / separatorWidth : 0.0f;
         ImVec4 color = GetRainbowColor(progress, time * 0.5f);
         color.w = 0.7f + 0.3f * sin(time * 3.0f + progress * 10.0f);
-        
-        ImU32 lineColor = IM_COL32((int)(color.x * 255), (int)(color.y * 255), (int)(color.z * 255), (int)(color.w * 255));
-        
-        drawList->AddLine(
-            ImVec2(cursorPos.x + i, cursorPos.y),
-            ImVec2(cursorPos.x + std::min(i + 4, (int)separatorWidth), cursorPos.y),
-            lineColor, 2.0f
+        return IM_COL32((int)(color.x * 255), (int)(color.y * 255), (int)(color.z * 255), (int)(color.w * 255));
+    };
+    for (float x = 0.0f; x < separatorWidth; x += SEGMENT) {
+        float next = std::min(x + SEGMENT, separatorWidth);
+        ImU32 left = stopColor(x);
+        ImU32 right = stopColor(next);
+        drawList->AddRectFilledMultiColor(
+            ImVec2(cursorPos.x + x, cursorPos.y - 1.0f),
+            ImVec2(cursorPos.x + next, cursorPos.y + 1.0f),
+            left, right, right, left
         );
     }
     
@@ -702,7 +895,7 @@ void Application::DrawAnimatedSeparator(float width) {
 }
 
 void Application::PushPulsingTextStyle(float intensity) {
-    float time = ImGui::GetTime();
+    float time = EffectTime();
     float pulse = 0.7f + intensity * sin(time * 2.0f);
     
     ImVec4 currentTextColor = ImGui::GetStyle().Colors[ImGuiCol_Text];
@@ -716,31 +909,17 @@ void Application::PopPulsingTextStyle() {
 }
 
 void Application::DrawScanlines(const ImVec2& pos, const ImVec2& size, float intensity) {
-    ImDrawList* drawList = ImGui::GetWindowDrawList();
-    float time = ImGui::GetTime();
-    
-    // Animated scanlines moving down
-    int lineSpacing = 3;
-    float offset = fmod(time * 30.0f, lineSpacing * 2);
-    
-    for (int y = 0; y < (int)size.y; y += lineSpacing) {
-        float adjustedY = y + offset;
-        if (adjustedY < size.y) {
-            float alpha = intensity * (0.5f + 0.3f * sin(time * 2.0f + y * 0.1f));
-            ImU32 lineColor = IM_COL32(0, 255, 255, (int)(alpha * 255));
-            
-            drawList->AddLine(
-                ImVec2(pos.x, pos.y + adjustedY),
-                ImVec2(pos.x + size.x, pos.y + adjustedY),
-                lineColor, 1.0f
-            );
-        }
-    }
+    m_retroEffects->DrawScanlines(ImGui::GetWindowDrawList(), pos, size, intensity, EffectTime());
 }
 
 void Application::DrawNeonBorder(const ImVec2& min, const ImVec2& max, const ImVec4& color, float thickness) {
+    const RetroEffects::Quality quality = m_retroEffects->GetQuality();
+    if (quality == RetroEffects::Quality::Off) {
+        return;
+    }
+    PROFILE_SCOPE("Effects::NeonBorder");
     ImDrawList* drawList = ImGui::GetWindowDrawList();
-    float time = ImGui::GetTime();
+    float time = EffectTime();
     float pulse = 0.7f + 0.3f * sin(time * 3.0f);
     
     ImVec4 glowColor = ImVec4(color.x, color.y, color.z, color.w * pulse);
@@ -749,6 +928,10 @@ void Application::DrawNeonBorder(const ImVec2& min, const ImVec2& max, const ImV
     // Main border
     drawList->AddRect(min, max, borderColor, 3.0f, 0, thickness);
     
+    if (quality == RetroEffects::Quality::Low) {
+        return;
+    }
+    
     // Outer glow
     float glowOffset = 2.0f;
     ImU32 outerGlow = IM_COL32((int)(color.x * 255), (int)(color.y * 255), (int)(color.z * 255), (int)(color.w * pulse * 100));
@@ -760,34 +943,7 @@ void Application::DrawNeonBorder(const ImVec2& min, const ImVec2& max, const ImV
 }
 
 void Application::DrawRetroGrid(const ImVec2& pos, const ImVec2& size, float spacing, float alpha) {
-    ImDrawList* drawList = ImGui::GetWindowDrawList();
-    float time = ImGui::GetTime();
-    
-    // Animated grid with fading effect
-    
-    // Vertical lines
-    for (float x = 0; x < size.x; x += spacing) {
-        float lineAlpha = alpha * (0.3f + 0.2f * sin(time * 2.0f + x * 0.1f));
-        ImU32 lineColor = IM_COL32(0, 255, 255, (int)(lineAlpha * 255));
-        
-        drawList->AddLine(
-            ImVec2(pos.x + x, pos.y),
-            ImVec2(pos.x + x, pos.y + size.y),
-            lineColor, 1.0f
-        );
-    }
-    
-    // Horizontal lines
-    for (float y = 0; y < size.y; y += spacing) {
-        float lineAlpha = alpha * (0.3f + 0.2f * sin(time * 2.0f + y * 0.1f));
-        ImU32 lineColor = IM_COL32(0, 255, 255, (int)(lineAlpha * 255));
-        
-        drawList->AddLine(
-            ImVec2(pos.x, pos.y + y),
-            ImVec2(pos.x + size.x, pos.y + y),
-            lineColor, 1.0f
-        );
-    }
+    m_retroEffects->DrawGrid(ImGui::GetWindowDrawList(), pos, size, spacing, alpha, EffectTime());
 }
 
 void Application::DrawGlowingPanel(const char* title, const ImVec2& size, const ImVec4& glowColor) {
@@ -822,7 +978,7 @@ void Application::DrawRetroTitle(const char* text, const ImVec4& color) {
     ImDrawList* drawList = ImGui::GetWindowDrawList();
     ImVec2 cursorPos = ImGui::GetCursorScreenPos();
     ImVec2 textSize = ImGui::CalcTextSize(text);
-    float time = ImGui::GetTime();
+    float time = EffectTime();
     
     // ASCII border around title
     std::string line1 = "+" + std::string(strlen(text) + 2, '-') + "+";
@@ -842,19 +998,7 @@ void Application::DrawRetroTitle(const char* text, const ImVec4& color) {
 }
 
 void Application::DrawAnimatedDots(const ImVec2& pos, const ImVec2& size, int count) {
-    ImDrawList* drawList = ImGui::GetWindowDrawList();
-    float time = ImGui::GetTime();
-    
-    for (int i = 0; i < count; i++) {
-        float x = pos.x + (float)(i * 97 % (int)size.x); // Pseudo-random distribution
-        float y = pos.y + (float)(i * 71 % (int)size.y);
-        
-        float phase = time * 2.0f + i * 0.1f;
-        float alpha = (sin(phase) + 1.0f) * 0.5f * 0.3f; // Pulsing dots
-        
-        ImU32 dotColor = IM_COL32(0, 255, 255, (int)(alpha * 255));
-        drawList->AddCircleFilled(ImVec2(x, y), 1.0f, dotColor);
-    }
+    m_retroEffects->DrawDots(ImGui::GetWindowDrawList(), pos, size, count, EffectTime());
 }
 
 bool Application::BeginRetroWindow(const char* name, bool* p_open, ImGuiWindowFlags flags) {
@@ -886,6 +1030,232 @@ void Application::EndRetroWindow() {
     ImGui::PopStyleColor(4); // Pop the 4 colors we pushed
 }
 
+void Application::RenderFramePacingControls() {
+    ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.3f, 1.0f), "Frame Pacing");
+    ImGui::Separator();
+    
+    static constexpr const char* pacingNames[] = {"Full rate", "Decorative", "Idle"};
+    ImGui::Text("Mode: %s", pacingNames[static_cast<int>(m_framePacing)]);
+    
+    bool vsync = m_vsync;
+    if (ImGui::Checkbox("VSync", &vsync)) {
+        SetVSync(vsync);
+    }
+    ImGui::SameLine();
+    ImGui::Checkbox("Animate effects when idle", &m_animateIdleEffects);
+    ImGui::SliderInt("Frame rate cap", &m_frameRateCap, 0, 240, m_frameRateCap == 0 ? "Off" : "%d FPS");
+    ImGui::SliderInt("Idle effects rate", &m_decorativeFrameRate, 5, 60, "%d FPS");
+    
+    // Percentiles over the recent history; the arrays are small enough to sort per frame
+    if (m_frameHistoryCount == 0) {
+        return;
+    }
+    auto percentiles = [this](const std::array<float, FRAME_HISTORY>& samples) {
+        std::array<float, FRAME_HISTORY> sorted = samples;
+        std::sort(sorted.begin(), sorted.begin() + m_frameHistoryCount);
+        auto at = [&](float p) { return sorted[static_cast<size_t>(p * (m_frameHistoryCount - 1))]; };
+        return std::array<float, 4>{at(0.5f), at(0.95f), at(0.99f), sorted[m_frameHistoryCount - 1]};
+    };
+    const auto interval = percentiles(m_frameIntervals);
+    const auto work = percentiles(m_frameWorkTimes);
+    ImGui::Text("Last %zu frames", m_frameHistoryCount);
+    ImGui::BulletText("Frame interval p50 %.2f / p95 %.2f / p99 %.2f / max %.2f ms",
+                      interval[0], interval[1], interval[2], interval[3]);
+    ImGui::BulletText("Frame work p50 %.2f / p95 %.2f / p99 %.2f / max %.2f ms",
+                      work[0], work[1], work[2], work[3]);
+}
+
+void Application::RenderProfiler() {
+    bool recording = Profiler::IsEnabled();
+    if (ImGui::Checkbox("Record", &recording)) {
+        Profiler::SetEnabled(recording);
+        m_profilerFrameAge = 0;
+        m_profilerRefit = true;
+    }
+    ImGui::SameLine();
+    ImGui::TextDisabled("Click a frame to pause on it; %llu zones dropped",
+                        static_cast<unsigned long long>(Profiler::DroppedZones()));
+    
+    // Chrome trace capture, for chrome://tracing or ui.perfetto.dev
+    if (!Profiler::IsTracing()) {
+        if (ImGui::Button("Start Trace Capture")) {
+            const auto stamp = std::chrono::duration_cast<std::chrono::seconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+            const std::string path = fmt::format("algo1_trace_{}.json", stamp);
+            m_traceStatus = Profiler::StartTrace(path) ? "" : "Could not write " + path;
+        }
+    } else {
+        if (ImGui::Button("Stop Trace Capture")) {
+            const TraceWriter::Stats stats = Profiler::GetTraceStats();
+            m_traceStatus = fmt::format("Saved {} ({} events)", Profiler::GetTracePath(), stats.written + stats.queued);
+            Profiler::StopTrace();
+        }
+        const TraceWriter::Stats stats = Profiler::GetTraceStats();
+        ImGui::SameLine();
+        ImGui::Text("Writing %s: %llu events, %zu queued, %llu dropped", Profiler::GetTracePath().c_str(),
+                    static_cast<unsigned long long>(stats.written), stats.queued,
+                    static_cast<unsigned long long>(stats.dropped));
+    }
+    if (!m_traceStatus.empty()) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("%s", m_traceStatus.c_str());
+    }
+    
+    const auto& frames = Profiler::Frames();
+    if (frames.empty()) {
+        ImGui::Text("No frames recorded yet");
+        return;
+    }
+    const std::vector<std::string> threadNames = Profiler::ThreadNames();
+    m_profilerFrameAge = std::min(m_profilerFrameAge, frames.size() - 1);
+    const size_t selected = frames.size() - 1 - m_profilerFrameAge;
+    
+    // Frame timeline: one bar per frame
+    std::vector<float> durations(frames.size());
+    for (size_t i = 0; i < frames.size(); ++i) {
+        durations[i] = static_cast<float>(frames[i].endNs - frames[i].startNs) * 1e-6f;
+    }
+    if (ImPlot::BeginPlot("Frame Timeline##profiler", ImVec2(-1, 140), ImPlotFlags_NoLegend | ImPlotFlags_NoMouseText)) {
+        ImPlot::SetupAxes("Frame", "ms", ImPlotAxisFlags_AutoFit | ImPlotAxisFlags_NoTickLabels, ImPlotAxisFlags_AutoFit);
+        ImPlot::PlotBars("Frame time", durations.data(), static_cast<int>(durations.size()));
+        
+        ImPlot::PushPlotClipRect();
+        const ImVec2 min = ImPlot::PlotToPixels(selected - 0.5, durations[selected]);
+        const ImVec2 max = ImPlot::PlotToPixels(selected + 0.5, 0.0);
+        ImPlot::GetPlotDrawList()->AddRect(min, max, IM_COL32(255, 255, 0, 255), 0.0f, 0, 2.0f);
+        ImPlot::PopPlotClipRect();
+        
+        if (ImPlot::IsPlotHovered() && ImGui::IsMouseClicked(0)) {
+            const double x = std::round(ImPlot::GetPlotMousePos().x);
+            const size_t clicked = static_cast<size_t>(std::clamp(x, 0.0, static_cast<double>(frames.size() - 1)));
+            m_profilerFrameAge = frames.size() - 1 - clicked;
+            m_profilerRefit = true;
+            Profiler::SetEnabled(false);
+        }
+        ImPlot::EndPlot();
+    }
+    
+    const Profiler::Frame& frame = frames[selected];
+    const double frameMs = static_cast<double>(frame.endNs - frame.startNs) * 1e-6;
+    ImGui::Text("Frame %zu of %zu: %.2f ms, %zu zones", selected + 1, frames.size(), frameMs, frame.zones.size());
+    
+    // Per-thread order by start, so each zone's children follow it; self time is what children do not cover
+    std::vector<Profiler::Zone> zones = frame.zones;
+    std::sort(zones.begin(), zones.end(), [](const Profiler::Zone& a, const Profiler::Zone& b) {
+        return a.thread != b.thread ? a.thread < b.thread : a.startNs != b.startNs ? a.startNs < b.startNs : a.depth < b.depth;
+    });
+    std::vector<double> childMs(zones.size(), 0.0);
+    std::vector<size_t> open;
+    std::vector<uint32_t> threadDepth(threadNames.size(), 0);
+    for (size_t i = 0; i < zones.size(); ++i) {
+        while (!open.empty() && (zones[open.back()].thread != zones[i].thread || zones[open.back()].endNs <= zones[i].startNs)) {
+            open.pop_back();
+        }
+        if (!open.empty() && zones[open.back()].depth + 1 == zones[i].depth) {
+            childMs[open.back()] += static_cast<double>(zones[i].endNs - zones[i].startNs) * 1e-6;
+        }
+        open.push_back(i);
+        if (zones[i].thread < threadDepth.size()) {
+            threadDepth[zones[i].thread] = std::max(threadDepth[zones[i].thread], zones[i].depth + 1);
+        }
+    }
+    
+    // Flame graph: a band of rows per thread, one row per nesting level
+    std::vector<int> threadRow(threadNames.size(), 0);
+    int rows = 0;
+    for (size_t t = 0; t < threadNames.size(); ++t) {
+        threadRow[t] = rows;
+        rows += static_cast<int>(threadDepth[t]);
+    }
+    if (rows > 0 && ImPlot::BeginPlot("Flame Graph##profiler", ImVec2(-1, 60.0f + rows * 22.0f), ImPlotFlags_NoLegend | ImPlotFlags_NoMouseText)) {
+        ImPlot::SetupAxes("ms", nullptr, ImPlotAxisFlags_None,
+                          ImPlotAxisFlags_Invert | ImPlotAxisFlags_NoTickLabels | ImPlotAxisFlags_NoGridLines | ImPlotAxisFlags_Lock);
+        ImPlot::SetupAxisLimits(ImAxis_X1, 0.0, frameMs, m_profilerRefit ? ImPlotCond_Always : ImPlotCond_Once);
+        ImPlot::SetupAxisLimits(ImAxis_Y1, 0.0, rows, ImPlotCond_Always);
+        m_profilerRefit = false;
+        
+        ImDrawList* drawList = ImPlot::GetPlotDrawList();
+        ImPlot::PushPlotClipRect();
+        for (const Profiler::Zone& zone : zones) {
+            if (zone.thread >= threadNames.size()) {
+                continue;
+            }
+            const double start = static_cast<double>(zone.startNs - frame.startNs) * 1e-6;
+            const double end = static_cast<double>(zone.endNs - frame.startNs) * 1e-6;
+            const double row = static_cast<double>(threadRow[zone.thread] + static_cast<int>(zone.depth));
+            const ImVec2 min = ImPlot::PlotToPixels(start, row);
+            const ImVec2 max = ImPlot::PlotToPixels(end, row + 1.0);
+            
+            // Colour by name, so a zone keeps its colour from frame to frame
+            const size_t hash = std::hash<std::string_view>{}(zone.name);
+            const ImU32 color = ImGui::ColorConvertFloat4ToU32(GetRainbowColor(static_cast<float>(hash % 997) / 997.0f, 0.0f));
+            drawList->AddRectFilled(min, max, color);
+            drawList->AddRect(min, max, IM_COL32(0, 0, 0, 160));
+            if (max.x - min.x > ImGui::CalcTextSize(zone.name).x + 6.0f) {
+                drawList->AddText(ImVec2(min.x + 3.0f, min.y + 2.0f), IM_COL32(0, 0, 0, 255), zone.name);
+            }
+            if (ImPlot::IsPlotHovered() && ImGui::IsMouseHoveringRect(min, max)) {
+                ImGui::SetTooltip("%s\n%s thread\n%.3f ms", zone.name, threadNames[zone.thread].c_str(), end - start);
+            }
+        }
+        for (size_t t = 0; t < threadNames.size(); ++t) {
+            if (threadDepth[t] > 0) {
+                const ImVec2 label = ImPlot::PlotToPixels(0.0, static_cast<double>(threadRow[t]));
+                drawList->AddText(ImVec2(label.x + 3.0f, label.y - ImGui::GetTextLineHeight()), IM_COL32(255, 255, 255, 200), threadNames[t].c_str());
+            }
+        }
+        ImPlot::PopPlotClipRect();
+        ImPlot::EndPlot();
+    }
+    
+    // Totals per zone name and thread, most expensive first
+    struct ZoneTotal {
+        const char* name;
+        uint32_t thread;
+        int calls = 0;
+        double totalMs = 0.0;
+        double selfMs = 0.0;
+    };
+    std::vector<ZoneTotal> totals;
+    for (size_t i = 0; i < zones.size(); ++i) {
+        const double ms = static_cast<double>(zones[i].endNs - zones[i].startNs) * 1e-6;
+        auto it = std::find_if(totals.begin(), totals.end(), [&](const ZoneTotal& total) {
+            return total.thread == zones[i].thread && std::string_view(total.name) == zones[i].name;
+        });
+        if (it == totals.end()) {
+            totals.push_back({zones[i].name, zones[i].thread});
+            it = totals.end() - 1;
+        }
+        it->calls++;
+        it->totalMs += ms;
+        it->selfMs += ms - childMs[i];
+    }
+    std::sort(totals.begin(), totals.end(), [](const ZoneTotal& a, const ZoneTotal& b) { return a.selfMs > b.selfMs; });
+    
+    if (ImGui::BeginTable("ProfilerZones", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable)) {
+        ImGui::TableSetupColumn("Zone");
+        ImGui::TableSetupColumn("Thread");
+        ImGui::TableSetupColumn("Calls");
+        ImGui::TableSetupColumn("Self ms");
+        ImGui::TableSetupColumn("Total ms");
+        ImGui::TableHeadersRow();
+        for (const ZoneTotal& total : totals) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%s", total.name);
+            ImGui::TableNextColumn();
+            ImGui::Text("%s", total.thread < threadNames.size() ? threadNames[total.thread].c_str() : "?");
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", total.calls);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", total.selfMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", total.totalMs);
+        }
+        ImGui::EndTable();
+    }
+}
+
 void Application::SetupImGuiStyle() {
     ImGui::StyleColorsDark();
     
@@ -959,6 +1329,12 @@ void Application::CleanupGLFW() {
 }
 
 void Application::ApplyTheme(Theme theme) {
+    // The neon theme gets the chip-synth sound set to match
+    if (m_audioManager) {
+        m_audioManager->SetSoundStyle(theme == Theme::Cyberpunk ? AudioManager::SoundStyle::Retro
+                                                                : AudioManager::SoundStyle::Classic);
+    }
+    
     ImGuiStyle& style = ImGui::GetStyle();
     ImVec4* colors = style.Colors;
     
@@ -1405,6 +1781,19 @@ void Application::RenderComparison() {
         // Modern tabs for different comparison types
         if (ImGui::BeginTabBar("ComparisonTabs", ImGuiTabBarFlags_Reorderable)) {
             
+            // Measured from the last sorting race, all algorithms on one input
+            if (ImGui::BeginTabItem("Race Results")) {
+                ImGui::Spacing();
+                ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.3f, 1.0f), "Measured Head to Head");
+                const SortingRace* race = m_sortingVisualizer ? m_sortingVisualizer->GetRace() : nullptr;
+                if (race) {
+                    race->RenderResultsTable();
+                } else {
+                    ImGui::TextDisabled("Turn on Race Mode in the sorting controls to measure algorithms side by side.");
+                }
+                ImGui::EndTabItem();
+            }
+            
             if (ImGui::BeginTabItem("Sorting Comparison")) {
                 ImGui::Spacing();
                 ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.3f, 1.0f), "Time Complexity Analysis");
@@ -1625,6 +2014,20 @@ void Application::RenderPerformanceAnalysis() {
                 } else {
                     ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%.1f FPS (Poor)", framerate);
                 }
+                ImGui::Text("Startup: interactive after %.0f ms (window and ImGui %.0f ms)",
+                           m_startupReadyMs, m_startupWindowMs);
+                const Renderer::Stats rendererStats = m_renderer->GetStats();
+                if (rendererStats.gpu) {
+                    ImGui::Text("Renderer: %u instances in %u draw calls (%s buffer, %llu stalls)",
+                               rendererStats.instances, rendererStats.batches,
+                               rendererStats.persistentMapped ? "persistent" : "streamed",
+                               static_cast<unsigned long long>(rendererStats.stalls));
+                } else {
+                    ImGui::TextDisabled("Renderer: ImGui fallback");
+                }
+                
+                ImGui::Spacing();
+                RenderFramePacingControls();
                 
                 ImGui::Spacing();
                 
@@ -1708,6 +2111,12 @@ void Application::RenderPerformanceAnalysis() {
                 ImGui::EndTabItem();
             }
             
+            if (ImGui::BeginTabItem("Profiler##perf_profiler")) {
+                ImGui::Spacing();
+                RenderProfiler();
+                ImGui::EndTabItem();
+            }
+            
             if (ImGui::BeginTabItem("Algorithm Benchmarks##perf_benchmarks")) {
                 ImGui::Spacing();
                 ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.3f, 1.0f), "Recent Algorithm Execution Results");
@@ -2047,6 +2456,13 @@ std::string Application::SaveExportFile(const std::string& content, const std::s
 void Application::ReportAlgorithmPerformance(const std::string& algorithmName, double time, int comparisons, int swaps) {
     RecordAlgorithmPerformance(algorithmName, time, comparisons, swaps);
     
+    // Runs are reported as they finish, so the span ends now
+    if (Profiler::IsTracing()) {
+        const int64_t endNs = Profiler::NowNs();
+        Profiler::TraceSpan(algorithmName, "algorithm", endNs - static_cast<int64_t>(time * 1e6), endNs,
+                            fmt::format("\"comparisons\": {}, \"swaps\": {}", comparisons, swaps));
+    }
+    
     // Don't automatically show performance analysis - only show notification
     // User can click the button in notification to view analysis
 }
@@ -1,6 +1,7 @@
 #include "algorithms/GraphVisualizer.h"
 #include "audio/AudioManager.h"
 #include "Application.h"  // For Application class
+#include "utils/Profiler.h"
 #include <imgui.h>
 #include <algorithm>
 #include <random>
@@ -11,15 +12,17 @@
 
 namespace AlgorithmVisualizer {
 
-GraphVisualizer::GraphVisualizer(AudioManager* audioManager) 
-    : m_audioManager(audioManager) {
+GraphVisualizer::GraphVisualizer(AudioManager* audioManager, Renderer* renderer) 
+    : m_audioManager(audioManager), m_renderer(renderer) {
 }
 
 void GraphVisualizer::Update() {
+    PROFILE_SCOPE("GraphVisualizer::Update");
     // Update graph visualization
 }
 
 void GraphVisualizer::Render() {
+    PROFILE_SCOPE("GraphVisualizer::Render");
     ImGui::Columns(2, "GraphColumns", true);
     
     // Left column - Controls only
@@ -106,6 +109,7 @@ void GraphVisualizer::Render() {
 }
 
 void GraphVisualizer::RenderControls() {
+    PROFILE_SCOPE("GraphVisualizer::RenderControls");
     ImGui::Text("Graph Algorithm Controls");
     ImGui::Separator();
     
@@ -155,6 +159,7 @@ void GraphVisualizer::RenderControls() {
 }
 
 void GraphVisualizer::RenderStatistics() {
+    PROFILE_SCOPE("GraphVisualizer::RenderStatistics");
     ImGui::Text("Statistics");
     ImGui::Separator();
     
@@ -171,6 +176,7 @@ void GraphVisualizer::RenderStatistics() {
 }
 
 void GraphVisualizer::RenderGraph() {
+    PROFILE_SCOPE("GraphVisualizer::RenderGraph");
     ImGui::Text("Graph Visualization");
     ImGui::Separator();
     
@@ -206,17 +212,41 @@ void GraphVisualizer::RenderGraph() {
             }
         }
         
-        // Draw nodes on top
+        // Draw nodes on top, in one batch over the canvas grown by a node radius so edge nodes are not clipped
+        constexpr float NODE_RADIUS = 15.0f;
+        enum NodeColor : uint32_t { Normal, Visited, InMST };
+        static constexpr ImU32 palette[] = {
+            IM_COL32(255, 255, 255, 255),
+            IM_COL32(0, 0, 255, 255),
+            IM_COL32(0, 255, 0, 255)
+        };
+        
+        m_nodeInstances.clear();
+        for (const auto& node : m_nodes) {
+            uint32_t color = node.visited ? Visited : Normal;
+            if (node.inMST) color = InMST;
+            m_nodeInstances.push_back({node.x * canvas_size.x, node.y * canvas_size.y,
+                                       NODE_RADIUS * 2.0f, NODE_RADIUS * 2.0f, color});
+        }
+        
+        Renderer::Batch batch;
+        batch.shape = Renderer::Shape::Circle;
+        batch.palette = palette;
+        batch.instances = m_nodeInstances;
+        batch.outlineColor = IM_COL32(0, 0, 0, 255);
+        batch.outlineWidth = 2.0f;
+        const ImVec2 nodes_pos(canvas_pos.x - NODE_RADIUS, canvas_pos.y - NODE_RADIUS);
+        const ImVec2 nodes_size(canvas_size.x + NODE_RADIUS * 2.0f, canvas_size.y + NODE_RADIUS * 2.0f);
+        if (m_renderer) {
+            m_renderer->Draw(draw_list, nodes_pos, nodes_size, batch);
+        } else {
+            Renderer::DrawWithImGui(draw_list, nodes_pos, batch);
+        }
+        
         for (const auto& node : m_nodes) {
             ImVec2 node_pos(canvas_pos.x + node.x * canvas_size.x, 
                            canvas_pos.y + node.y * canvas_size.y);
             
-            ImU32 node_color = node.visited ? IM_COL32(0, 0, 255, 255) : IM_COL32(255, 255, 255, 255);
-            if (node.inMST) node_color = IM_COL32(0, 255, 0, 255);
-            
-            draw_list->AddCircleFilled(node_pos, 15.0f, node_color);
-            draw_list->AddCircle(node_pos, 15.0f, IM_COL32(0, 0, 0, 255), 0, 2.0f);
-            
             // Draw node label
             char label[16];
             snprintf(label, sizeof(label), "%d", node.id);
@@ -240,6 +270,7 @@ void GraphVisualizer::RenderGraph() {
 }
 
 void GraphVisualizer::GenerateRandomGraph() {
+    PROFILE_SCOPE("GraphVisualizer::GenerateRandomGraph");
     ClearGraph();
     
     std::random_device rd;
@@ -1,19 +1,23 @@
 #include "algorithms/PathfindingVisualizer.h"
 #include "audio/AudioManager.h"
 #include "Application.h"  // For Application class
+#include "utils/Profiler.h"
 #include <imgui.h>
 #include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <random>
+#include <fmt/format.h>
 
 namespace AlgorithmVisualizer {
 
-PathfindingVisualizer::PathfindingVisualizer(AudioManager* audioManager) 
-    : m_audioManager(audioManager) {
+PathfindingVisualizer::PathfindingVisualizer(AudioManager* audioManager, Renderer* renderer) 
+    : m_audioManager(audioManager), m_renderer(renderer) {
     InitializeGrid();
 }
 
 void PathfindingVisualizer::Update() {
+    PROFILE_SCOPE("PathfindingVisualizer::Update");
     if (m_state == AnimationState::Running) {
         auto now = std::chrono::steady_clock::now();
         auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lastUpdate);
@@ -26,6 +30,7 @@ void PathfindingVisualizer::Update() {
 }
 
 void PathfindingVisualizer::Render() {
+    PROFILE_SCOPE("PathfindingVisualizer::Render");
     ImGui::Columns(2, "PathfindingColumns", true);
     
     // Left column - Controls only
@@ -134,6 +139,7 @@ void PathfindingVisualizer::Render() {
 }
 
 void PathfindingVisualizer::RenderControls() {
+    PROFILE_SCOPE("PathfindingVisualizer::RenderControls");
     ImGui::Text("Pathfinding Controls");
     
     // Animated separator for retro feel
@@ -230,6 +236,7 @@ void PathfindingVisualizer::RenderControls() {
 }
 
 void PathfindingVisualizer::RenderStatistics() {
+    PROFILE_SCOPE("PathfindingVisualizer::RenderStatistics");
     // Pulsing statistics header
     extern Application* g_application;
     if (g_application) {
@@ -264,6 +271,7 @@ void PathfindingVisualizer::RenderStatistics() {
 }
 
 void PathfindingVisualizer::RenderGrid() {
+    PROFILE_SCOPE("PathfindingVisualizer::RenderGrid");
     ImGui::Text("Grid Visualization");
     ImGui::Separator();
     
@@ -280,45 +288,36 @@ void PathfindingVisualizer::RenderGrid() {
         float cell_width = canvas_size.x / GRID_WIDTH;
         float cell_height = canvas_size.y / GRID_HEIGHT;
         
-        // Draw grid cells
+        // Colors by cell type, in GridCell::Type order
+        static constexpr ImU32 palette[] = {
+            IM_COL32(255, 255, 255, 255), // Empty: white
+            IM_COL32(50, 50, 50, 255),    // Wall: dark gray
+            IM_COL32(0, 255, 0, 255),     // Start: green
+            IM_COL32(255, 0, 0, 255),     // End: red
+            IM_COL32(255, 165, 0, 255),   // Path: orange
+            IM_COL32(173, 216, 230, 255), // Visited: light blue
+            IM_COL32(255, 255, 0, 255)    // Frontier: yellow
+        };
+        static_assert(std::size(palette) == static_cast<size_t>(GridCell::Type::Frontier) + 1);
+        
+        m_cellInstances.clear();
         for (int y = 0; y < GRID_HEIGHT; ++y) {
             for (int x = 0; x < GRID_WIDTH; ++x) {
-                const auto& cell = m_grid[y][x];
-                
-                ImVec2 cell_min(canvas_pos.x + x * cell_width, canvas_pos.y + y * cell_height);
-                ImVec2 cell_max(cell_min.x + cell_width - 1, cell_min.y + cell_height - 1);
-                
-                // Choose color based on cell type
-                ImU32 color = IM_COL32(255, 255, 255, 255); // Default white
-                
-                switch (cell.type) {
-                    case GridCell::Type::Empty:
-                        color = IM_COL32(255, 255, 255, 255); // White
-                        break;
-                    case GridCell::Type::Wall:
-                        color = IM_COL32(50, 50, 50, 255); // Dark gray
-                        break;
-                    case GridCell::Type::Start:
-                        color = IM_COL32(0, 255, 0, 255); // Green
-                        break;
-                    case GridCell::Type::End:
-                        color = IM_COL32(255, 0, 0, 255); // Red
-                        break;
-                    case GridCell::Type::Visited:
-                        color = IM_COL32(173, 216, 230, 255); // Light blue
-                        break;
-                    case GridCell::Type::Frontier:
-                        color = IM_COL32(255, 255, 0, 255); // Yellow
-                        break;
-                    case GridCell::Type::Path:
-                        color = IM_COL32(255, 165, 0, 255); // Orange
-                        break;
-                }
-                
-                draw_list->AddRectFilled(cell_min, cell_max, color);
-                draw_list->AddRect(cell_min, cell_max, IM_COL32(128, 128, 128, 255)); // Grid lines
+                m_cellInstances.push_back({x * cell_width, y * cell_height, cell_width - 1, cell_height - 1,
+                                           static_cast<uint32_t>(m_grid[y][x].type)});
             }
         }
+        
+        Renderer::Batch batch;
+        batch.palette = palette;
+        batch.instances = m_cellInstances;
+        batch.outlineColor = IM_COL32(128, 128, 128, 255); // Grid lines
+        batch.outlineWidth = 1.0f;
+        if (m_renderer) {
+            m_renderer->Draw(draw_list, canvas_pos, canvas_size, batch);
+        } else {
+            Renderer::DrawWithImGui(draw_list, canvas_pos, batch);
+        }
     }
     
     ImGui::Dummy(canvas_size);
@@ -339,6 +338,7 @@ void PathfindingVisualizer::RenderGrid() {
 }
 
 void PathfindingVisualizer::StartPathfinding() {
+    PROFILE_SCOPE("PathfindingVisualizer::StartPathfinding");
     if (!m_startCell || !m_endCell) {
         return; // Need both start and end
     }
@@ -364,6 +364,12 @@ void PathfindingVisualizer::StartPathfinding() {
     
     auto generationEndTime = std::chrono::steady_clock::now();
     m_algorithmGenerationTime = std::chrono::duration_cast<std::chrono::milliseconds>(generationEndTime - generationStartTime);
+    if (Profiler::IsTracing()) {
+        const int64_t endNs = Profiler::NowNs();
+        const int64_t startNs = endNs - std::chrono::duration_cast<std::chrono::nanoseconds>(generationEndTime - generationStartTime).count();
+        Profiler::TraceSpan(std::string("Steps: ") + m_algorithmNames[static_cast<int>(m_currentAlgorithm)], "steps", startNs, endNs,
+                            fmt::format("\"steps\": {}", m_animationSteps.size()));
+    }
     
     m_currentStepIndex = 0;
 }
@@ -449,6 +455,7 @@ void PathfindingVisualizer::StepForward() {
 }
 
 void PathfindingVisualizer::InitializeGrid() {
+    PROFILE_SCOPE("PathfindingVisualizer::InitializeGrid");
     m_grid.resize(GRID_HEIGHT);
     for (int y = 0; y < GRID_HEIGHT; ++y) {
         m_grid[y].resize(GRID_WIDTH);
@@ -781,6 +788,7 @@ void PathfindingVisualizer::SetCellType(int x, int y, GridCell::Type type) {
 }
 
 void PathfindingVisualizer::GenerateMaze() {
+    PROFILE_SCOPE("PathfindingVisualizer::GenerateMaze");
     // Simple maze generation - random walls
     std::random_device rd;
     std::mt19937 gen(rd());
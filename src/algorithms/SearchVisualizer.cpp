@@ -1,5 +1,6 @@
 #include "algorithms/SearchVisualizer.h"
 #include "Application.h"  // For Application class
+#include "utils/Profiler.h"
 #include <imgui.h>
 #include <algorithm>
 #include <random>
@@ -15,6 +16,7 @@ SearchVisualizer::SearchVisualizer(std::shared_ptr<AlgorithmVisualizer::AudioMan
 }
 
 void SearchVisualizer::Render() {
+    PROFILE_SCOPE("SearchVisualizer::Render");
     ImGui::Columns(2, "SearchColumns", true);
     
     // Left column - Controls only
@@ -109,6 +111,7 @@ void SearchVisualizer::Render() {
 }
 
 void SearchVisualizer::RenderControls() {
+    PROFILE_SCOPE("SearchVisualizer::RenderControls");
     ImGui::Text("Search Algorithms");
     ImGui::Separator();
     
@@ -221,6 +224,7 @@ void SearchVisualizer::RenderControls() {
 }
 
 void SearchVisualizer::RenderVisualization() {
+    PROFILE_SCOPE("SearchVisualizer::RenderVisualization");
     if (m_array.empty()) return;
     
     ImVec2 canvasPos = ImGui::GetCursorScreenPos();
@@ -306,6 +310,7 @@ void SearchVisualizer::RenderVisualization() {
 }
 
 void SearchVisualizer::RenderStatistics() {
+    PROFILE_SCOPE("SearchVisualizer::RenderStatistics");
     // Pulsing statistics header
     extern Application* g_application;
     if (g_application) {
@@ -350,6 +355,7 @@ void SearchVisualizer::RenderStatistics() {
 }
 
 void SearchVisualizer::Update() {
+    PROFILE_SCOPE("SearchVisualizer::Update");
     if (m_isRunning && !m_isComplete) {
         auto now = std::chrono::high_resolution_clock::now();
         auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lastStepTime);
@@ -362,6 +368,7 @@ void SearchVisualizer::Update() {
 }
 
 void SearchVisualizer::GenerateArray() {
+    PROFILE_SCOPE("SearchVisualizer::GenerateArray");
     m_array.clear();
     m_array.reserve(m_arraySize);
     
@@ -382,6 +389,7 @@ void SearchVisualizer::SortArray() {
 }
 
 void SearchVisualizer::StartSearch() {
+    PROFILE_SCOPE("SearchVisualizer::StartSearch");
     ResetSearch();
     
     m_startTime = std::chrono::high_resolution_clock::now();
@@ -411,6 +419,13 @@ void SearchVisualizer::StartSearch() {
             break;
     }
     
+    if (Profiler::IsTracing()) {
+        const int64_t endNs = Profiler::NowNs();
+        const int64_t startNs = endNs - std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - m_startTime).count();
+        Profiler::TraceSpan("Steps: " + GetAlgorithmName(m_currentAlgorithm), "steps", startNs, endNs,
+                            fmt::format("\"steps\": {}, \"size\": {}", m_steps.size(), m_arraySize));
+    }
+    
     if (!m_steps.empty()) {
         m_isRunning = true;
     }
@@ -0,0 +1,242 @@
+#include "algorithms/SortingRace.h"
+#include "utils/Profiler.h"
+#include "utils/TaskPool.h"
+#include <imgui.h>
+#include <algorithm>
+#include <cmath>
+#include <fmt/format.h>
+
+namespace AlgorithmVisualizer {
+
+SortingRace::SortingRace(Renderer* renderer) : m_renderer(renderer) {
+}
+
+SortingRace::~SortingRace() {
+    Reset();
+}
+
+void SortingRace::Start(const std::vector<int>& input, const std::vector<SortingVisualizer::SortingAlgorithm>& algorithms) {
+    PROFILE_SCOPE("SortingRace::Start");
+    Reset();
+    if (algorithms.size() < MIN_LANES || input.empty() || input.size() > MAX_ARRAY_SIZE) {
+        return;
+    }
+
+    m_inputSize = input.size();
+    m_lanes.resize(algorithms.size());
+    for (size_t i = 0; i < algorithms.size(); ++i) {
+        Lane& lane = m_lanes[i];
+        lane.visualizer = std::make_unique<SortingVisualizer>(nullptr, m_renderer);
+        lane.visualizer->SetAlgorithm(algorithms[i]);
+        lane.result.algorithm = lane.visualizer->GetAlgorithmName(algorithms[i]);
+    }
+
+    // One worker per lane, so every algorithm records its steps at the same time
+    m_pool = std::make_unique<TaskPool>(m_lanes.size());
+    auto shared = std::make_shared<const std::vector<int>>(input);
+    for (Lane& lane : m_lanes) {
+        SortingVisualizer* visualizer = lane.visualizer.get();
+        lane.generation = m_pool->Submit([visualizer, shared] {
+            PROFILE_SCOPE("SortingRace::GenerateLane");
+            GenerationSpan span;
+            span.startNs = Profiler::NowNs();
+            visualizer->LoadSteps(*shared);
+            span.endNs = Profiler::NowNs();
+            return span;
+        });
+    }
+    m_state = State::Generating;
+}
+
+void SortingRace::Pause() {
+    if (m_state == State::Running) {
+        m_state = State::Paused;
+        m_pausedAt = std::chrono::steady_clock::now();
+    }
+}
+
+void SortingRace::Resume() {
+    if (m_state == State::Paused) {
+        // Shift the clock so time spent paused does not count towards finish times
+        const auto now = std::chrono::steady_clock::now();
+        m_playbackStart += now - m_pausedAt;
+        m_lastStep = now;
+        m_state = State::Running;
+    }
+}
+
+void SortingRace::Reset() {
+    m_pool.reset(); // Joins the workers, which may still be writing to lanes
+    m_lanes.clear();
+    m_state = State::Idle;
+    m_inputSize = 0;
+    m_finishedCount = 0;
+}
+
+void SortingRace::Update() {
+    PROFILE_SCOPE("SortingRace::Update");
+    if (m_state == State::Generating) {
+        CollectGenerated();
+    } else if (m_state == State::Running) {
+        const auto now = std::chrono::steady_clock::now();
+        if (now - m_lastStep >= m_stepDelay) {
+            AdvanceLanes();
+            m_lastStep = now;
+        }
+    }
+}
+
+void SortingRace::CollectGenerated() {
+    bool allReady = true;
+    for (Lane& lane : m_lanes) {
+        if (lane.ready) {
+            continue;
+        }
+        if (lane.generation.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            allReady = false;
+            continue;
+        }
+
+        const GenerationSpan span = lane.generation.get();
+        lane.ready = true;
+        lane.result.steps = lane.visualizer->GetTotalSteps();
+        lane.result.comparisons = lane.visualizer->GetComparisons();
+        lane.result.swaps = lane.visualizer->GetSwaps();
+        lane.result.generationMs = static_cast<double>(span.endNs - span.startNs) / 1e6;
+        if (Profiler::IsTracing()) {
+            Profiler::TraceSpan("Race steps: " + lane.result.algorithm, "steps", span.startNs, span.endNs,
+                                fmt::format("\"steps\": {}, \"size\": {}", lane.result.steps, m_inputSize));
+        }
+    }
+    if (!allReady) {
+        return;
+    }
+
+    // Everyone is on the line; start the clock for all lanes together
+    m_pool.reset();
+    m_playbackStart = std::chrono::steady_clock::now();
+    m_lastStep = m_playbackStart;
+    m_state = State::Running;
+}
+
+void SortingRace::AdvanceLanes() {
+    for (Lane& lane : m_lanes) {
+        if (lane.finished) {
+            continue;
+        }
+        lane.visualizer->StepForward();
+        if (lane.visualizer->GetCurrentStep() >= lane.visualizer->GetTotalSteps()) {
+            lane.finished = true;
+            lane.result.finishMs = ElapsedMs();
+            lane.result.place = ++m_finishedCount;
+        }
+    }
+
+    if (m_finishedCount == static_cast<int>(m_lanes.size())) {
+        m_state = State::Finished;
+        m_results.clear();
+        for (const Lane& lane : m_lanes) {
+            m_results.push_back(lane.result);
+        }
+        m_resultsInputSize = m_inputSize;
+        std::sort(m_results.begin(), m_results.end(),
+                  [](const LaneResult& a, const LaneResult& b) { return a.place < b.place; });
+    }
+}
+
+double SortingRace::ElapsedMs() const {
+    const auto end = m_state == State::Paused ? m_pausedAt : std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - m_playbackStart).count();
+}
+
+void SortingRace::Render() {
+    PROFILE_SCOPE("SortingRace::Render");
+    if (m_lanes.empty()) {
+        ImGui::TextDisabled("Pick at least %zu algorithms and start a race.", MIN_LANES);
+        return;
+    }
+
+    // As square a grid as the lane count allows
+    const size_t columns = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(m_lanes.size()))));
+    const size_t rows = (m_lanes.size() + columns - 1) / columns;
+    const ImVec2 spacing = ImGui::GetStyle().ItemSpacing;
+    const ImVec2 available = ImGui::GetContentRegionAvail();
+    const ImVec2 cell((available.x - spacing.x * static_cast<float>(columns - 1)) / static_cast<float>(columns),
+                      (available.y - spacing.y * static_cast<float>(rows - 1)) / static_cast<float>(rows));
+    if (cell.x <= 0.0f || cell.y <= 0.0f) {
+        return;
+    }
+
+    for (size_t i = 0; i < m_lanes.size(); ++i) {
+        if (i % columns != 0) {
+            ImGui::SameLine();
+        }
+        RenderLane(i, cell);
+    }
+}
+
+void SortingRace::RenderLane(size_t index, const ImVec2& size) const {
+    const Lane& lane = m_lanes[index];
+    if (ImGui::BeginChild(fmt::format("RaceLane{}", index).c_str(), size, true)) {
+        if (lane.finished) {
+            const ImVec4 placeColor = lane.result.place == 1 ? ImVec4(1.0f, 0.85f, 0.2f, 1.0f) : ImVec4(0.6f, 0.9f, 1.0f, 1.0f);
+            ImGui::TextColored(placeColor, "#%d %s", lane.result.place, lane.result.algorithm.c_str());
+        } else {
+            ImGui::Text("%s", lane.result.algorithm.c_str());
+        }
+
+        // Lanes still generating belong to their worker; only the name is safe to show
+        if (!lane.ready) {
+            ImGui::TextDisabled("Generating steps...");
+            ImGui::EndChild();
+            return;
+        }
+
+        // Counters as of the step on screen, so they climb while the lane plays
+        const SortingVisualizer& visualizer = *lane.visualizer;
+        const size_t step = visualizer.GetCurrentStep();
+        const auto& steps = visualizer.GetSteps();
+        const int comparisons = step > 0 ? steps[step - 1].comparisons : 0;
+        const int swaps = step > 0 ? steps[step - 1].swaps : 0;
+        const double timeMs = lane.finished ? lane.result.finishMs
+                              : m_state == State::Generating ? 0.0 : ElapsedMs();
+        ImGui::Text("Cmp %d  Swp %d  Step %zu/%zu", comparisons, swaps, step, steps.size());
+        ImGui::TextDisabled("%.2f s  (steps in %.1f ms)", timeMs / 1000.0, lane.result.generationMs);
+
+        visualizer.RenderBars(ImGui::GetContentRegionAvail());
+    }
+    ImGui::EndChild();
+}
+
+void SortingRace::RenderResultsTable() const {
+    if (m_results.empty()) {
+        ImGui::TextDisabled("No race finished yet.");
+        return;
+    }
+
+    ImGui::Text("Last race: %zu algorithms on the same %zu elements", m_results.size(), m_resultsInputSize);
+    if (ImGui::BeginTable("RaceResults", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        ImGui::TableSetupColumn("Place");
+        ImGui::TableSetupColumn("Algorithm");
+        ImGui::TableSetupColumn("Comparisons");
+        ImGui::TableSetupColumn("Swaps");
+        ImGui::TableSetupColumn("Steps");
+        ImGui::TableSetupColumn("Generation");
+        ImGui::TableSetupColumn("Finish");
+        ImGui::TableHeadersRow();
+
+        for (const LaneResult& result : m_results) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::Text("%d", result.place);
+            ImGui::TableNextColumn(); ImGui::Text("%s", result.algorithm.c_str());
+            ImGui::TableNextColumn(); ImGui::Text("%d", result.comparisons);
+            ImGui::TableNextColumn(); ImGui::Text("%d", result.swaps);
+            ImGui::TableNextColumn(); ImGui::Text("%zu", result.steps);
+            ImGui::TableNextColumn(); ImGui::Text("%.2f ms", result.generationMs);
+            ImGui::TableNextColumn(); ImGui::Text("%.2f s", result.finishMs / 1000.0);
+        }
+        ImGui::EndTable();
+    }
+}
+
+} // namespace AlgorithmVisualizer
@@ -1,5 +1,8 @@
 #include "algorithms/SortingVisualizer.h"
+#include "algorithms/SortingRace.h"
 #include "audio/AudioManager.h"
+#include "utils/Profiler.h"
+#include "utils/TaskPool.h"
 #include "utils/Timer.h"
 #include "Application.h"  // For Application class
 
@@ -13,13 +16,30 @@
 
 namespace AlgorithmVisualizer {
 
-SortingVisualizer::SortingVisualizer(AudioManager* audioManager) 
-    : m_randomGenerator(m_randomDevice()), m_audioManager(audioManager) {
+SortingVisualizer::SortingVisualizer(AudioManager* audioManager, Renderer* renderer) 
+    : m_randomGenerator(m_randomDevice()), m_audioManager(audioManager), m_renderer(renderer) {
     SetArraySize(m_arraySize);
     GenerateRandomArray();
 }
 
+SortingVisualizer::~SortingVisualizer() = default;
+
+bool SortingVisualizer::IsAnimating() const {
+    return m_state == AnimationState::Running || (m_raceMode && m_race && m_race->IsActive()) ||
+           IsExportingSonification();
+}
+
 void SortingVisualizer::Update() {
+    PROFILE_SCOPE("SortingVisualizer::Update");
+    PollSonificationExport();
+    if (m_raceMode) {
+        if (m_race) {
+            m_race->SetStepDelay(m_stepDelay);
+            m_race->Update();
+        }
+        return;
+    }
+    
     if (m_state == AnimationState::Running) {
         auto now = std::chrono::steady_clock::now();
         auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lastUpdate);
@@ -37,6 +57,7 @@ void SortingVisualizer::Update() {
 }
 
 void SortingVisualizer::Render() {
+    PROFILE_SCOPE("SortingVisualizer::Render");
     ImGui::Columns(2, "SortingColumns", true);
     
     // Left column - Controls only
@@ -44,11 +65,31 @@ void SortingVisualizer::Render() {
     
     ImGui::NextColumn();
     
+    // Race mode - the right column is the grid of lanes
+    extern Application* g_application;
+    if (m_raceMode) {
+        if (g_application) {
+            ImVec2 racePanelPos = ImGui::GetCursorScreenPos();
+            ImVec2 racePanelSize = ImGui::GetContentRegionAvail();
+            g_application->DrawNeonBorder(racePanelPos, ImVec2(racePanelPos.x + racePanelSize.x, racePanelPos.y + racePanelSize.y), 
+                                         ImVec4(1.0f, 0.0f, 1.0f, 0.4f));
+        }
+        if (ImGui::BeginChild("RacePanel", ImVec2(0, 0), true)) {
+            if (m_race) {
+                m_race->Render();
+            } else {
+                ImGui::TextDisabled("Pick at least %zu algorithms and start a race.", SortingRace::MIN_LANES);
+            }
+        }
+        ImGui::EndChild();
+        ImGui::Columns(1);
+        return;
+    }
+    
     // Right column - split into top (statistics/info) and bottom (visualization)
     float rightColumnHeight = ImGui::GetContentRegionAvail().y;
     
     // Top right - Statistics and Algorithm Info with retro styling
-    extern Application* g_application;
     if (g_application) {
         // Draw glowing panel border
         ImVec2 panelPos = ImGui::GetCursorScreenPos();
@@ -158,6 +199,7 @@ void SortingVisualizer::Render() {
 }
 
 void SortingVisualizer::RenderControls() {
+    PROFILE_SCOPE("SortingVisualizer::RenderControls");
     ImGui::Text("Sorting Controls");
     
     // Animated separator for retro feel
@@ -168,8 +210,16 @@ void SortingVisualizer::RenderControls() {
         ImGui::Separator();
     }
     
+    // Race mode swaps the single run for several side by side
+    if (ImGui::Checkbox("Race Mode", &m_raceMode)) {
+        PauseSorting();
+        if (!m_raceMode && m_race) {
+            m_race->Pause();
+        }
+    }
+    
     // Algorithm selection
-    if (ImGui::Combo("Algorithm", &m_selectedAlgorithm, m_algorithmNames, 9)) {
+    if (!m_raceMode && ImGui::Combo("Algorithm", &m_selectedAlgorithm, m_algorithmNames, 9)) {
         SetAlgorithm(static_cast<SortingAlgorithm>(m_selectedAlgorithm));
         ResetArray();
     }
@@ -200,6 +250,37 @@ void SortingVisualizer::RenderControls() {
             m_audioManager->SetMasterVolume(m_audioVolume);
         }
     }
+    if (m_audioEnabled && m_audioManager) {
+        const AudioManager::QueueStats queue = m_audioManager->GetQueueStats();
+        ImGui::TextDisabled("Sound queue: %zu/%zu, %llu dropped", queue.depth, queue.capacity,
+                            static_cast<unsigned long long>(queue.dropped));
+        const EventCoalescer::Stats merging = m_audioManager->GetCoalescerStats();
+        ImGui::TextDisabled("Sounds: %llu played, %llu merged, %llu over the rate cap",
+                            static_cast<unsigned long long>(merging.played),
+                            static_cast<unsigned long long>(merging.merged),
+                            static_cast<unsigned long long>(merging.rateLimited));
+        if (m_audioManager->GetBackendType() == AudioManager::BackendType::OpenAL) {
+            const AudioManager::DeviceStats device = m_audioManager->GetDeviceStats();
+            if (device.streaming) {
+                ImGui::TextDisabled("Mixer stream: %llu underruns", static_cast<unsigned long long>(device.streamUnderruns));
+            } else {
+                ImGui::TextDisabled("AL sources: %llu sounds dropped, all busy",
+                                    static_cast<unsigned long long>(device.sourcesExhausted));
+            }
+        }
+    }
+
+    ImGui::BeginDisabled(IsExportingSonification());
+    if (ImGui::Button("Export Sound (WAV)")) {
+        std::string path = GetAlgorithmName(m_currentAlgorithm) + " sonification.wav";
+        std::replace(path.begin(), path.end(), ' ', '_');
+        StartSonificationExport(path);
+    }
+    ImGui::EndDisabled();
+    if (!m_sonificationStatus.empty()) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("%s", m_sonificationStatus.c_str());
+    }
     
     ImGui::Spacing();
     
@@ -222,6 +303,11 @@ void SortingVisualizer::RenderControls() {
     
     ImGui::Spacing();
     
+    if (m_raceMode) {
+        RenderRaceControls();
+        return;
+    }
+    
     // Playback controls
     ImGui::Text("Playback Controls:");
     
@@ -295,6 +381,7 @@ void SortingVisualizer::RenderControls() {
 }
 
 void SortingVisualizer::RenderStatistics() {
+    PROFILE_SCOPE("SortingVisualizer::RenderStatistics");
     // Pulsing statistics header
     extern Application* g_application;
     if (g_application) {
@@ -335,11 +422,39 @@ void SortingVisualizer::RenderStatistics() {
 }
 
 void SortingVisualizer::RenderVisualization() {
+    PROFILE_SCOPE("SortingVisualizer::RenderVisualization");
     ImGui::Text("Array Visualization");
     ImGui::Separator();
     
     if (m_array.empty()) return;
     
+    // Create a bar chart visualization
+    ImVec2 canvas_size = ImGui::GetContentRegionAvail();
+    canvas_size.y = std::min(canvas_size.y, 400.0f);
+    RenderBars(canvas_size);
+    
+    // Legend
+    ImGui::Spacing();
+    ImGui::Text("Legend:");
+    ImGui::SameLine(); ImGui::ColorButton("Default", ImVec4(100/255.0f, 150/255.0f, 200/255.0f, 1.0f), ImGuiColorEditFlags_NoTooltip);
+    ImGui::SameLine(); ImGui::Text("Normal");
+    
+    ImGui::SameLine(); ImGui::ColorButton("Compare", ImVec4(1.0f, 1.0f, 0.0f, 1.0f), ImGuiColorEditFlags_NoTooltip);
+    ImGui::SameLine(); ImGui::Text("Comparing");
+    
+    ImGui::SameLine(); ImGui::ColorButton("Swap", ImVec4(1.0f, 0.0f, 0.0f, 1.0f), ImGuiColorEditFlags_NoTooltip);
+    ImGui::SameLine(); ImGui::Text("Swapping");
+    
+    ImGui::SameLine(); ImGui::ColorButton("Pivot", ImVec4(1.0f, 165/255.0f, 0.0f, 1.0f), ImGuiColorEditFlags_NoTooltip);
+    ImGui::SameLine(); ImGui::Text("Pivot");
+}
+
+void SortingVisualizer::RenderBars(const ImVec2& canvas_size) const {
+    if (m_array.empty()) {
+        ImGui::Dummy(canvas_size);
+        return;
+    }
+    
     // Get the current step for highlighting
     int comp1 = -1, comp2 = -1, pivot = -1;
     bool swapped = false;
@@ -352,60 +467,52 @@ void SortingVisualizer::RenderVisualization() {
         swapped = step.swapped;
     }
     
-    // Create a bar chart visualization
     ImVec2 canvas_pos = ImGui::GetCursorScreenPos();
-    ImVec2 canvas_size = ImGui::GetContentRegionAvail();
-    canvas_size.y = std::min(canvas_size.y, 400.0f);
     
     ImDrawList* draw_list = ImGui::GetWindowDrawList();
     
     if (canvas_size.x > 0 && canvas_size.y > 0) {
+        // Colors by current operation
+        enum BarColor : uint32_t { Normal, Pivot, Swapping, Comparing };
+        static constexpr ImU32 palette[] = {
+            IM_COL32(100, 150, 200, 255), // Default blue
+            IM_COL32(255, 165, 0, 255),   // Orange for pivot
+            IM_COL32(255, 0, 0, 255),     // Red for elements being swapped
+            IM_COL32(255, 255, 0, 255)    // Yellow for elements being compared
+        };
+        
         // Calculate bar dimensions
         float bar_width = canvas_size.x / static_cast<float>(m_array.size());
         int max_value = *std::max_element(m_array.begin(), m_array.end());
         
+        m_barInstances.resize(m_array.size());
         for (size_t i = 0; i < m_array.size(); ++i) {
             float bar_height = (static_cast<float>(m_array[i]) / static_cast<float>(max_value)) * canvas_size.y;
             
-            ImVec2 bar_min(canvas_pos.x + static_cast<float>(i) * bar_width, 
-                          canvas_pos.y + canvas_size.y - bar_height);
-            ImVec2 bar_max(canvas_pos.x + static_cast<float>(i + 1) * bar_width - 1, 
-                          canvas_pos.y + canvas_size.y);
-            
-            // Choose color based on current operation
-            ImU32 color = IM_COL32(100, 150, 200, 255); // Default blue
-            
+            uint32_t color = Normal;
             if (static_cast<int>(i) == pivot) {
-                color = IM_COL32(255, 165, 0, 255); // Orange for pivot
+                color = Pivot;
             } else if (static_cast<int>(i) == comp1 || static_cast<int>(i) == comp2) {
-                if (swapped) {
-                    color = IM_COL32(255, 0, 0, 255); // Red for elements being swapped
-                } else {
-                    color = IM_COL32(255, 255, 0, 255); // Yellow for elements being compared
-                }
+                color = swapped ? Swapping : Comparing;
             }
             
-            draw_list->AddRectFilled(bar_min, bar_max, color);
-            draw_list->AddRect(bar_min, bar_max, IM_COL32(50, 50, 50, 255));
+            m_barInstances[i] = {static_cast<float>(i) * bar_width, canvas_size.y - bar_height,
+                                 bar_width - 1.0f, bar_height, color};
+        }
+        
+        Renderer::Batch batch;
+        batch.palette = palette;
+        batch.instances = m_barInstances;
+        batch.outlineColor = IM_COL32(50, 50, 50, 255);
+        batch.outlineWidth = 1.0f;
+        if (m_renderer) {
+            m_renderer->Draw(draw_list, canvas_pos, canvas_size, batch);
+        } else {
+            Renderer::DrawWithImGui(draw_list, canvas_pos, batch);
         }
     }
     
     ImGui::Dummy(canvas_size);
-    
-    // Legend
-    ImGui::Spacing();
-    ImGui::Text("Legend:");
-    ImGui::SameLine(); ImGui::ColorButton("Default", ImVec4(100/255.0f, 150/255.0f, 200/255.0f, 1.0f), ImGuiColorEditFlags_NoTooltip);
-    ImGui::SameLine(); ImGui::Text("Normal");
-    
-    ImGui::SameLine(); ImGui::ColorButton("Compare", ImVec4(1.0f, 1.0f, 0.0f, 1.0f), ImGuiColorEditFlags_NoTooltip);
-    ImGui::SameLine(); ImGui::Text("Comparing");
-    
-    ImGui::SameLine(); ImGui::ColorButton("Swap", ImVec4(1.0f, 0.0f, 0.0f, 1.0f), ImGuiColorEditFlags_NoTooltip);
-    ImGui::SameLine(); ImGui::Text("Swapping");
-    
-    ImGui::SameLine(); ImGui::ColorButton("Pivot", ImVec4(1.0f, 165/255.0f, 0.0f, 1.0f), ImGuiColorEditFlags_NoTooltip);
-    ImGui::SameLine(); ImGui::Text("Pivot");
 }
 
 void SortingVisualizer::StartSorting() {
@@ -415,30 +522,12 @@ void SortingVisualizer::StartSorting() {
         m_totalComparisons = 0;
         m_totalSwaps = 0;
         
-        ClearSteps();
-        m_comparisons = 0;
-        m_swaps = 0;
-        
-        Timer timer;
-        timer.Start();
-        
-        // Execute the selected sorting algorithm
-        switch (m_currentAlgorithm) {
-            case SortingAlgorithm::BubbleSort: BubbleSort(); break;
-            case SortingAlgorithm::SelectionSort: SelectionSort(); break;
-            case SortingAlgorithm::InsertionSort: InsertionSort(); break;
-            case SortingAlgorithm::QuickSort: QuickSort(); break;
-            case SortingAlgorithm::MergeSort: MergeSort(); break;
-            case SortingAlgorithm::HeapSort: HeapSort(); break;
-            case SortingAlgorithm::TournamentSort: TournamentSort(); break;
-            case SortingAlgorithm::IntroSort: IntroSort(); break;
-            case SortingAlgorithm::PatienceSort: PatienceSort(); break;
+        const int64_t generationStart = Profiler::NowNs();
+        GenerateSteps();
+        if (Profiler::IsTracing()) {
+            Profiler::TraceSpan("Steps: " + GetAlgorithmName(m_currentAlgorithm), "steps", generationStart, Profiler::NowNs(),
+                                fmt::format("\"steps\": {}, \"size\": {}", m_sortingSteps.size(), m_array.size()));
         }
-        
-        timer.Stop();
-        m_algorithmGenerationTime = timer.GetElapsed();
-        
-        m_currentStepIndex = 0;
     }
     
     m_state = AnimationState::Running;
@@ -450,6 +539,179 @@ void SortingVisualizer::StartSorting() {
     m_currentAnimationTime = std::chrono::milliseconds(0);
 }
 
+void SortingVisualizer::GenerateSteps() {
+    PROFILE_SCOPE("SortingVisualizer::GenerateSteps");
+    ClearSteps();
+    m_comparisons = 0;
+    m_swaps = 0;
+    
+    Timer timer;
+    timer.Start();
+    
+    // Execute the selected sorting algorithm
+    switch (m_currentAlgorithm) {
+        case SortingAlgorithm::BubbleSort: BubbleSort(); break;
+        case SortingAlgorithm::SelectionSort: SelectionSort(); break;
+        case SortingAlgorithm::InsertionSort: InsertionSort(); break;
+        case SortingAlgorithm::QuickSort: QuickSort(); break;
+        case SortingAlgorithm::MergeSort: MergeSort(); break;
+        case SortingAlgorithm::HeapSort: HeapSort(); break;
+        case SortingAlgorithm::TournamentSort: TournamentSort(); break;
+        case SortingAlgorithm::IntroSort: IntroSort(); break;
+        case SortingAlgorithm::PatienceSort: PatienceSort(); break;
+    }
+    
+    timer.Stop();
+    m_algorithmGenerationTime = timer.GetElapsed();
+    
+    m_currentStepIndex = 0;
+}
+
+void SortingVisualizer::LoadSteps(const std::vector<int>& input) {
+    PROFILE_SCOPE("SortingVisualizer::LoadSteps");
+    m_state = AnimationState::Stopped;
+    m_arraySize = static_cast<int>(input.size());
+    m_originalArray = input;
+    m_array = input;
+    GenerateSteps();
+}
+
+void SortingVisualizer::StartRace() {
+    std::vector<SortingAlgorithm> algorithms;
+    for (int i = 0; i < 9; ++i) {
+        if (m_raceSelection[i]) {
+            algorithms.push_back(static_cast<SortingAlgorithm>(i));
+        }
+    }
+    if (!m_race) {
+        m_race = std::make_unique<SortingRace>(m_renderer);
+    }
+    m_race->SetStepDelay(m_stepDelay);
+    m_race->Start(m_originalArray, algorithms);
+}
+
+void SortingVisualizer::RenderRaceControls() {
+    PROFILE_SCOPE("SortingVisualizer::RenderRaceControls");
+    ImGui::Text("Race Lineup:");
+    int selected = 0;
+    for (int i = 0; i < 9; ++i) {
+        if (i % 2 != 0) {
+            ImGui::SameLine(ImGui::GetContentRegionAvail().x * 0.5f);
+        }
+        ImGui::Checkbox(m_algorithmNames[i], &m_raceSelection[i]);
+        selected += m_raceSelection[i] ? 1 : 0;
+    }
+    
+    ImGui::Spacing();
+    ImGui::Text("Race Controls:");
+    
+    const bool tooLarge = m_originalArray.size() > SortingRace::MAX_ARRAY_SIZE;
+    const bool canStart = selected >= static_cast<int>(SortingRace::MIN_LANES) && !tooLarge;
+    const SortingRace::State state = m_race ? m_race->GetState() : SortingRace::State::Idle;
+    
+    ImGui::BeginDisabled(!canStart);
+    if (ImGui::Button(state == SortingRace::State::Idle ? "Start Race" : "Restart Race")) {
+        StartRace();
+    }
+    ImGui::EndDisabled();
+    
+    if (state == SortingRace::State::Running) {
+        ImGui::SameLine();
+        if (ImGui::Button("Pause")) {
+            m_race->Pause();
+        }
+    } else if (state == SortingRace::State::Paused) {
+        ImGui::SameLine();
+        if (ImGui::Button("Resume")) {
+            m_race->Resume();
+        }
+    }
+    if (state != SortingRace::State::Idle) {
+        ImGui::SameLine();
+        if (ImGui::Button("Reset")) {
+            m_race->Reset();
+        }
+    }
+    
+    if (tooLarge) {
+        ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.3f, 1.0f), "Races take at most %zu elements", SortingRace::MAX_ARRAY_SIZE);
+    } else if (selected < static_cast<int>(SortingRace::MIN_LANES)) {
+        ImGui::TextDisabled("Select at least %zu algorithms", SortingRace::MIN_LANES);
+    } else if (state == SortingRace::State::Generating) {
+        ImGui::TextDisabled("Generating steps, one worker per lane...");
+    }
+    
+    ImGui::Spacing();
+    ImGui::Text("Results:");
+    if (m_race) {
+        m_race->RenderResultsTable();
+    } else {
+        ImGui::TextDisabled("No race finished yet.");
+    }
+}
+
+// Replays every recorded step into a WAV file at the current animation speed. Only
+// each step's sound goes to the worker, so the steps can be reset while it renders.
+void SortingVisualizer::StartSonificationExport(const std::string& path) {
+    if (IsExportingSonification()) {
+        return;
+    }
+    if (m_sortingSteps.empty()) {
+        GenerateSteps();
+    }
+    
+    std::vector<StepSound> sounds;
+    sounds.reserve(m_sortingSteps.size());
+    for (const auto& step : m_sortingSteps) {
+        sounds.push_back(GetStepSound(step));
+    }
+    
+    if (!m_sonificationPool) {
+        m_sonificationPool = std::make_unique<TaskPool>(1);
+    }
+    const double stepSeconds = std::chrono::duration<double>(m_stepDelay).count();
+    const float volume = m_audioVolume;
+    m_sonificationPath = path;
+    m_sonificationStatus = "Exporting " + path + "...";
+    m_sonificationResult = m_sonificationPool->Submit([sounds = std::move(sounds), stepSeconds, volume, path] {
+        return RenderSonification(sounds, stepSeconds, volume, path);
+    });
+}
+
+void SortingVisualizer::PollSonificationExport() {
+    if (!IsExportingSonification() ||
+        m_sonificationResult.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        return;
+    }
+    
+    bool saved = false;
+    try {
+        saved = m_sonificationResult.get();
+    } catch (const std::exception& e) {
+        fmt::print("Sonification export failed: {}\n", e.what());
+    }
+    m_sonificationStatus = saved ? "Saved " + m_sonificationPath : "Could not write " + m_sonificationPath;
+}
+
+// The steps are rendered back to back, so a run of minutes takes well under a second
+bool SortingVisualizer::RenderSonification(const std::vector<StepSound>& sounds, double stepSeconds, float volume,
+                                           const std::string& path) {
+    PROFILE_SCOPE("SortingVisualizer::RenderSonification");
+    AudioManager offline;
+    if (!offline.Initialize(AudioManager::BackendType::WavFile, path)) {
+        return false;
+    }
+    offline.SetMasterVolume(volume);
+    
+    for (const StepSound& sound : sounds) {
+        PlayStepSound(offline, sound);
+        offline.Advance(stepSeconds);
+    }
+    offline.PlayCompletionSound();
+    offline.Advance(SONIFICATION_TAIL_SECONDS);
+    return offline.Shutdown();
+}
+
 void SortingVisualizer::PauseSorting() {
     if (m_state == AnimationState::Running) {
         m_state = AnimationState::Paused;
@@ -529,6 +791,7 @@ void SortingVisualizer::SetAlgorithm(SortingAlgorithm algorithm) {
 }
 
 void SortingVisualizer::GenerateRandomArray() {
+    PROFILE_SCOPE("SortingVisualizer::GenerateRandomArray");
     m_array.clear();
     m_array.reserve(m_arraySize);
     
@@ -541,6 +804,7 @@ void SortingVisualizer::GenerateRandomArray() {
 }
 
 void SortingVisualizer::GenerateReversedArray() {
+    PROFILE_SCOPE("SortingVisualizer::GenerateReversedArray");
     m_array.clear();
     m_array.reserve(m_arraySize);
     
@@ -552,6 +816,7 @@ void SortingVisualizer::GenerateReversedArray() {
 }
 
 void SortingVisualizer::GenerateNearlySortedArray() {
+    PROFILE_SCOPE("SortingVisualizer::GenerateNearlySortedArray");
     m_array.clear();
     m_array.reserve(m_arraySize);
     
@@ -805,6 +1070,8 @@ void SortingVisualizer::RecordStep(const std::vector<int>& array, int comp1, int
     step.pivotIndex = pivot;
     step.swapped = swapped;
     step.description = desc;
+    step.comparisons = m_comparisons;
+    step.swaps = m_swaps;
     
     m_sortingSteps.push_back(step);
 }
@@ -821,18 +1088,32 @@ void SortingVisualizer::ExecuteCurrentStep() {
         
         // Play live audio feedback
         if (m_audioManager && m_audioEnabled) {
-            if (step.swapped) {
-                m_audioManager->PlaySwapSound();
-            } else if (step.compareIndex1 >= 0 && step.compareIndex2 >= 0) {
-                int maxVal = *std::max_element(step.array.begin(), step.array.end());
-                float avgValue = (step.array[step.compareIndex1] + step.array[step.compareIndex2]) / 2.0f;
-                float pitch = 0.5f + (avgValue / maxVal) * 1.0f;
-                m_audioManager->PlayComparisonSound(pitch);
-            }
+            PlayStepSound(*m_audioManager, GetStepSound(step));
         }
     }
 }
 
+SortingVisualizer::StepSound SortingVisualizer::GetStepSound(const SortingStep& step) {
+    StepSound sound;
+    if (step.swapped) {
+        sound.kind = StepSound::Kind::Swap;
+    } else if (step.compareIndex1 >= 0 && step.compareIndex2 >= 0) {
+        int maxVal = *std::max_element(step.array.begin(), step.array.end());
+        float avgValue = (step.array[step.compareIndex1] + step.array[step.compareIndex2]) / 2.0f;
+        sound.kind = StepSound::Kind::Comparison;
+        sound.pitch = 0.5f + (avgValue / maxVal) * 1.0f;
+    }
+    return sound;
+}
+
+void SortingVisualizer::PlayStepSound(AudioManager& audio, const StepSound& sound) {
+    switch (sound.kind) {
+    case StepSound::Kind::Swap: audio.PlaySwapSound(); break;
+    case StepSound::Kind::Comparison: audio.PlayComparisonSound(sound.pitch); break;
+    case StepSound::Kind::None: break;
+    }
+}
+
 // Tournament Sort Implementation
 void SortingVisualizer::TournamentSort() {
     auto arr = m_array;
@@ -1,17 +1,101 @@
 #include "algorithms/TreeVisualizer.h"
 #include "Application.h"  // For Application class
+#include "utils/Profiler.h"
+#include "utils/TaskPool.h"
 #include <imgui.h>
 #include <algorithm>
+#include <bit>
 #include <cmath>
+#include <fstream>
+#include <random>
+#include <unordered_map>
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 
 namespace AlgorithmVisualizer {
 
+namespace {
+constexpr int HEAP_ITEM_CAPACITY = 1024;
+constexpr int HEAP_ARITIES[] = { 2, 4, 8 };
+constexpr const char* HEAP_ARITY_NAMES[] = { "Binary (d=2)", "4-ary", "8-ary" };
+
+// Binary tree view
+constexpr float VIEW_MARGIN = 20.0f;
+constexpr float VIEW_TOP_MARGIN = 50.0f;
+constexpr float MAX_UNIT_WIDTH = 50.0f;   // Horizontal pixels per key when fully zoomed in
+constexpr float MAX_LEVEL_HEIGHT = 60.0f;
+constexpr float MIN_LEVEL_HEIGHT = 4.0f;
+constexpr float COLLAPSE_WIDTH = 8.0f;    // Subtrees narrower than this draw as one triangle
+constexpr float MIN_NODE_RADIUS = 2.0f;
+constexpr float MAX_NODE_RADIUS = 20.0f;
+constexpr float LABEL_NODE_RADIUS = 10.0f;
+
+// Frozen layout strip under the tree
+constexpr float FROZEN_ROW_HEIGHT = 18.0f;
+constexpr float FROZEN_MIN_CELL = 4.0f;   // Narrowest slot cell; the rest of the array shows only in the overview
+constexpr float FROZEN_LABEL_CELL = 28.0f;
+constexpr int CACHE_LINE_BYTES = 64;
+
+// Patricia trie view and scan results
+constexpr size_t TRIE_MATCH_LIMIT = 100;
+constexpr size_t TRIE_DRAW_LIMIT = 300;   // Nodes drawn; a larger trie is cut to the levels that fit
+constexpr size_t TRIE_EDGE_LABEL = 10;
+
+// Segment / Fenwick tree element array
+constexpr int MIN_RANGE_ELEMENTS = 4;
+constexpr int MAX_RANGE_ELEMENTS = 64;
+
+// Background jobs
+constexpr int MIN_JOB_OPERATIONS = 1000;
+constexpr int MAX_JOB_OPERATIONS = 2000000;
+constexpr int JOB_BATCH = 1024;           // Operations between cancel checks and progress updates
+constexpr auto SNAPSHOT_INTERVAL = std::chrono::milliseconds(100);
+constexpr int SNAPSHOT_COST_FACTOR = 4;   // Wait at least 4x the last build before the next one
+constexpr double RATE_INTERVAL_SECONDS = 0.25;
+
+// Traversals of large trees record one step per key only up to this many keys, then summarize
+constexpr size_t TRAVERSAL_STEP_LIMIT = 500;
+constexpr size_t TRAVERSAL_DISPLAY_LIMIT = 500;
+
+// Non-printable bytes show as '.', long labels are cut with ".."
+std::string PrintableLabel(std::string_view text, size_t maxLength) {
+    std::string label;
+    for (char c : text.substr(0, maxLength)) {
+        label += (c >= 32 && c < 127) ? c : '.';
+    }
+    if (text.size() > maxLength) {
+        label += "..";
+    }
+    return label;
+}
+
+bool ContainsKey(const TreeNode* node, int value) {
+    while (node && node->value != value) {
+        node = value < node->value ? node->left.get() : node->right.get();
+    }
+    return node != nullptr;
+}
+}
+
 TreeVisualizer::TreeVisualizer(std::shared_ptr<AlgorithmVisualizer::AudioManager> audioManager)
     : m_audioManager(audioManager) {
 }
 
+TreeVisualizer::~TreeVisualizer() {
+    if (m_jobThread.joinable()) {
+        m_jobCancel.store(true, std::memory_order_relaxed);
+        m_jobThread.join();
+    }
+}
+
 void TreeVisualizer::Render() {
+    PROFILE_SCOPE("TreeVisualizer::Render");
+    PollBackgroundJob();
+    PollBenchmark();
+    if (m_layoutDirty && !IsBackgroundJobRunning()) {
+        BuildLayout();
+    }
+    
     ImGui::Columns(2, "TreeColumns", true);
     
     // Left column - Controls only
@@ -75,11 +159,11 @@ void TreeVisualizer::Render() {
                 ImGui::Text("Rotations: Left, Right, Left-Right, Right-Left");
                 break;
             case TreeAlgorithm::MinHeap:
-                ImGui::TextWrapped("Min Heap is complete binary tree where parent ≤ children, root is minimum.");
+                ImGui::TextWrapped("Min Heap is complete d-ary tree where parent ≤ children, root is minimum.");
                 ImGui::Text("Time: O(log n) insert/delete, O(1) min, Space: O(n)");
                 ImGui::Text("Array implementation, complete tree");
                 ImGui::Spacing();
-                ImGui::Text("Parent at i, children at 2i+1 and 2i+2");
+                ImGui::Text("Parent at (i-1)/d, children at di+1 .. di+d");
                 ImGui::Text("Heapify operations maintain heap property");
                 break;
             case TreeAlgorithm::MaxHeap:
@@ -96,8 +180,97 @@ void TreeVisualizer::Render() {
                 ImGui::Text("Balanced using colors and rotations");
                 ImGui::Spacing();
                 ImGui::Text("Rules: Root black, no red-red parent-child");
+                ImGui::Text("Left-leaning: red children hang on the left");
                 ImGui::Text("Used in many standard libraries");
                 break;
+            case TreeAlgorithm::BTree:
+                ImGui::TextWrapped("B-Tree stores up to 'order' sorted keys per node, so one node visit replaces several binary comparisons.");
+                ImGui::Text("Time: O(log_m n) nodes, O(log m) per node, Space: O(n)");
+                ImGui::Text("Full nodes split, underfull nodes borrow or merge");
+                ImGui::Spacing();
+                ImGui::Text("All leaves at the same depth");
+                ImGui::Text("Keys live in internal nodes and leaves");
+                break;
+            case TreeAlgorithm::PairingHeap:
+                ImGui::TextWrapped("Pairing Heap is a heap-ordered multi-way tree; insert and meld just link two roots.");
+                ImGui::Text("Time: O(1) insert, O(log n) amortized pop");
+                ImGui::Text("Decrease-key cuts the subtree and melds it");
+                ImGui::Spacing();
+                ImGui::Text("Pop pairs up the root's children left to right,");
+                ImGui::Text("then melds the pairs right to left");
+                break;
+            case TreeAlgorithm::RadixHeap:
+                ImGui::TextWrapped("Radix Heap is a monotone priority queue: keys are never below the last extracted key.");
+                ImGui::Text("Time: O(1) push, O(log C) amortized pop");
+                ImGui::Text("Bucket i holds keys differing from last in bit i-1");
+                ImGui::Spacing();
+                ImGui::Text("Pop redistributes the first non-empty bucket");
+                ImGui::Text("Fits Dijkstra with integer edge weights");
+                break;
+            case TreeAlgorithm::SkipList:
+                ImGui::TextWrapped("Skip List is a sorted linked list with express lanes: each node gets a random tower height.");
+                ImGui::Text("Time: O(log n) expected, Space: O(n) expected");
+                ImGui::Text("Search moves right, then drops a level");
+                ImGui::Spacing();
+                ImGui::Text("Tower height is geometric with p = 1/2");
+                ImGui::Text("Lock-free variant: see the concurrency benchmark");
+                break;
+            case TreeAlgorithm::SplayTree:
+                ImGui::TextWrapped("Splay Tree moves every accessed node to the root with zig, zig-zig and zig-zag rotations.");
+                ImGui::Text("Time: O(log n) amortized, Space: O(n)");
+                ImGui::Text("No balance information stored");
+                ImGui::Spacing();
+                ImGui::Text("Recently used keys stay near the root");
+                ImGui::Text("Wins on skewed and sequential access");
+                break;
+            case TreeAlgorithm::Treap:
+                ImGui::TextWrapped("Treap is a BST on keys and a max-heap on random priorities (shown under each node).");
+                ImGui::Text("Time: O(log n) expected, Space: O(n)");
+                ImGui::Text("Shape matches a random insertion order");
+                ImGui::Spacing();
+                ImGui::Text("Insert: rotate up while priority > parent");
+                ImGui::Text("Delete: rotate down, then cut the leaf");
+                break;
+            case TreeAlgorithm::AdaptiveRadixTree:
+                ImGui::TextWrapped("Adaptive Radix Tree branches on one key byte per level; each node picks the smallest layout that fits its children.");
+                ImGui::Text("Time: O(k) for k key bytes, independent of n");
+                ImGui::Text("Node4 -> Node16 -> Node48 -> Node256 as it fills");
+                ImGui::Spacing();
+                ImGui::Text("Single-child paths collapse into a prefix");
+                ImGui::Text("Leaves hang at the first distinguishing byte");
+                break;
+            case TreeAlgorithm::SegmentTree:
+                ImGui::TextWrapped("Segment Tree stores the sum and minimum of every aligned block; a range is the union of O(log n) blocks.");
+                ImGui::Text("Time: O(log n) range add and range query");
+                ImGui::Text("Iterative bottom-up, heap-indexed nodes");
+                ImGui::Spacing();
+                ImGui::Text("Range add tags the covering nodes (+x, lazy)");
+                ImGui::Text("Queries push tags down the boundary paths");
+                break;
+            case TreeAlgorithm::FenwickTree:
+                ImGui::TextWrapped("Fenwick Tree answers prefix sums by hopping i -= i & -i; node i covers (i - lowbit(i), i].");
+                ImGui::Text("Time: O(log n) range add and range sum");
+                ImGui::Text("Space: two arrays of n + 1 integers");
+                ImGui::Spacing();
+                ImGui::Text("Sum(l, r) = prefix(r + 1) - prefix(l)");
+                ImGui::Text("Green nodes add, red nodes subtract");
+                break;
+            case TreeAlgorithm::PatriciaTrie:
+                ImGui::TextWrapped("Patricia Trie compresses every chain of single-child nodes into one edge labelled with a byte string.");
+                ImGui::Text("Time: O(k) for a k-byte word, independent of n");
+                ImGui::Text("Nodes: fewer than 2 per word");
+                ImGui::Spacing();
+                ImGui::Text("Prefix scan: walk to the prefix, list the subtree");
+                ImGui::Text("Green nodes end a word");
+                break;
+            case TreeAlgorithm::BPlusTree:
+                ImGui::TextWrapped("B+ Tree keeps every key in the leaves; internal keys only route searches.");
+                ImGui::Text("Time: O(log_m n) search, O(log_m n + k) range scan");
+                ImGui::Text("Leaves are chained left to right");
+                ImGui::Spacing();
+                ImGui::Text("Range scans walk the leaf chain");
+                ImGui::Text("Used by databases and file systems");
+                break;
         }
         
         ImGui::Columns(1);
@@ -128,12 +301,17 @@ void TreeVisualizer::Render() {
 }
 
 void TreeVisualizer::RenderControls() {
+    PROFILE_SCOPE("TreeVisualizer::RenderControls");
     ImGui::Text("Tree Algorithms");
     ImGui::Separator();
     
+    // The worker owns the tree while a job runs
+    const bool jobRunning = IsBackgroundJobRunning();
+    ImGui::BeginDisabled(jobRunning);
+    
     // Algorithm selection
     if (ImGui::Combo("Tree Type", reinterpret_cast<int*>(&m_currentAlgorithm), 
-                     s_algorithmNames, static_cast<int>(TreeAlgorithm::RedBlackTree) + 1)) {
+                     s_algorithmNames, IM_ARRAYSIZE(s_algorithmNames))) {
         ClearTree();
         ResetVisualization();
     }
@@ -173,6 +351,195 @@ void TreeVisualizer::RenderControls() {
         ResetVisualization();
     }
     
+    if (m_currentAlgorithm == TreeAlgorithm::MinHeap || m_currentAlgorithm == TreeAlgorithm::MaxHeap) {
+        int arityIndex = static_cast<int>(std::find(std::begin(HEAP_ARITIES), std::end(HEAP_ARITIES), m_heapArity) -
+                                          std::begin(HEAP_ARITIES));
+        if (ImGui::Combo("Heap Arity", &arityIndex, HEAP_ARITY_NAMES, IM_ARRAYSIZE(HEAP_ARITY_NAMES))) {
+            m_heapArity = HEAP_ARITIES[arityIndex];
+            RebuildHeap();
+        }
+    }
+    
+    if (m_currentAlgorithm == TreeAlgorithm::MinHeap || IsHandleHeapAlgorithm()) {
+        ImGui::SliderInt("New Key", &m_newKey, 0, 100);
+        if (ImGui::Button("Decrease Key")) {
+            DecreaseKeyValue(m_inputValue, m_newKey);
+        }
+        ImGui::SameLine();
+        ImGui::TextDisabled("[Value -> New Key]");
+    }
+    
+    ImGui::EndDisabled();
+    
+    if (IsBinaryTreeAlgorithm()) {
+        ImGui::Spacing();
+        ImGui::Text("Large Trees:");
+        RenderBackgroundJob();
+        if (ImGui::Button("Fit View")) {
+            m_autoFit = true;
+        }
+        ImGui::SameLine();
+        ImGui::TextDisabled("Wheel zooms, drag pans");
+    }
+    
+    ImGui::BeginDisabled(jobRunning);
+    
+    if (IsBinaryTreeAlgorithm()) {
+        ImGui::Spacing();
+        ImGui::Text("Order Statistics:");
+        if (ImGui::Button("Select k-th")) {
+            SelectValue(m_inputValue);
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Rank")) {
+            RankValue(m_inputValue);
+        }
+        ImGui::SameLine();
+        ImGui::TextDisabled("[k / key = Value]");
+        
+        ImGui::SliderInt("Range End", &m_rangeEnd, 1, 1000);
+        if (ImGui::Button("Count in Range")) {
+            CountRangeValues(m_inputValue, m_rangeEnd);
+        }
+        ImGui::SameLine();
+        ImGui::TextDisabled("[Value, Range End]");
+        
+        ImGui::SliderInt("Percentile", &m_percentile, 0, 100);
+        if (ImGui::Button("Find Percentile")) {
+            PercentileValue(m_percentile);
+        }
+        ImGui::SameLine();
+        ImGui::Checkbox("Show Subtree Sizes", &m_showSubtreeSizes);
+        
+        ImGui::Spacing();
+        ImGui::Text("Read-Only Layout:");
+        const char* layoutNames[] = { StaticSearchTree::LayoutName(StaticSearchTree::Layout::Sorted),
+                                      StaticSearchTree::LayoutName(StaticSearchTree::Layout::Breadth),
+                                      StaticSearchTree::LayoutName(StaticSearchTree::Layout::VanEmdeBoas) };
+        ImGui::Combo("Array Layout", &m_frozenLayout, layoutNames, IM_ARRAYSIZE(layoutNames));
+        if (ImGui::Button(m_frozenTree ? "Refreeze" : "Freeze")) {
+            FreezeTree();
+        }
+        ImGui::SameLine();
+        if (m_frozenTree) {
+            if (ImGui::Button("Thaw")) {
+                ThawTree("Thawed");
+            }
+        } else {
+            ImGui::TextDisabled("Searches run on the array until the next update");
+        }
+    }
+    
+    if (IsBTreeAlgorithm()) {
+        ImGui::Spacing();
+        ImGui::Text("B-Tree:");
+        if (ImGui::SliderInt("Node Order", &m_btreeOrder, BTree::MIN_ORDER, BTree::MAX_ORDER)) {
+            RebuildBTree();
+        }
+        if (ImGui::Button("Insert 50 Random")) {
+            InsertRandomKeys(50);
+        }
+        
+        ImGui::SliderInt("Range End", &m_rangeEnd, 1, 1000);
+        if (ImGui::Button("Range Scan")) {
+            RangeScanValues(m_inputValue, m_rangeEnd);
+        }
+        ImGui::SameLine();
+        ImGui::TextDisabled("[Value, Range End]");
+    }
+    
+    if (IsRangeTreeAlgorithm()) {
+        ImGui::Spacing();
+        ImGui::Text("Range Queries:");
+        if (ImGui::SliderInt("Elements", &m_rangeElements, MIN_RANGE_ELEMENTS, MAX_RANGE_ELEMENTS)) {
+            RebuildRangeTree();
+        }
+        ImGui::SliderInt("Left", &m_rangeLeft, 0, m_rangeElements - 1);
+        ImGui::SliderInt("Right", &m_rangeRight, 0, m_rangeElements - 1);
+        if (ImGui::Button("Range Add")) {
+            RangeAddValues(m_inputValue);
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Range Sum")) {
+            RangeQueryValues(false);
+        }
+        if (m_currentAlgorithm == TreeAlgorithm::SegmentTree) {
+            ImGui::SameLine();
+            if (ImGui::Button("Range Min")) {
+                RangeQueryValues(true);
+            }
+        }
+        if (ImGui::Button("Randomize")) {
+            RebuildRangeTree();
+        }
+        ImGui::SameLine();
+        ImGui::TextDisabled("Insert adds Value, Delete subtracts it");
+    }
+    
+    if (m_currentAlgorithm == TreeAlgorithm::AdaptiveRadixTree) {
+        ImGui::Spacing();
+        ImGui::Text("Radix Tree:");
+        if (ImGui::Button("Insert 50 Random")) {
+            InsertRandomKeys(50);
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Insert 500 Random")) {
+            InsertRandomKeys(500);
+        }
+        
+        ImGui::SliderInt("Range End", &m_rangeEnd, 1, 1000);
+        if (ImGui::Button("Range Scan")) {
+            RangeScanValues(m_inputValue, m_rangeEnd);
+        }
+        ImGui::SameLine();
+        ImGui::TextDisabled("[Value, Range End]");
+    }
+    
+    if (m_currentAlgorithm == TreeAlgorithm::PatriciaTrie) {
+        ImGui::Spacing();
+        ImGui::Text("Patricia Trie:");
+        ImGui::InputText("Word", m_trieWord, sizeof(m_trieWord));
+        if (ImGui::Button("Insert Word")) {
+            InsertWord(m_trieWord);
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Delete Word")) {
+            EraseWord(m_trieWord);
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Find Word")) {
+            FindWord(m_trieWord);
+        }
+        
+        ImGui::InputText("Range End##word", m_trieRangeEnd, sizeof(m_trieRangeEnd));
+        if (ImGui::Button("Prefix Scan")) {
+            PrefixScanWords(m_trieWord);
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Range Scan##word")) {
+            RangeScanWords(m_trieWord, m_trieRangeEnd);
+        }
+        ImGui::SameLine();
+        ImGui::TextDisabled("[Word, Range End]");
+        
+        const char* layoutNames[] = { PatriciaTrie::LayoutName(PatriciaTrie::ChildLayout::SortedArray),
+                                      PatriciaTrie::LayoutName(PatriciaTrie::ChildLayout::Table256) };
+        if (ImGui::Combo("Children", &m_trieLayout, layoutNames, IM_ARRAYSIZE(layoutNames))) {
+            RebuildTrie();
+        }
+        ImGui::InputText("Dictionary", m_dictionaryPath, sizeof(m_dictionaryPath));
+        if (ImGui::Button("Load Dictionary")) {
+            LoadDictionary(m_dictionaryPath);
+        }
+        ImGui::SameLine();
+        ImGui::TextDisabled("One word per line");
+        
+        if (!m_trieMatches.empty()) {
+            ImGui::Text("Matches:");
+            ImGui::TextWrapped("%s", fmt::format("{}", fmt::join(m_trieMatches, ", ")).c_str());
+        }
+    }
+    
     ImGui::Spacing();
     
     // Animation controls
@@ -204,13 +571,25 @@ void TreeVisualizer::RenderControls() {
     if (m_showTraversal && !m_traversalResult.empty()) {
         ImGui::Text("Traversal Result:");
         std::string result;
-        for (size_t i = 0; i < m_traversalResult.size(); ++i) {
+        const size_t shown = std::min(m_traversalResult.size(), TRAVERSAL_DISPLAY_LIMIT);
+        for (size_t i = 0; i < shown; ++i) {
             if (i > 0) result += ", ";
             result += std::to_string(m_traversalResult[i]);
         }
+        if (shown < m_traversalResult.size()) {
+            result += fmt::format(", ... ({} more)", m_traversalResult.size() - shown);
+        }
         ImGui::TextWrapped("%s", result.c_str());
     }
     
+    ImGui::EndDisabled();
+    
+    ImGui::Spacing();
+    
+    if (ImGui::CollapsingHeader("Benchmarks")) {
+        RenderBenchmarks();
+    }
+    
     ImGui::Spacing();
     
     // Instructions
@@ -222,6 +601,7 @@ void TreeVisualizer::RenderControls() {
 }
 
 void TreeVisualizer::RenderVisualization() {
+    PROFILE_SCOPE("TreeVisualizer::RenderVisualization");
     ImVec2 canvasPos = ImGui::GetCursorScreenPos();
     ImVec2 canvasSize = ImGui::GetContentRegionAvail();
     ImDrawList* drawList = ImGui::GetWindowDrawList();
@@ -268,68 +648,87 @@ void TreeVisualizer::RenderVisualization() {
             }
             
             // Draw heap as tree structure above array
-            // Simple layout for heap visualization
+            // Level-by-level layout; level L holds d^L slots
+            const size_t arity = static_cast<size_t>(m_heapArity);
             float treeHeight = canvasSize.y - 120;
-            int levels = static_cast<int>(std::floor(std::log2(m_heap.size()))) + 1;
+            int levels = 0;
+            for (size_t levelStart = 0, levelWidth = 1; levelStart < m_heap.size(); levelStart += levelWidth, levelWidth *= arity) {
+                levels++;
+            }
             float levelHeight = treeHeight / (levels + 1);
             
-            for (size_t i = 0; i < m_heap.size(); ++i) {
-                int level = static_cast<int>(std::floor(std::log2(i + 1)));
-                int posInLevel = i - (std::pow(2, level) - 1);
-                int maxInLevel = std::pow(2, level);
-                
-                float x = canvasPos.x + canvasSize.x * (posInLevel + 0.5f) / maxInLevel;
-                float y = canvasPos.y + 20 + level * levelHeight;
-                
-                // Draw connections to children
-                if (2 * i + 1 < m_heap.size()) { // Left child
-                    size_t leftChild = 2 * i + 1;
-                    int childLevel = static_cast<int>(std::floor(std::log2(leftChild + 1)));
-                    int childPosInLevel = leftChild - (std::pow(2, childLevel) - 1);
-                    int childMaxInLevel = std::pow(2, childLevel);
-                    
-                    float childX = canvasPos.x + canvasSize.x * (childPosInLevel + 0.5f) / childMaxInLevel;
-                    float childY = canvasPos.y + 20 + childLevel * levelHeight;
-                    
-                    drawList->AddLine(ImVec2(x, y + 15), ImVec2(childX, childY + 15), 
-                                     IM_COL32(150, 150, 150, 255), 2.0f);
-                }
-                
-                if (2 * i + 2 < m_heap.size()) { // Right child
-                    size_t rightChild = 2 * i + 2;
-                    int childLevel = static_cast<int>(std::floor(std::log2(rightChild + 1)));
-                    int childPosInLevel = rightChild - (std::pow(2, childLevel) - 1);
-                    int childMaxInLevel = std::pow(2, childLevel);
-                    
-                    float childX = canvasPos.x + canvasSize.x * (childPosInLevel + 0.5f) / childMaxInLevel;
-                    float childY = canvasPos.y + 20 + childLevel * levelHeight;
-                    
-                    drawList->AddLine(ImVec2(x, y + 15), ImVec2(childX, childY + 15), 
-                                     IM_COL32(150, 150, 150, 255), 2.0f);
+            auto nodePosition = [&](size_t index) {
+                size_t levelStart = 0;
+                size_t levelWidth = 1;
+                int level = 0;
+                while (index >= levelStart + levelWidth) {
+                    levelStart += levelWidth;
+                    levelWidth *= arity;
+                    level++;
                 }
+                float x = canvasPos.x + canvasSize.x * (index - levelStart + 0.5f) / levelWidth;
+                float y = canvasPos.y + 20 + level * levelHeight;
+                return ImVec2(x, y + 15);
+            };
+            
+            for (size_t i = 1; i < m_heap.size(); ++i) {
+                drawList->AddLine(nodePosition((i - 1) / arity), nodePosition(i), IM_COL32(150, 150, 150, 255), 2.0f);
+            }
+            
+            float radius = arity > 2 && levels > 2 ? 10.0f : 15.0f;
+            for (size_t i = 0; i < m_heap.size(); ++i) {
+                ImVec2 pos = nodePosition(i);
                 
                 // Draw node
-                drawList->AddCircleFilled(ImVec2(x, y + 15), 15, IM_COL32(70, 70, 200, 255));
-                drawList->AddCircle(ImVec2(x, y + 15), 15, IM_COL32(255, 255, 255, 255), 0, 2.0f);
+                drawList->AddCircleFilled(pos, radius, IM_COL32(70, 70, 200, 255));
+                drawList->AddCircle(pos, radius, IM_COL32(255, 255, 255, 255), 0, 2.0f);
                 
                 // Draw value
                 std::string valueStr = std::to_string(m_heap[i]);
                 ImVec2 textSize = ImGui::CalcTextSize(valueStr.c_str());
                 drawList->AddText(
-                    ImVec2(x - textSize.x / 2, y + 15 - textSize.y / 2),
+                    ImVec2(pos.x - textSize.x / 2, pos.y - textSize.y / 2),
                     IM_COL32(255, 255, 255, 255),
                     valueStr.c_str()
                 );
             }
         }
+    } else if (IsBTreeAlgorithm()) {
+        if (m_btree) {
+            RenderBTree(drawList, canvasPos, canvasSize);
+        }
+    } else if (m_currentAlgorithm == TreeAlgorithm::PairingHeap) {
+        if (m_pairingHeap) {
+            RenderPairingHeap(drawList, canvasPos, canvasSize);
+        }
+    } else if (m_currentAlgorithm == TreeAlgorithm::RadixHeap) {
+        if (m_radixHeap) {
+            RenderRadixHeap(drawList, canvasPos, canvasSize);
+        }
+    } else if (m_currentAlgorithm == TreeAlgorithm::SkipList) {
+        if (m_skipList) {
+            RenderSkipList(drawList, canvasPos, canvasSize);
+        }
+    } else if (m_currentAlgorithm == TreeAlgorithm::AdaptiveRadixTree) {
+        if (m_radixTree) {
+            RenderRadixTree(drawList, canvasPos, canvasSize);
+        }
+    } else if (m_currentAlgorithm == TreeAlgorithm::PatriciaTrie) {
+        if (m_trie) {
+            RenderPatriciaTrie(drawList, canvasPos, canvasSize);
+        }
+    } else if (IsRangeTreeAlgorithm()) {
+        EnsureRangeTree();
+        if (m_currentAlgorithm == TreeAlgorithm::SegmentTree) {
+            RenderSegmentTree(drawList, canvasPos, canvasSize);
+        } else {
+            RenderFenwickTree(drawList, canvasPos, canvasSize);
+        }
     } else {
         // Render binary tree
-        if (m_root) {
-            // Calculate positions
-            CalculatePositions(m_root, canvasSize.x / 2, 50, canvasSize.x / 4);
-            
-            // Draw tree
-            DrawNode(m_root, drawList, canvasPos);
+        RenderTreeLayout(drawList, canvasPos, canvasSize);
+        if (m_frozenTree) {
+            RenderFrozenLayout(drawList, canvasPos, canvasSize);
         }
     }
     
@@ -343,10 +742,15 @@ void TreeVisualizer::RenderVisualization() {
         );
     }
     
-    ImGui::Dummy(canvasSize);
+    // Claims the canvas and turns it into a zoom/pan surface
+    ImGui::InvisibleButton("TreeCanvas", ImVec2(std::max(canvasSize.x, 1.0f), std::max(canvasSize.y, 1.0f)));
+    if (IsBinaryTreeAlgorithm()) {
+        HandleViewInput(canvasPos);
+    }
 }
 
 void TreeVisualizer::RenderStatistics() {
+    PROFILE_SCOPE("TreeVisualizer::RenderStatistics");
     // Pulsing statistics header
     extern Application* g_application;
     if (g_application) {
@@ -361,6 +765,7 @@ void TreeVisualizer::RenderStatistics() {
     
     if (m_currentAlgorithm == TreeAlgorithm::MinHeap || m_currentAlgorithm == TreeAlgorithm::MaxHeap) {
         ImGui::Text("Heap Size: %zu", m_heap.size());
+        ImGui::Text("Arity: %d", m_heapArity);
         if (!m_heap.empty()) {
             if (m_currentAlgorithm == TreeAlgorithm::MinHeap) {
                 ImGui::Text("Minimum: %d", m_heap[0]);
@@ -368,12 +773,97 @@ void TreeVisualizer::RenderStatistics() {
                 ImGui::Text("Maximum: %d", m_heap[0]);
             }
         }
+    } else if (IsHandleHeapAlgorithm()) {
+        size_t size = 0;
+        if (m_pairingHeap) {
+            size = m_pairingHeap->Size();
+            if (m_pairingHeap->Root() >= 0) {
+                ImGui::Text("Minimum: %u", m_pairingHeap->NodeAt(m_pairingHeap->Root()).key);
+            }
+        } else if (m_radixHeap) {
+            size = m_radixHeap->Size();
+            ImGui::Text("Last Extracted: %u", m_radixHeap->LastKey());
+        }
+        ImGui::Text("Heap Size: %zu", size);
+    } else if (m_currentAlgorithm == TreeAlgorithm::SkipList) {
+        ImGui::Text("Key Count: %zu", m_skipList ? m_skipList->Size() : size_t(0));
+        ImGui::Text("Levels: %d", m_skipList ? m_skipList->Level() : 0);
+        ImGui::Text("Comparisons: %d", m_comparisons);
+    } else if (IsRangeTreeAlgorithm()) {
+        ImGui::Text("Elements: %zu", m_rangeValues.size());
+        ImGui::Text("Range: [%d, %d]", std::min(m_rangeLeft, m_rangeRight), std::max(m_rangeLeft, m_rangeRight));
+        ImGui::Text("Nodes Touched (last query): %d", m_comparisons);
+        if (m_segmentTree) {
+            const auto& stats = m_segmentTree->GetStats();
+            ImGui::Text("Height: %d (%d leaves)", m_segmentTree->Height(), m_segmentTree->Leaves());
+            ImGui::Text("Total Nodes Touched: %llu  Lazy Pushes: %llu",
+                        static_cast<unsigned long long>(stats.nodesTouched),
+                        static_cast<unsigned long long>(stats.pushes));
+        } else if (m_fenwickTree) {
+            ImGui::Text("Total Nodes Touched: %llu",
+                        static_cast<unsigned long long>(m_fenwickTree->GetStats().nodesTouched));
+        }
+    } else if (m_currentAlgorithm == TreeAlgorithm::AdaptiveRadixTree) {
+        ImGui::Text("Key Count: %d", m_nodeCount);
+        ImGui::Text("Tree Height: %d", m_treeHeight);
+        ImGui::Text("Nodes Visited: %d", m_comparisons);
+        if (m_radixTree) {
+            using NodeType = AdaptiveRadixTree::NodeType;
+            const auto& stats = m_radixTree->GetStats();
+            ImGui::Text("Node4: %zu  Node16: %zu  Node48: %zu  Node256: %zu",
+                        m_radixTree->NodeCount(NodeType::Node4), m_radixTree->NodeCount(NodeType::Node16),
+                        m_radixTree->NodeCount(NodeType::Node48), m_radixTree->NodeCount(NodeType::Node256));
+            ImGui::Text("Grows: %llu  Shrinks: %llu",
+                        static_cast<unsigned long long>(stats.grows),
+                        static_cast<unsigned long long>(stats.shrinks));
+            ImGui::Text("Prefix Splits: %llu  Leaf Expansions: %llu",
+                        static_cast<unsigned long long>(stats.prefixSplits),
+                        static_cast<unsigned long long>(stats.leafExpansions));
+            ImGui::Text("Memory: %zu bytes", m_radixTree->MemoryBytes());
+        }
+    } else if (m_currentAlgorithm == TreeAlgorithm::PatriciaTrie) {
+        ImGui::Text("Word Count: %d", m_nodeCount);
+        ImGui::Text("Trie Height: %d", m_treeHeight);
+        ImGui::Text("Nodes Visited: %d", m_comparisons);
+        if (m_trie) {
+            const auto& stats = m_trie->GetStats();
+            const size_t bytes = m_trie->MemoryBytes();
+            ImGui::Text("Nodes: %zu (%s)", m_trie->NodeCount(), PatriciaTrie::LayoutName(m_trie->Layout()));
+            ImGui::Text("Memory: %zu bytes (%.1f per word)", bytes,
+                        m_trie->Size() > 0 ? static_cast<double>(bytes) / m_trie->Size() : 0.0);
+            ImGui::Text("Edge Splits: %llu  Merges: %llu", static_cast<unsigned long long>(stats.edgeSplits),
+                        static_cast<unsigned long long>(stats.merges));
+        }
+    } else if (IsBTreeAlgorithm()) {
+        ImGui::Text("Key Count: %d", m_nodeCount);
+        ImGui::Text("Tree Height: %d", m_treeHeight);
+        ImGui::Text("Order: %d (max keys per node)", m_btreeOrder);
+        if (m_btree) {
+            const auto& stats = m_btree->GetStats();
+            ImGui::Text("Nodes: %zu", m_btree->NodeCount());
+            ImGui::Text("Nodes Visited: %llu", static_cast<unsigned long long>(stats.nodesVisited));
+            ImGui::Text("Splits: %llu  Merges: %llu  Borrows: %llu",
+                        static_cast<unsigned long long>(stats.splits),
+                        static_cast<unsigned long long>(stats.merges),
+                        static_cast<unsigned long long>(stats.borrows));
+        }
     } else {
         ImGui::Text("Node Count: %d", m_nodeCount);
         ImGui::Text("Tree Height: %d", m_treeHeight);
-        ImGui::Text("Comparisons: %d", m_comparisons);
-        if (m_currentAlgorithm == TreeAlgorithm::AVLTree) {
-            ImGui::Text("Rotations: %d", m_rotations);
+        ImGui::Text("Visible: %d nodes, %d collapsed subtrees", m_visibleNodes, m_collapsedSubtrees);
+        if (IsBackgroundJobRunning()) {
+            // Counters belong to the worker until it finishes
+            ImGui::Text("Background: %.0f ops/sec", m_jobOpsPerSecond);
+        } else {
+            ImGui::Text("Comparisons: %d", m_comparisons);
+            if (m_currentAlgorithm == TreeAlgorithm::AVLTree || m_currentAlgorithm == TreeAlgorithm::SplayTree ||
+                m_currentAlgorithm == TreeAlgorithm::Treap) {
+                ImGui::Text("Rotations: %d", m_rotations);
+            }
+            if (m_frozenTree) {
+                ImGui::Text("Frozen: %s, %zu slots (%zu bytes)", StaticSearchTree::LayoutName(m_frozenTree->GetLayout()),
+                            m_frozenTree->SlotCount(), m_frozenTree->MemoryBytes());
+            }
         }
     }
     
@@ -396,6 +886,7 @@ void TreeVisualizer::RenderStatistics() {
 }
 
 void TreeVisualizer::Update() {
+    PROFILE_SCOPE("TreeVisualizer::Update");
     if (m_isRunning && !m_isComplete) {
         auto now = std::chrono::high_resolution_clock::now();
         auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lastStepTime);
@@ -417,15 +908,51 @@ void TreeVisualizer::Update() {
     }
 }
 
-// Simplified implementations for basic functionality
 void TreeVisualizer::InsertValue(int value) {
     m_startTime = std::chrono::high_resolution_clock::now();
+    ThawTree("Insert");
     
     if (m_currentAlgorithm == TreeAlgorithm::MinHeap || m_currentAlgorithm == TreeAlgorithm::MaxHeap) {
         HeapInsert(value);
+    } else if (IsHandleHeapAlgorithm()) {
+        PriorityQueue* queue = EnsurePriorityQueue();
+        int item = 0;
+        while (item < HEAP_ITEM_CAPACITY && queue->Contains(item)) {
+            item++;
+        }
+        if (m_radixHeap && static_cast<uint32_t>(value) < m_radixHeap->LastKey()) {
+            RecordStep(nullptr, "Radix heap is monotone: {} is below the last extracted key {}", value, m_radixHeap->LastKey());
+        } else if (!queue->Push(item, static_cast<uint32_t>(value))) {
+            RecordStep("Heap is full");
+        } else {
+            RecordStep(nullptr, "Pushed key {} as item #{}", value, item);
+        }
+    } else if (m_currentAlgorithm == TreeAlgorithm::SkipList) {
+        EnsureSkipList();
+        m_skipListPath.clear();
+        m_skipList->Insert(value);
+        m_nodeCount = static_cast<int>(m_skipList->Size());
+    } else if (IsRangeTreeAlgorithm()) {
+        RangeAddValues(value);
+    } else if (m_currentAlgorithm == TreeAlgorithm::PatriciaTrie) {
+        InsertWord(m_trieWord);
+    } else if (m_currentAlgorithm == TreeAlgorithm::AdaptiveRadixTree) {
+        EnsureRadixTree();
+        if (!m_radixTree->Insert(value)) {
+            RecordStep(nullptr, "Key {} already present", value);
+        }
+        m_nodeCount = static_cast<int>(m_radixTree->Size());
+        m_treeHeight = m_radixTree->Height();
+    } else if (IsBTreeAlgorithm()) {
+        EnsureBTree();
+        if (!m_btree->Insert(value)) {
+            RecordStep(nullptr, "Key {} already present", value);
+        }
+        m_nodeCount = static_cast<int>(m_btree->Size());
+        m_treeHeight = m_btree->Height();
     } else {
-        m_root = BSTInsert(m_root, value);
-        m_nodeCount++;
+        InsertTreeNode(value);
+        m_layoutDirty = true;
     }
     
     m_endTime = std::chrono::high_resolution_clock::now();
@@ -434,12 +961,44 @@ void TreeVisualizer::InsertValue(int value) {
 
 void TreeVisualizer::DeleteValue(int value) {
     m_startTime = std::chrono::high_resolution_clock::now();
+    ThawTree("Delete");
     
     if (m_currentAlgorithm == TreeAlgorithm::MinHeap || m_currentAlgorithm == TreeAlgorithm::MaxHeap) {
         HeapExtract();
+    } else if (IsHandleHeapAlgorithm()) {
+        PriorityQueue* queue = EnsurePriorityQueue();
+        if (queue->Empty()) {
+            RecordStep("Heap is empty, cannot extract");
+        } else {
+            PriorityQueue::Entry entry = queue->Pop();
+            RecordStep(nullptr, "Extracted minimum {} (item #{})", entry.key, entry.item);
+        }
+    } else if (m_currentAlgorithm == TreeAlgorithm::SkipList) {
+        EnsureSkipList();
+        m_skipListPath.clear();
+        m_skipList->Erase(value);
+        m_nodeCount = static_cast<int>(m_skipList->Size());
+    } else if (IsRangeTreeAlgorithm()) {
+        RangeAddValues(-value);
+    } else if (m_currentAlgorithm == TreeAlgorithm::PatriciaTrie) {
+        EraseWord(m_trieWord);
+    } else if (m_currentAlgorithm == TreeAlgorithm::AdaptiveRadixTree) {
+        EnsureRadixTree();
+        if (!m_radixTree->Erase(value)) {
+            RecordStep(nullptr, "Key {} not found", value);
+        }
+        m_nodeCount = static_cast<int>(m_radixTree->Size());
+        m_treeHeight = m_radixTree->Height();
+    } else if (IsBTreeAlgorithm()) {
+        EnsureBTree();
+        if (!m_btree->Erase(value)) {
+            RecordStep(nullptr, "Key {} not found", value);
+        }
+        m_nodeCount = static_cast<int>(m_btree->Size());
+        m_treeHeight = m_btree->Height();
     } else {
-        m_root = BSTDelete(m_root, value);
-        if (m_nodeCount > 0) m_nodeCount--;
+        DeleteTreeNode(value);
+        m_layoutDirty = true;
     }
     
     m_endTime = std::chrono::high_resolution_clock::now();
@@ -447,18 +1006,73 @@ void TreeVisualizer::DeleteValue(int value) {
 }
 
 void TreeVisualizer::SearchValue(int value) {
+    if (IsRangeTreeAlgorithm()) {
+        // The range trees answer range queries rather than key lookups
+        RangeQueryValues(false);
+        return;
+    }
+    if (m_currentAlgorithm == TreeAlgorithm::PatriciaTrie) {
+        FindWord(m_trieWord);
+        return;
+    }
+    
     m_startTime = std::chrono::high_resolution_clock::now();
     m_comparisons = 0;
     
     ResetVisualization();
-    RecordStep(fmt::format("Searching for value {}", value));
-    
-    std::shared_ptr<TreeNode> result = BSTSearch(m_root, value);
+    RecordStep(nullptr, "Searching for value {}", value);
+    
+    bool found = false;
+    if (IsBTreeAlgorithm()) {
+        EnsureBTree();
+        uint64_t visitedBefore = m_btree->GetStats().nodesVisited;
+        found = m_btree->Contains(value);
+        m_comparisons = static_cast<int>(m_btree->GetStats().nodesVisited - visitedBefore);
+        RecordStep(nullptr, "Visited {} node(s) from root towards a leaf", m_comparisons);
+    } else if (IsHandleHeapAlgorithm()) {
+        found = FindQueuedItem(value) >= 0;
+    } else if (m_currentAlgorithm == TreeAlgorithm::SkipList) {
+        EnsureSkipList();
+        m_skipListPath = m_skipList->SearchPath(value);
+        for (const SkipList::Node* node : m_skipListPath) {
+            RecordStep(nullptr, "Visiting tower {} (height {})", node->key, node->next.size());
+        }
+        m_comparisons = static_cast<int>(m_skipListPath.size());
+        found = !m_skipListPath.empty() && m_skipListPath.back()->key == value;
+    } else if (m_currentAlgorithm == TreeAlgorithm::AdaptiveRadixTree) {
+        EnsureRadixTree();
+        uint64_t visitedBefore = m_radixTree->GetStats().nodesVisited;
+        found = m_radixTree->Contains(value);
+        m_comparisons = static_cast<int>(m_radixTree->GetStats().nodesVisited - visitedBefore);
+        RecordStep(nullptr, "Visited {} node(s), one key byte per level", m_comparisons);
+    } else if (m_frozenTree) {
+        // Checked before the splay branch: the frozen copy is read-only, so nothing restructures
+        m_frozenPath = m_frozenTree->SearchPath(value);
+        for (int slot : m_frozenPath) {
+            if (m_frozenTree->IsPadding(slot)) {
+                RecordStep(nullptr, "Slot {} (depth {}): padding", slot, m_frozenTree->DepthOfSlot(slot));
+            } else {
+                RecordStep(nullptr, "Slot {} (depth {}): key {}", slot, m_frozenTree->DepthOfSlot(slot),
+                           m_frozenTree->KeyAt(slot));
+            }
+        }
+        m_comparisons = static_cast<int>(m_frozenPath.size());
+        const int last = m_frozenPath.empty() ? -1 : m_frozenPath.back();
+        found = last >= 0 && !m_frozenTree->IsPadding(last) && m_frozenTree->KeyAt(last) == value;
+    } else if (m_currentAlgorithm == TreeAlgorithm::SplayTree) {
+        // A splay tree search restructures: the key (or its last neighbour) becomes the root
+        m_root = Splay(m_root, value);
+        m_layoutDirty = true;
+        found = m_root && m_root->value == value;
+    } else {
+        found = BSTSearch(m_root, value) != nullptr;
+        m_layoutDirty = true; // Highlight flags changed
+    }
     
-    if (result) {
-        RecordStep(fmt::format("Found value {} in tree!", value));
+    if (found) {
+        RecordStep(nullptr, "Found value {} in tree!", value);
     } else {
-        RecordStep(fmt::format("Value {} not found in tree", value));
+        RecordStep(nullptr, "Value {} not found in tree", value);
     }
     
     m_endTime = std::chrono::high_resolution_clock::now();
@@ -469,43 +1083,150 @@ void TreeVisualizer::TraverseTree() {
     m_traversalResult.clear();
     ResetVisualization();
     
+    if (m_pairingHeap) {
+        // Pre-order over the child / sibling links
+        std::vector<int> stack;
+        if (m_pairingHeap->Root() >= 0) {
+            stack.push_back(m_pairingHeap->Root());
+        }
+        while (!stack.empty()) {
+            int item = stack.back();
+            stack.pop_back();
+            const auto& node = m_pairingHeap->NodeAt(item);
+            m_traversalResult.push_back(static_cast<int>(node.key));
+            RecordStep(nullptr, "Visiting node {}", node.key);
+            if (node.sibling >= 0) stack.push_back(node.sibling);
+            if (node.child >= 0) stack.push_back(node.child);
+        }
+        return;
+    }
+    
+    if (m_radixHeap) {
+        for (int bucket = 0; bucket < RadixHeap::BUCKET_COUNT; ++bucket) {
+            for (const auto& entry : m_radixHeap->Bucket(bucket)) {
+                if (m_radixHeap->IsLive(entry)) {
+                    m_traversalResult.push_back(static_cast<int>(entry.key));
+                }
+            }
+        }
+        RecordStep(nullptr, "Listed {} keys bucket by bucket", m_traversalResult.size());
+        return;
+    }
+    
+    if (m_skipList) {
+        RecordStep("Walking level 0 from the head");
+        m_traversalResult = m_skipList->Keys();
+        RecordStep(nullptr, "Traversal completed ({} keys)", m_traversalResult.size());
+        return;
+    }
+    
+    if (IsRangeTreeAlgorithm()) {
+        for (int64_t value : m_rangeValues) {
+            m_traversalResult.push_back(static_cast<int>(value));
+        }
+        RecordStep(nullptr, "Listed {} elements in index order", m_traversalResult.size());
+        return;
+    }
+    
+    if (m_trie) {
+        RecordStep("Walking children in byte order");
+        m_trieMatches = m_trie->PrefixKeys("", TRIE_MATCH_LIMIT);
+        RecordStep(nullptr, "Traversal listed {} of {} words", m_trieMatches.size(), m_trie->Size());
+        return;
+    }
+    
+    if (m_radixTree) {
+        RecordStep("Walking children in key-byte order");
+        m_traversalResult = m_radixTree->Keys();
+        RecordStep(nullptr, "Traversal completed ({} keys)", m_traversalResult.size());
+        return;
+    }
+    
+    if (IsBTreeAlgorithm()) {
+        if (m_btree) {
+            RecordStep("Starting in-order key traversal");
+            m_traversalResult = m_btree->Keys();
+            RecordStep(nullptr, "Traversal completed ({} keys)", m_traversalResult.size());
+        }
+        return;
+    }
+    
     if (m_root) {
         RecordStep("Starting in-order traversal");
-        InorderTraversal(m_root, m_traversalResult);
-        RecordStep("Traversal completed");
+        InorderTraversal(m_root.get(), m_traversalResult);
+        RecordStep(nullptr, "Traversal completed ({} keys)", m_traversalResult.size());
+    }
+}
+
+// Dispatch for the TreeNode-based trees; shared by interactive edits and background jobs
+void TreeVisualizer::InsertTreeNode(int value) {
+    if (m_currentAlgorithm == TreeAlgorithm::SplayTree) {
+        m_root = SplayInsert(m_root, value);
+    } else if (m_currentAlgorithm == TreeAlgorithm::Treap) {
+        m_root = TreapInsert(m_root, value);
+    } else if (m_currentAlgorithm == TreeAlgorithm::AVLTree && m_autoBalance) {
+        m_root = AVLInsert(m_root, value);
+    } else if (m_currentAlgorithm == TreeAlgorithm::RedBlackTree) {
+        m_root = RBInsert(m_root, value);
+    } else {
+        m_root = BSTInsert(m_root, value);
+    }
+}
+
+void TreeVisualizer::DeleteTreeNode(int value) {
+    if (m_currentAlgorithm == TreeAlgorithm::SplayTree) {
+        m_root = SplayDelete(m_root, value);
+    } else if (m_currentAlgorithm == TreeAlgorithm::Treap) {
+        m_root = TreapDelete(m_root, value);
+    } else if (m_currentAlgorithm == TreeAlgorithm::AVLTree && m_autoBalance) {
+        m_root = AVLDelete(m_root, value);
+    } else if (m_currentAlgorithm == TreeAlgorithm::RedBlackTree) {
+        m_root = RBDelete(m_root, value);
+    } else {
+        m_root = BSTDelete(m_root, value);
+    }
+}
+
+// Plain lookup without highlighting; a splay tree still restructures
+bool TreeVisualizer::FindTreeNode(int value) {
+    if (m_currentAlgorithm == TreeAlgorithm::SplayTree) {
+        m_root = Splay(m_root, value);
+        return m_root && m_root->value == value;
     }
+    return ContainsKey(m_root.get(), value);
 }
 
 // Basic BST implementations
 std::shared_ptr<TreeNode> TreeVisualizer::BSTInsert(std::shared_ptr<TreeNode> root, int value) {
     if (!root) {
-        RecordStep(fmt::format("Creating new node with value {}", value));
+        RecordStep(nullptr, "Creating new node with value {}", value);
         auto newNode = std::make_shared<TreeNode>(value);
         newNode->isNew = true;
         return newNode;
     }
     
-    RecordStep(fmt::format("Comparing {} with {}", value, root->value), root);
+    RecordStep(root, "Comparing {} with {}", value, root->value);
     m_comparisons++;
     
     if (value < root->value) {
-        RecordStep(fmt::format("{} < {}, going left", value, root->value));
+        RecordStep(nullptr, "{} < {}, going left", value, root->value);
         root->left = BSTInsert(root->left, value);
     } else if (value > root->value) {
-        RecordStep(fmt::format("{} > {}, going right", value, root->value));
+        RecordStep(nullptr, "{} > {}, going right", value, root->value);
         root->right = BSTInsert(root->right, value);
     }
     
+    UpdateSubtree(root);
     return root;
 }
 
 std::shared_ptr<TreeNode> TreeVisualizer::BSTDelete(std::shared_ptr<TreeNode> root, int value) {
     if (!root) {
-        RecordStep(fmt::format("Value {} not found", value));
+        RecordStep(nullptr, "Value {} not found", value);
         return root;
     }
     
-    RecordStep(fmt::format("Comparing {} with {}", value, root->value), root);
+    RecordStep(root, "Comparing {} with {}", value, root->value);
     m_comparisons++;
     
     if (value < root->value) {
@@ -514,7 +1235,7 @@ std::shared_ptr<TreeNode> TreeVisualizer::BSTDelete(std::shared_ptr<TreeNode> ro
         root->right = BSTDelete(root->right, value);
     } else {
         // Node to be deleted found
-        RecordStep(fmt::format("Found node to delete: {}", value), root);
+        RecordStep(root, "Found node to delete: {}", value);
         root->isDeleted = true;
         
         if (!root->left) {
@@ -533,36 +1254,37 @@ std::shared_ptr<TreeNode> TreeVisualizer::BSTDelete(std::shared_ptr<TreeNode> ro
         root->right = BSTDelete(root->right, temp->value);
     }
     
+    UpdateSubtree(root);
     return root;
 }
 
 std::shared_ptr<TreeNode> TreeVisualizer::BSTSearch(std::shared_ptr<TreeNode> root, int value) {
     if (!root || root->value == value) {
         if (root) {
-            RecordStep(fmt::format("Found value {}", value), root);
+            RecordStep(root, "Found value {}", value);
             root->isHighlighted = true;
         }
         return root;
     }
     
-    RecordStep(fmt::format("Comparing {} with {}", value, root->value), root);
+    RecordStep(root, "Comparing {} with {}", value, root->value);
     m_comparisons++;
     
     if (value < root->value) {
-        RecordStep(fmt::format("{} < {}, searching left", value, root->value));
+        RecordStep(nullptr, "{} < {}, searching left", value, root->value);
         return BSTSearch(root->left, value);
     } else {
-        RecordStep(fmt::format("{} > {}, searching right", value, root->value));
+        RecordStep(nullptr, "{} > {}, searching right", value, root->value);
         return BSTSearch(root->right, value);
     }
 }
 
 // Basic heap implementations
 void TreeVisualizer::HeapInsert(int value) {
-    RecordStep(fmt::format("Inserting {} into heap", value));
+    RecordStep(nullptr, "Inserting {} into heap", value);
     m_heap.push_back(value);
     HeapifyUp(m_heap.size() - 1);
-    RecordStep(fmt::format("Inserted {} successfully", value));
+    RecordStep(nullptr, "Inserted {} successfully", value);
 }
 
 void TreeVisualizer::HeapExtract() {
@@ -572,7 +1294,7 @@ void TreeVisualizer::HeapExtract() {
     }
     
     int extracted = m_heap[0];
-    RecordStep(fmt::format("Extracting root element: {}", extracted));
+    RecordStep(nullptr, "Extracting root element: {}", extracted);
     
     m_heap[0] = m_heap.back();
     m_heap.pop_back();
@@ -581,124 +1303,1678 @@ void TreeVisualizer::HeapExtract() {
         HeapifyDown(0);
     }
     
-    RecordStep(fmt::format("Extracted {} successfully", extracted));
+    RecordStep(nullptr, "Extracted {} successfully", extracted);
 }
 
 void TreeVisualizer::HeapifyUp(int index) {
-    if (index == 0) return;
-    
-    int parent = (index - 1) / 2;
-    bool shouldSwap = false;
-    
-    if (m_currentAlgorithm == TreeAlgorithm::MinHeap) {
-        shouldSwap = m_heap[index] < m_heap[parent];
-    } else {
-        shouldSwap = m_heap[index] > m_heap[parent];
-    }
-    
-    if (shouldSwap) {
-        RecordStep(fmt::format("Swapping {} with parent {}", m_heap[index], m_heap[parent]));
+    auto outranks = [this](int a, int b) {
+        return m_currentAlgorithm == TreeAlgorithm::MinHeap ? m_heap[a] < m_heap[b] : m_heap[a] > m_heap[b];
+    };
+    
+    while (index > 0) {
+        int parent = (index - 1) / m_heapArity;
+        if (!outranks(index, parent)) {
+            break;
+        }
+        RecordStep(nullptr, "Swapping {} with parent {}", m_heap[index], m_heap[parent]);
         std::swap(m_heap[index], m_heap[parent]);
-        HeapifyUp(parent);
+        index = parent;
     }
 }
 
 void TreeVisualizer::HeapifyDown(int index) {
-    int size = m_heap.size();
-    int target = index;
-    int left = 2 * index + 1;
-    int right = 2 * index + 2;
-    
-    if (m_currentAlgorithm == TreeAlgorithm::MinHeap) {
-        if (left < size && m_heap[left] < m_heap[target]) {
-            target = left;
-        }
-        if (right < size && m_heap[right] < m_heap[target]) {
-            target = right;
-        }
-    } else {
-        if (left < size && m_heap[left] > m_heap[target]) {
-            target = left;
+    auto outranks = [this](int a, int b) {
+        return m_currentAlgorithm == TreeAlgorithm::MinHeap ? m_heap[a] < m_heap[b] : m_heap[a] > m_heap[b];
+    };
+    const int size = static_cast<int>(m_heap.size());
+    
+    for (;;) {
+        int target = index;
+        int firstChild = m_heapArity * index + 1;
+        int lastChild = std::min(firstChild + m_heapArity, size);
+        for (int child = firstChild; child < lastChild; ++child) {
+            if (outranks(child, target)) {
+                target = child;
+            }
         }
-        if (right < size && m_heap[right] > m_heap[target]) {
-            target = right;
+        if (target == index) {
+            break;
         }
-    }
-    
-    if (target != index) {
-        RecordStep(fmt::format("Swapping {} with {}", m_heap[index], m_heap[target]));
+        RecordStep(nullptr, "Swapping {} with {}", m_heap[index], m_heap[target]);
         std::swap(m_heap[index], m_heap[target]);
-        HeapifyDown(target);
+        index = target;
     }
 }
 
-// Utility functions
-void TreeVisualizer::CalculatePositions(std::shared_ptr<TreeNode> node, float x, float y, float spacing) {
-    if (!node) return;
-    
-    node->x = x;
-    node->y = y;
-    
-    if (node->left) {
-        CalculatePositions(node->left, x - spacing, y + 60, spacing / 2);
+// Bottom-up heap construction after an arity change
+void TreeVisualizer::RebuildHeap() {
+    ResetVisualization();
+    RecordStep(nullptr, "Rebuilding heap with arity {}", m_heapArity);
+    for (int i = (static_cast<int>(m_heap.size()) - 2) / m_heapArity; i >= 0; --i) {
+        HeapifyDown(i);
+    }
+}
+
+// Pairing / radix heap implementations
+bool TreeVisualizer::IsHandleHeapAlgorithm() const {
+    return m_currentAlgorithm == TreeAlgorithm::PairingHeap || m_currentAlgorithm == TreeAlgorithm::RadixHeap;
+}
+
+PriorityQueue* TreeVisualizer::EnsurePriorityQueue() {
+    if (m_currentAlgorithm == TreeAlgorithm::PairingHeap) {
+        if (!m_pairingHeap) {
+            m_pairingHeap = std::make_unique<PairingHeap>(HEAP_ITEM_CAPACITY);
+        }
+        return m_pairingHeap.get();
     }
-    if (node->right) {
-        CalculatePositions(node->right, x + spacing, y + 60, spacing / 2);
+    if (!m_radixHeap) {
+        m_radixHeap = std::make_unique<RadixHeap>(HEAP_ITEM_CAPACITY);
     }
+    return m_radixHeap.get();
 }
 
-void TreeVisualizer::DrawNode(std::shared_ptr<TreeNode> node, ImDrawList* drawList, ImVec2 offset) {
-    if (!node) return;
-    
-    ImVec2 pos = ImVec2(offset.x + node->x, offset.y + node->y);
-    
-    // Draw edges first
-    if (node->left) {
-        ImVec2 childPos = ImVec2(offset.x + node->left->x, offset.y + node->left->y);
-        drawList->AddLine(pos, childPos, IM_COL32(150, 150, 150, 255), 2.0f);
-        DrawNode(node->left, drawList, offset);
+int TreeVisualizer::FindQueuedItem(int key) const {
+    const PriorityQueue* queue = m_pairingHeap ? static_cast<const PriorityQueue*>(m_pairingHeap.get()) : m_radixHeap.get();
+    if (!queue || key < 0) {
+        return -1;
     }
-    if (node->right) {
-        ImVec2 childPos = ImVec2(offset.x + node->right->x, offset.y + node->right->y);
-        drawList->AddLine(pos, childPos, IM_COL32(150, 150, 150, 255), 2.0f);
-        DrawNode(node->right, drawList, offset);
+    for (int item = 0; item < HEAP_ITEM_CAPACITY; ++item) {
+        if (queue->Contains(item) && queue->KeyOf(item) == static_cast<uint32_t>(key)) {
+            return item;
+        }
     }
+    return -1;
+}
+
+void TreeVisualizer::DecreaseKeyValue(int value, int newKey) {
+    ResetVisualization();
+    m_startTime = std::chrono::high_resolution_clock::now();
     
-    // Draw node
-    ImU32 nodeColor = IM_COL32(70, 70, 200, 255);
-    if (node->isHighlighted) {
-        nodeColor = IM_COL32(255, 255, 0, 255);
-    } else if (node->isNew) {
-        nodeColor = IM_COL32(0, 255, 0, 255);
-    } else if (node->isDeleted) {
-        nodeColor = IM_COL32(255, 0, 0, 255);
+    if (newKey >= value) {
+        RecordStep(nullptr, "New key {} is not lower than {}", newKey, value);
+    } else if (m_currentAlgorithm == TreeAlgorithm::MinHeap) {
+        auto it = std::find(m_heap.begin(), m_heap.end(), value);
+        if (it == m_heap.end()) {
+            RecordStep(nullptr, "Value {} not found in heap", value);
+        } else {
+            RecordStep(nullptr, "Decreasing {} to {}", value, newKey);
+            *it = newKey;
+            HeapifyUp(static_cast<int>(it - m_heap.begin()));
+        }
+    } else if (IsHandleHeapAlgorithm()) {
+        PriorityQueue* queue = EnsurePriorityQueue();
+        int item = FindQueuedItem(value);
+        if (item < 0) {
+            RecordStep(nullptr, "Value {} not found in heap", value);
+        } else if (!queue->DecreaseKey(item, static_cast<uint32_t>(newKey))) {
+            RecordStep(nullptr, "Cannot decrease below the last extracted key {}", m_radixHeap ? m_radixHeap->LastKey() : 0u);
+        } else if (m_pairingHeap) {
+            RecordStep(nullptr, "Decreased {} to {}: cut its subtree and melded it with the root", value, newKey);
+        } else {
+            RecordStep(nullptr, "Decreased {} to {}: re-pushed into bucket, old entry left stale", value, newKey);
+        }
     }
     
-    drawList->AddCircleFilled(pos, 20, nodeColor);
-    drawList->AddCircle(pos, 20, IM_COL32(255, 255, 255, 255), 0, 2.0f);
-    
-    // Draw value
-    std::string valueStr = std::to_string(node->value);
-    ImVec2 textSize = ImGui::CalcTextSize(valueStr.c_str());
-    drawList->AddText(
-        ImVec2(pos.x - textSize.x / 2, pos.y - textSize.y / 2),
-        IM_COL32(255, 255, 255, 255),
-        valueStr.c_str()
-    );
+    m_endTime = std::chrono::high_resolution_clock::now();
+    m_operationTime = std::chrono::duration<double, std::milli>(m_endTime - m_startTime).count();
 }
 
-void TreeVisualizer::InorderTraversal(std::shared_ptr<TreeNode> node, std::vector<int>& result) {
-    if (!node) return;
+// Subtrees get horizontal space proportional to their leaf count
+void TreeVisualizer::RenderPairingHeap(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize) {
+    PROFILE_SCOPE("TreeVisualizer::RenderPairingHeap");
+    const PairingHeap& heap = *m_pairingHeap;
+    if (heap.Root() < 0) {
+        return;
+    }
     
-    InorderTraversal(node->left, result);
-    result.push_back(node->value);
-    RecordStep(fmt::format("Visiting node {}", node->value), node);
-    InorderTraversal(node->right, result);
-}
-
+    std::vector<float> leafSpan(HEAP_ITEM_CAPACITY, 0.0f);
+    int maxDepth = 0;
+    auto measure = [&](auto& self, int item, int depth) -> float {
+        maxDepth = std::max(maxDepth, depth);
+        float span = 0.0f;
+        for (int child = heap.NodeAt(item).child; child >= 0; child = heap.NodeAt(child).sibling) {
+            span += self(self, child, depth + 1);
+        }
+        leafSpan[item] = std::max(span, 1.0f);
+        return leafSpan[item];
+    };
+    const float totalSpan = measure(measure, heap.Root(), 0);
+    const float levelHeight = std::min(60.0f, (canvasSize.y - 80.0f) / (maxDepth + 1));
+    const float radius = std::clamp(canvasSize.x / totalSpan / 2.5f, 4.0f, 15.0f);
+    
+    auto draw = [&](auto& self, int item, float leftSlot, int depth) -> ImVec2 {
+        ImVec2 pos(canvasPos.x + canvasSize.x * (leftSlot + leafSpan[item] / 2) / totalSpan,
+                   canvasPos.y + 40.0f + depth * levelHeight);
+        float childSlot = leftSlot;
+        for (int child = heap.NodeAt(item).child; child >= 0; child = heap.NodeAt(child).sibling) {
+            ImVec2 childPos = self(self, child, childSlot, depth + 1);
+            drawList->AddLine(pos, childPos, IM_COL32(150, 150, 150, 255), 2.0f);
+            childSlot += leafSpan[child];
+        }
+        
+        ImU32 nodeColor = item == heap.Root() ? IM_COL32(200, 160, 0, 255) : IM_COL32(70, 70, 200, 255);
+        drawList->AddCircleFilled(pos, radius, nodeColor);
+        drawList->AddCircle(pos, radius, IM_COL32(255, 255, 255, 255), 0, 2.0f);
+        if (radius >= 10.0f) {
+            std::string valueStr = std::to_string(heap.NodeAt(item).key);
+            ImVec2 textSize = ImGui::CalcTextSize(valueStr.c_str());
+            drawList->AddText(ImVec2(pos.x - textSize.x / 2, pos.y - textSize.y / 2),
+                             IM_COL32(255, 255, 255, 255), valueStr.c_str());
+        }
+        return pos;
+    };
+    draw(draw, heap.Root(), 0.0f, 0);
+}
+
+// One column per bucket, entries stacked from the bottom; stale entries are greyed out
+void TreeVisualizer::RenderRadixHeap(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize) {
+    PROFILE_SCOPE("TreeVisualizer::RenderRadixHeap");
+    const RadixHeap& heap = *m_radixHeap;
+    
+    int usedBuckets = 1;
+    for (int b = 0; b < RadixHeap::BUCKET_COUNT; ++b) {
+        if (!heap.Bucket(b).empty()) {
+            usedBuckets = b + 1;
+        }
+    }
+    usedBuckets = std::max(usedBuckets, 8);
+    
+    const float columnWidth = (canvasSize.x - 20.0f) / usedBuckets;
+    const float baseY = canvasPos.y + canvasSize.y - 30.0f;
+    const float entryHeight = 20.0f;
+    
+    std::string lastStr = fmt::format("last = {}", heap.LastKey());
+    drawList->AddText(ImVec2(canvasPos.x + 10, canvasPos.y + 30), IM_COL32(255, 165, 0, 255), lastStr.c_str());
+    
+    for (int b = 0; b < usedBuckets; ++b) {
+        float x = canvasPos.x + 10.0f + b * columnWidth;
+        drawList->AddLine(ImVec2(x, baseY), ImVec2(x + columnWidth - 2, baseY), IM_COL32(150, 150, 150, 255), 2.0f);
+        std::string indexStr = std::to_string(b);
+        ImVec2 indexSize = ImGui::CalcTextSize(indexStr.c_str());
+        drawList->AddText(ImVec2(x + (columnWidth - indexSize.x) / 2, baseY + 5), IM_COL32(200, 200, 200, 255), indexStr.c_str());
+        
+        const auto& bucket = heap.Bucket(b);
+        for (size_t i = 0; i < bucket.size(); ++i) {
+            float y = baseY - (i + 1) * entryHeight;
+            if (y < canvasPos.y + 50.0f) {
+                break;
+            }
+            bool live = heap.IsLive(bucket[i]);
+            drawList->AddRectFilled(ImVec2(x + 1, y), ImVec2(x + columnWidth - 3, y + entryHeight - 2),
+                                    live ? IM_COL32(70, 70, 200, 255) : IM_COL32(80, 80, 80, 255));
+            std::string keyStr = std::to_string(bucket[i].key);
+            ImVec2 textSize = ImGui::CalcTextSize(keyStr.c_str());
+            if (textSize.x < columnWidth - 4) {
+                drawList->AddText(ImVec2(x + (columnWidth - textSize.x) / 2, y + (entryHeight - 2 - textSize.y) / 2),
+                                 live ? IM_COL32(255, 255, 255, 255) : IM_COL32(160, 160, 160, 255), keyStr.c_str());
+            }
+        }
+    }
+}
+
+// Skip list implementations
+void TreeVisualizer::EnsureSkipList() {
+    if (!m_skipList) {
+        m_skipList = std::make_unique<SkipList>(std::random_device{}());
+        m_skipList->SetStepCallback([this](const std::string& description) { RecordStep(description); });
+    }
+}
+
+// One column per node in level 0 order, the head first; each level is a row of forward links
+void TreeVisualizer::RenderSkipList(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize) {
+    PROFILE_SCOPE("TreeVisualizer::RenderSkipList");
+    const SkipList& list = *m_skipList;
+    
+    std::unordered_map<const SkipList::Node*, int> column;
+    std::vector<const SkipList::Node*> nodes;
+    for (const SkipList::Node* node = list.Head()->next[0]; node; node = node->next[0]) {
+        column[node] = static_cast<int>(nodes.size()) + 1;
+        nodes.push_back(node);
+    }
+    
+    const int levels = list.Level();
+    const float columnWidth = std::min(44.0f, (canvasSize.x - 60.0f) / (nodes.size() + 2));
+    const float rowHeight = std::min(28.0f, (canvasSize.y - 90.0f) / levels);
+    const float boxWidth = std::max(columnWidth - 8.0f, 2.0f);
+    const float baseY = canvasPos.y + canvasSize.y - 40.0f;
+    auto columnX = [&](int index) { return canvasPos.x + 20.0f + index * columnWidth; };
+    auto rowY = [&](int level) { return baseY - (level + 1) * rowHeight; };
+    const float nilX = columnX(static_cast<int>(nodes.size()) + 1);
+    
+    // Forward links, drawn from each tower to its successor at every level
+    auto drawLinks = [&](const SkipList::Node* node, int fromColumn, int height) {
+        for (int level = 0; level < height; ++level) {
+            float y = rowY(level) + rowHeight / 2;
+            float fromX = columnX(fromColumn) + boxWidth;
+            const SkipList::Node* next = node->next[level];
+            float toX = next ? columnX(column[next]) : nilX;
+            drawList->AddLine(ImVec2(fromX, y), ImVec2(toX, y), IM_COL32(150, 150, 150, 255), 1.0f);
+        }
+    };
+    drawLinks(list.Head(), 0, levels);
+    for (const SkipList::Node* node : nodes) {
+        drawLinks(node, column[node], static_cast<int>(node->next.size()));
+    }
+    
+    auto drawTower = [&](int index, int height, ImU32 color, const std::string& label) {
+        float x = columnX(index);
+        for (int level = 0; level < height; ++level) {
+            float y = rowY(level);
+            drawList->AddRectFilled(ImVec2(x, y + 2), ImVec2(x + boxWidth, y + rowHeight - 2), color);
+        }
+        ImVec2 textSize = ImGui::CalcTextSize(label.c_str());
+        if (textSize.x <= columnWidth) {
+            drawList->AddText(ImVec2(x + (boxWidth - textSize.x) / 2, baseY + 4), IM_COL32(255, 255, 255, 255), label.c_str());
+        }
+    };
+    drawTower(0, levels, IM_COL32(120, 120, 120, 255), "H");
+    for (const SkipList::Node* node : nodes) {
+        bool onPath = std::find(m_skipListPath.begin(), m_skipListPath.end(), node) != m_skipListPath.end();
+        drawTower(column[node], static_cast<int>(node->next.size()),
+                  onPath ? IM_COL32(255, 200, 0, 255) : IM_COL32(70, 70, 200, 255), std::to_string(node->key));
+    }
+    
+    ImVec2 nilSize = ImGui::CalcTextSize("NIL");
+    drawList->AddText(ImVec2(nilX, baseY + 4 - nilSize.y), IM_COL32(200, 200, 200, 255), "NIL");
+}
+
+// Adaptive radix tree implementations
+void TreeVisualizer::EnsureRadixTree() {
+    if (!m_radixTree) {
+        m_radixTree = std::make_unique<AdaptiveRadixTree>();
+        m_radixTree->SetStepCallback([this](const std::string& description) { RecordStep(description); });
+    }
+}
+
+// Leaves get one column each in key order and every inner node is centred over its
+// leaves. Inner nodes are boxes labelled with their layout and compressed prefix
+// length, edges carry the branching byte, and the node the last mutation created
+// or re-laid-out is outlined.
+void TreeVisualizer::RenderRadixTree(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize) {
+    PROFILE_SCOPE("TreeVisualizer::RenderRadixTree");
+    using Node = AdaptiveRadixTree::Node;
+    using NodeType = AdaptiveRadixTree::NodeType;
+    const Node* root = m_radixTree->Root();
+    if (!root) {
+        return;
+    }
+    
+    struct PlacedNode {
+        const Node* node;
+        int parent;
+        int depth;
+        uint8_t byte;
+        float column;
+    };
+    std::vector<PlacedNode> placed;
+    int leafColumns = 0;
+    int depthCount = 1;
+    std::function<float(const Node*, int, int, uint8_t)> place = [&](const Node* node, int parent, int depth,
+                                                                    uint8_t byte) {
+        const int index = static_cast<int>(placed.size());
+        placed.push_back({ node, parent, depth, byte, 0.0f });
+        depthCount = std::max(depthCount, depth + 1);
+        if (node->type == NodeType::Leaf) {
+            placed[index].column = static_cast<float>(leafColumns++);
+            return placed[index].column;
+        }
+        float first = -1.0f;
+        float last = 0.0f;
+        AdaptiveRadixTree::ForEachChild(static_cast<const AdaptiveRadixTree::InnerNode*>(node),
+                                        [&](uint8_t childByte, const Node* child) {
+            last = place(child, index, depth + 1, childByte);
+            if (first < 0.0f) {
+                first = last;
+            }
+        });
+        placed[index].column = (first + last) / 2;
+        return placed[index].column;
+    };
+    place(root, -1, 0, 0);
+    
+    const float columnWidth = std::min(40.0f, (canvasSize.x - 40.0f) / std::max(leafColumns, 1));
+    const float levelHeight = std::min(80.0f, (canvasSize.y - 90.0f) / depthCount);
+    const float radius = std::clamp(columnWidth * 0.4f, 2.0f, 14.0f);
+    const float boxHalfWidth = std::clamp(columnWidth * 0.9f, 4.0f, 28.0f);
+    const float boxHeight = 20.0f;
+    auto position = [&](const PlacedNode& entry) {
+        return ImVec2(canvasPos.x + 20.0f + (entry.column + 0.5f) * columnWidth, canvasPos.y + 50.0f + entry.depth * levelHeight);
+    };
+    
+    for (const PlacedNode& entry : placed) {
+        if (entry.parent < 0) {
+            continue;
+        }
+        ImVec2 from = position(placed[entry.parent]);
+        ImVec2 to = position(entry);
+        from.y += boxHeight / 2;
+        drawList->AddLine(from, to, IM_COL32(150, 150, 150, 255), 1.5f);
+        if (columnWidth >= 18.0f) {
+            std::string byteStr = fmt::format("{:02x}", entry.byte);
+            drawList->AddText(ImVec2((from.x + to.x) / 2 + 2, (from.y + to.y) / 2 - 6), IM_COL32(180, 180, 180, 255),
+                              byteStr.c_str());
+        }
+    }
+    
+    struct TypeStyle {
+        const char* label;
+        ImU32 color;
+    };
+    auto typeStyle = [](NodeType type) -> TypeStyle {
+        switch (type) {
+            case NodeType::Node4: return { "N4", IM_COL32(70, 70, 200, 255) };
+            case NodeType::Node16: return { "N16", IM_COL32(40, 140, 90, 255) };
+            case NodeType::Node48: return { "N48", IM_COL32(200, 120, 40, 255) };
+            case NodeType::Node256: return { "N256", IM_COL32(170, 50, 50, 255) };
+            default: return { "?", IM_COL32(90, 90, 90, 255) };
+        }
+    };
+    
+    for (const PlacedNode& entry : placed) {
+        const ImVec2 center = position(entry);
+        if (entry.node->type == NodeType::Leaf) {
+            const auto* leaf = static_cast<const AdaptiveRadixTree::Leaf*>(entry.node);
+            drawList->AddCircleFilled(center, radius, IM_COL32(70, 70, 200, 255));
+            if (radius >= LABEL_NODE_RADIUS) {
+                std::string valueStr = std::to_string(AdaptiveRadixTree::DecodeInt(leaf->key));
+                ImVec2 textSize = ImGui::CalcTextSize(valueStr.c_str());
+                drawList->AddText(ImVec2(center.x - textSize.x / 2, center.y - textSize.y / 2),
+                                  IM_COL32(255, 255, 255, 255), valueStr.c_str());
+            }
+            continue;
+        }
+        
+        const auto* inner = static_cast<const AdaptiveRadixTree::InnerNode*>(entry.node);
+        const ImVec2 boxMin(center.x - boxHalfWidth, center.y - boxHeight / 2);
+        const ImVec2 boxMax(center.x + boxHalfWidth, center.y + boxHeight / 2);
+        const TypeStyle style = typeStyle(inner->type);
+        drawList->AddRectFilled(boxMin, boxMax, style.color);
+        const bool changed = entry.node == m_radixTree->LastChanged();
+        drawList->AddRect(boxMin, boxMax, changed ? IM_COL32(255, 255, 0, 255) : IM_COL32(255, 255, 255, 255), 0.0f, 0,
+                          changed ? 3.0f : 1.0f);
+        
+        // "N16" or "N16 p2" when the node carries a compressed prefix
+        std::string label = style.label;
+        if (inner->prefixLength > 0) {
+            label += fmt::format(" p{}", inner->prefixLength);
+        }
+        ImVec2 textSize = ImGui::CalcTextSize(label.c_str());
+        if (textSize.x <= 2 * boxHalfWidth) {
+            drawList->AddText(ImVec2(center.x - textSize.x / 2, center.y - textSize.y / 2),
+                              IM_COL32(255, 255, 255, 255), label.c_str());
+        }
+        if (ImGui::IsMouseHoveringRect(boxMin, boxMax)) {
+            ImGui::SetTooltip("%s, %u children, prefix length %u", AdaptiveRadixTree::NodeTypeName(inner->type),
+                              inner->childCount, inner->prefixLength);
+        }
+    }
+}
+
+// Patricia trie implementations
+void TreeVisualizer::EnsureTrie() {
+    if (!m_trie) {
+        m_trie = std::make_unique<PatriciaTrie>(static_cast<PatriciaTrie::ChildLayout>(m_trieLayout));
+        m_trie->SetStepCallback([this](const std::string& description) { RecordStep(description); });
+    }
+}
+
+void TreeVisualizer::RebuildTrie() {
+    if (!m_trie) {
+        return; // EnsureTrie picks up the new layout
+    }
+    std::vector<std::string> words;
+    words.reserve(m_trie->Size());
+    m_trie->ForEach([&](std::string_view word) { words.emplace_back(word); });
+    
+    // Sorted input builds each node's child list in order, without shifting
+    const auto layout = static_cast<PatriciaTrie::ChildLayout>(m_trieLayout);
+    auto rebuilt = std::make_unique<PatriciaTrie>(layout);
+    for (const std::string& word : words) {
+        rebuilt->Insert(word);
+    }
+    rebuilt->SetStepCallback([this](const std::string& description) { RecordStep(description); });
+    m_trie = std::move(rebuilt);
+    m_triePath.clear();
+    RecordStep(nullptr, "Rebuilt {} words with {}: {} bytes", words.size(), PatriciaTrie::LayoutName(layout),
+               m_trie->MemoryBytes());
+}
+
+void TreeVisualizer::InsertWord(const std::string& word) {
+    EnsureTrie();
+    m_triePath.clear();
+    if (word.empty()) {
+        RecordStep("Enter a word first");
+        return;
+    }
+    if (!m_trie->Insert(word)) {
+        RecordStep(nullptr, "Word \"{}\" already present", word);
+    }
+    m_nodeCount = static_cast<int>(m_trie->Size());
+    m_treeHeight = m_trie->Height();
+}
+
+void TreeVisualizer::EraseWord(const std::string& word) {
+    EnsureTrie();
+    m_triePath.clear();
+    if (!m_trie->Erase(word)) {
+        RecordStep(nullptr, "Word \"{}\" not found", word);
+    }
+    m_nodeCount = static_cast<int>(m_trie->Size());
+    m_treeHeight = m_trie->Height();
+}
+
+void TreeVisualizer::FindWord(const std::string& word) {
+    EnsureTrie();
+    ResetVisualization();
+    m_startTime = std::chrono::high_resolution_clock::now();
+    RecordStep(nullptr, "Searching for \"{}\"", word);
+    
+    m_triePath = m_trie->SearchPath(word);
+    for (size_t i = 1; i < m_triePath.size(); ++i) {
+        RecordStep(nullptr, "Following edge \"{}\"", PrintableLabel(m_triePath[i]->edge, TRIE_EDGE_LABEL));
+    }
+    m_comparisons = static_cast<int>(m_triePath.size());
+    if (m_trie->Contains(word)) {
+        RecordStep(nullptr, "Found \"{}\"", word);
+    } else {
+        RecordStep(nullptr, "\"{}\" is not a word in the trie", word);
+    }
+    
+    m_endTime = std::chrono::high_resolution_clock::now();
+    m_operationTime = std::chrono::duration<double, std::milli>(m_endTime - m_startTime).count();
+}
+
+void TreeVisualizer::PrefixScanWords(const std::string& prefix) {
+    EnsureTrie();
+    ResetVisualization();
+    m_startTime = std::chrono::high_resolution_clock::now();
+    m_triePath = m_trie->SearchPath(prefix);
+    m_trieMatches = m_trie->PrefixKeys(prefix, TRIE_MATCH_LIMIT);
+    m_endTime = std::chrono::high_resolution_clock::now();
+    m_operationTime = std::chrono::duration<double, std::milli>(m_endTime - m_startTime).count();
+    RecordStep(nullptr, "Prefix \"{}\": {} word(s){}", prefix, m_trieMatches.size(),
+               m_trieMatches.size() == TRIE_MATCH_LIMIT ? " (limit reached)" : "");
+}
+
+void TreeVisualizer::RangeScanWords(const std::string& low, const std::string& high) {
+    EnsureTrie();
+    ResetVisualization();
+    m_startTime = std::chrono::high_resolution_clock::now();
+    m_triePath.clear();
+    m_trieMatches = m_trie->RangeKeys(std::min(low, high), std::max(low, high), TRIE_MATCH_LIMIT);
+    m_endTime = std::chrono::high_resolution_clock::now();
+    m_operationTime = std::chrono::duration<double, std::milli>(m_endTime - m_startTime).count();
+    RecordStep(nullptr, "Range [\"{}\", \"{}\"]: {} word(s){}", std::min(low, high), std::max(low, high),
+               m_trieMatches.size(), m_trieMatches.size() == TRIE_MATCH_LIMIT ? " (limit reached)" : "");
+}
+
+void TreeVisualizer::LoadDictionary(const std::string& path) {
+    ResetVisualization();
+    std::ifstream input(path);
+    if (!input) {
+        RecordStep(nullptr, "Could not open {}", path);
+        return;
+    }
+    EnsureTrie();
+    m_triePath.clear();
+    m_startTime = std::chrono::high_resolution_clock::now();
+    // One step per edge split would swamp the step list
+    const bool recordSteps = m_recordSteps;
+    m_recordSteps = false;
+    const size_t added = m_trie->LoadWords(input);
+    m_recordSteps = recordSteps;
+    m_endTime = std::chrono::high_resolution_clock::now();
+    m_operationTime = std::chrono::duration<double, std::milli>(m_endTime - m_startTime).count();
+    
+    m_nodeCount = static_cast<int>(m_trie->Size());
+    m_treeHeight = m_trie->Height();
+    RecordStep(nullptr, "Loaded {} new word(s) from {} in {:.1f} ms", added, path, m_operationTime);
+}
+
+// Nodes with no drawn children get one column each and parents are centred over them,
+// as for the radix tree. A big trie is drawn from the node under the word field, cut
+// to as many levels as fit TRIE_DRAW_LIMIT nodes; cut nodes show their child count.
+void TreeVisualizer::RenderPatriciaTrie(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize) {
+    PROFILE_SCOPE("TreeVisualizer::RenderPatriciaTrie");
+    using Node = PatriciaTrie::Node;
+    const Node* top = m_trie->Root();
+    std::string topPath;
+    if (m_trie->NodeCount() > TRIE_DRAW_LIMIT) {
+        const auto [focus, depth] = m_trie->FindPrefixNode(m_trieWord);
+        if (focus) {
+            top = focus;
+            topPath.assign(m_trieWord, depth);
+        }
+    }
+    
+    // Deepest level such that every node down to it fits the limit
+    int maxDepth = 0;
+    {
+        std::vector<const Node*> level = { top };
+        size_t drawn = 1;
+        while (!level.empty()) {
+            std::vector<const Node*> next;
+            for (const Node* node : level) {
+                PatriciaTrie::ForEachChild(node, [&](uint8_t, const Node* child) { next.push_back(child); });
+            }
+            drawn += next.size();
+            if (next.empty() || drawn > TRIE_DRAW_LIMIT) {
+                break;
+            }
+            maxDepth++;
+            level = std::move(next);
+        }
+    }
+    
+    struct PlacedNode {
+        const Node* node;
+        int parent;
+        int depth;
+        float column;
+        std::string path;
+    };
+    std::vector<PlacedNode> placed;
+    int columns = 0;
+    std::function<float(const Node*, int, int, const std::string&)> place = [&](const Node* node, int parent, int depth,
+                                                                              const std::string& path) {
+        const int index = static_cast<int>(placed.size());
+        placed.push_back({ node, parent, depth, 0.0f, path + node->edge });
+        if (depth == maxDepth || node->childCount == 0) {
+            placed[index].column = static_cast<float>(columns++);
+            return placed[index].column;
+        }
+        float first = -1.0f;
+        float last = 0.0f;
+        const std::string nodePath = placed[index].path; // placed grows while the children are placed
+        PatriciaTrie::ForEachChild(node, [&](uint8_t, const Node* child) {
+            last = place(child, index, depth + 1, nodePath);
+            if (first < 0.0f) {
+                first = last;
+            }
+        });
+        placed[index].column = (first + last) / 2;
+        return placed[index].column;
+    };
+    place(top, -1, 0, topPath);
+    
+    const float columnWidth = std::min(60.0f, (canvasSize.x - 40.0f) / std::max(columns, 1));
+    const float levelHeight = std::min(80.0f, (canvasSize.y - 90.0f) / (maxDepth + 1));
+    const float radius = std::clamp(columnWidth * 0.3f, 2.0f, 10.0f);
+    auto position = [&](const PlacedNode& entry) {
+        return ImVec2(canvasPos.x + 20.0f + (entry.column + 0.5f) * columnWidth, canvasPos.y + 60.0f + entry.depth * levelHeight);
+    };
+    
+    if (top != m_trie->Root()) {
+        const std::string caption = fmt::format("Subtree under \"{}\"", PrintableLabel(topPath + top->edge, 40));
+        drawList->AddText(ImVec2(canvasPos.x + 10, canvasPos.y + 30), IM_COL32(200, 200, 200, 255), caption.c_str());
+    }
+    
+    for (const PlacedNode& entry : placed) {
+        if (entry.parent < 0) {
+            continue;
+        }
+        const ImVec2 from = position(placed[entry.parent]);
+        const ImVec2 to = position(entry);
+        drawList->AddLine(from, to, IM_COL32(150, 150, 150, 255), 1.5f);
+        if (columnWidth >= 30.0f) {
+            const std::string label = PrintableLabel(entry.node->edge, TRIE_EDGE_LABEL);
+            drawList->AddText(ImVec2((from.x + to.x) / 2 + 3, (from.y + to.y) / 2 - 7), IM_COL32(220, 220, 160, 255),
+                              label.c_str());
+        }
+    }
+    
+    for (const PlacedNode& entry : placed) {
+        const ImVec2 center = position(entry);
+        const Node* node = entry.node;
+        drawList->AddCircleFilled(center, radius, node->terminal ? IM_COL32(40, 160, 80, 255) : IM_COL32(70, 70, 200, 255));
+        const bool onPath = std::find(m_triePath.begin(), m_triePath.end(), node) != m_triePath.end();
+        drawList->AddCircle(center, radius, onPath ? IM_COL32(255, 255, 0, 255) : IM_COL32(255, 255, 255, 255), 0,
+                            onPath ? 3.0f : 1.0f);
+        if (entry.depth == maxDepth && node->childCount > 0) {
+            const std::string more = fmt::format("+{}", node->childCount);
+            drawList->AddText(ImVec2(center.x - radius, center.y + radius + 2), IM_COL32(180, 180, 180, 255),
+                              more.c_str());
+        }
+        if (ImGui::IsMouseHoveringRect(ImVec2(center.x - radius, center.y - radius),
+                                       ImVec2(center.x + radius, center.y + radius))) {
+            ImGui::SetTooltip("\"%s\"%s, %u children", PrintableLabel(entry.path, 40).c_str(),
+                              node->terminal ? " (word)" : "", node->childCount);
+        }
+    }
+}
+
+// Segment tree / Fenwick tree implementations
+bool TreeVisualizer::IsRangeTreeAlgorithm() const {
+    return m_currentAlgorithm == TreeAlgorithm::SegmentTree || m_currentAlgorithm == TreeAlgorithm::FenwickTree;
+}
+
+void TreeVisualizer::EnsureRangeTree() {
+    if (m_rangeValues.empty()) {
+        RebuildRangeTree();
+    }
+}
+
+// Fresh random elements in [0, 9] for the current structure
+void TreeVisualizer::RebuildRangeTree() {
+    static std::mt19937 rng(std::random_device{}());
+    std::uniform_int_distribution<int> dist(0, 9);
+    
+    m_rangeValues.resize(m_rangeElements);
+    for (int64_t& value : m_rangeValues) {
+        value = dist(rng);
+    }
+    m_rangeLeft = std::min(m_rangeLeft, m_rangeElements - 1);
+    m_rangeRight = std::min(m_rangeRight, m_rangeElements - 1);
+    m_segmentTrace = {};
+    m_fenwickTrace = {};
+    
+    m_segmentTree.reset();
+    m_fenwickTree.reset();
+    if (m_currentAlgorithm == TreeAlgorithm::SegmentTree) {
+        m_segmentTree = std::make_unique<SegmentTree>(m_rangeValues);
+    } else {
+        m_fenwickTree = std::make_unique<FenwickTree>(m_rangeValues);
+    }
+    m_nodeCount = m_rangeElements;
+}
+
+void TreeVisualizer::RangeAddValues(int delta) {
+    EnsureRangeTree();
+    const int left = std::min(m_rangeLeft, m_rangeRight);
+    const int right = std::max(m_rangeLeft, m_rangeRight);
+    
+    ResetVisualization();
+    m_startTime = std::chrono::high_resolution_clock::now();
+    if (m_segmentTree) {
+        m_segmentTrace = m_segmentTree->TraceQuery(left, right);
+        m_segmentTrace.pushed.clear(); // Adds never push; the covering nodes take the tag
+        m_segmentTree->RangeAdd(left, right, delta);
+        m_comparisons = static_cast<int>(m_segmentTrace.cover.size());
+        RecordStep(nullptr, "Tagged {} covering node(s) with {:+}, then recomputed their ancestors",
+                   m_segmentTrace.cover.size(), delta);
+    } else {
+        m_fenwickTree->RangeAdd(left, right, delta);
+        m_fenwickTrace = {};
+        RecordStep(nullptr, "Difference {:+} at index {} and {:+} after index {}", delta, left, -delta, right);
+    }
+    for (int i = left; i <= right; ++i) {
+        m_rangeValues[i] += delta;
+    }
+    m_endTime = std::chrono::high_resolution_clock::now();
+    m_operationTime = std::chrono::duration<double, std::milli>(m_endTime - m_startTime).count();
+    RecordStep(nullptr, "Added {} to elements [{}, {}]", delta, left, right);
+}
+
+void TreeVisualizer::RangeQueryValues(bool minimum) {
+    EnsureRangeTree();
+    const int left = std::min(m_rangeLeft, m_rangeRight);
+    const int right = std::max(m_rangeLeft, m_rangeRight);
+    
+    ResetVisualization();
+    m_startTime = std::chrono::high_resolution_clock::now();
+    int64_t result = 0;
+    if (m_segmentTree) {
+        m_segmentTrace = m_segmentTree->TraceQuery(left, right);
+        for (int node : m_segmentTrace.pushed) {
+            RecordStep(nullptr, "Pushing pending {:+} from node {} to its children", m_segmentTree->NodeLazy(node), node);
+        }
+        result = minimum ? m_segmentTree->RangeMin(left, right) : m_segmentTree->RangeSum(left, right);
+        for (int node : m_segmentTrace.cover) {
+            RecordStep(nullptr, "Combining node {} ({} = {})", node, minimum ? "min" : "sum",
+                       minimum ? m_segmentTree->NodeMin(node) : m_segmentTree->NodeSum(node));
+        }
+        m_comparisons = static_cast<int>(m_segmentTrace.cover.size());
+    } else {
+        m_fenwickTrace = m_fenwickTree->TraceSum(left, right);
+        result = m_fenwickTree->RangeSum(left, right);
+        RecordStep(nullptr, "prefix({}) reads node(s) {}", right + 1, fmt::join(m_fenwickTrace.added, ", "));
+        if (!m_fenwickTrace.subtracted.empty()) {
+            RecordStep(nullptr, "prefix({}) reads node(s) {}", left, fmt::join(m_fenwickTrace.subtracted, ", "));
+        }
+        m_comparisons = static_cast<int>(m_fenwickTrace.added.size() + m_fenwickTrace.subtracted.size());
+    }
+    m_endTime = std::chrono::high_resolution_clock::now();
+    m_operationTime = std::chrono::duration<double, std::milli>(m_endTime - m_startTime).count();
+    RecordStep(nullptr, "Range {} of [{}, {}] = {} ({} nodes)", minimum ? "min" : "sum", left, right, result,
+               m_comparisons);
+}
+
+// Heap layout: one row per level, node i at slot i - 2^depth. Boxes show the stored
+// sum over the minimum and the pending add above; padding beyond the elements is omitted.
+void TreeVisualizer::RenderSegmentTree(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize) {
+    PROFILE_SCOPE("TreeVisualizer::RenderSegmentTree");
+    const SegmentTree& tree = *m_segmentTree;
+    const int levels = tree.Height() + 1;
+    const float levelHeight = std::min(70.0f, (canvasSize.y - 90.0f) / levels);
+    const float boxHeight = std::min(34.0f, levelHeight - 6.0f);
+    const float top = canvasPos.y + 50.0f;
+    const float width = canvasSize.x - 40.0f;
+    
+    auto nodeRect = [&](int node, int depth) {
+        const float slot = width / static_cast<float>(1 << depth);
+        const float x = canvasPos.x + 20.0f + (node - (1 << depth)) * slot;
+        const float y = top + depth * levelHeight;
+        return std::pair{ ImVec2(x + 2, y), ImVec2(x + std::max(slot - 2, 3.0f), y + boxHeight) };
+    };
+    auto firstElement = [&](int depth, int node) { return (node << (tree.Height() - depth)) - tree.Leaves(); };
+    auto contains = [](const std::vector<int>& nodes, int node) {
+        return std::find(nodes.begin(), nodes.end(), node) != nodes.end();
+    };
+    
+    for (int depth = 0; depth < levels; ++depth) {
+        for (int node = 1 << depth; node < 2 << depth; ++node) {
+            if (firstElement(depth, node) >= tree.Size()) {
+                break;
+            }
+            auto [boxMin, boxMax] = nodeRect(node, depth);
+            if (depth + 1 < levels) {
+                for (int child : { 2 * node, 2 * node + 1 }) {
+                    if (firstElement(depth + 1, child) < tree.Size()) {
+                        auto [childMin, childMax] = nodeRect(child, depth + 1);
+                        drawList->AddLine(ImVec2((boxMin.x + boxMax.x) / 2, boxMax.y),
+                                          ImVec2((childMin.x + childMax.x) / 2, childMin.y),
+                                          IM_COL32(150, 150, 150, 255), 1.0f);
+                    }
+                }
+            }
+            
+            ImU32 color = IM_COL32(70, 70, 200, 255);
+            if (contains(m_segmentTrace.cover, node)) {
+                color = IM_COL32(255, 200, 0, 255);
+            } else if (contains(m_segmentTrace.pushed, node)) {
+                color = IM_COL32(255, 120, 0, 255);
+            }
+            drawList->AddRectFilled(boxMin, boxMax, color);
+            drawList->AddRect(boxMin, boxMax, IM_COL32(255, 255, 255, 255));
+            
+            const float boxWidth = boxMax.x - boxMin.x;
+            std::string sumStr = std::to_string(tree.NodeSum(node));
+            std::string minStr = fmt::format("m{}", tree.NodeMin(node));
+            ImVec2 sumSize = ImGui::CalcTextSize(sumStr.c_str());
+            ImVec2 minSize = ImGui::CalcTextSize(minStr.c_str());
+            if (sumSize.x <= boxWidth) {
+                const bool twoLines = minSize.x <= boxWidth && boxHeight >= 2 * sumSize.y;
+                const float textY = twoLines ? boxMin.y + 1 : boxMin.y + (boxHeight - sumSize.y) / 2;
+                drawList->AddText(ImVec2(boxMin.x + (boxWidth - sumSize.x) / 2, textY), IM_COL32(255, 255, 255, 255),
+                                  sumStr.c_str());
+                if (twoLines) {
+                    drawList->AddText(ImVec2(boxMin.x + (boxWidth - minSize.x) / 2, boxMax.y - minSize.y - 1),
+                                      IM_COL32(200, 200, 255, 255), minStr.c_str());
+                }
+            }
+            if (tree.NodeLazy(node) != 0) {
+                std::string lazyStr = fmt::format("{:+}", tree.NodeLazy(node));
+                drawList->AddText(ImVec2(boxMax.x - ImGui::CalcTextSize(lazyStr.c_str()).x, boxMin.y - 13),
+                                  IM_COL32(255, 165, 0, 255), lazyStr.c_str());
+            }
+            if (ImGui::IsMouseHoveringRect(boxMin, boxMax)) {
+                const int first = firstElement(depth, node);
+                const int last = std::min(first + (tree.Leaves() >> depth), tree.Size()) - 1;
+                ImGui::SetTooltip("Node %d: elements [%d, %d], sum %lld, min %lld, pending %+lld", node, first, last,
+                                  static_cast<long long>(tree.NodeSum(node)), static_cast<long long>(tree.NodeMin(node)),
+                                  static_cast<long long>(tree.NodeLazy(node)));
+            }
+        }
+    }
+}
+
+// The element array along the bottom; node i is a bar over the elements it covers,
+// raised by the number of trailing zero bits in i
+void TreeVisualizer::RenderFenwickTree(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize) {
+    PROFILE_SCOPE("TreeVisualizer::RenderFenwickTree");
+    const int size = m_fenwickTree->Size();
+    const int rows = std::bit_width(static_cast<unsigned int>(size)) + 1;
+    const float columnWidth = (canvasSize.x - 40.0f) / std::max(size, 1);
+    const float rowHeight = std::min(40.0f, (canvasSize.y - 90.0f) / rows);
+    const float baseY = canvasPos.y + canvasSize.y - 40.0f;
+    auto columnX = [&](int index) { return canvasPos.x + 20.0f + index * columnWidth; };
+    auto drawLabel = [&](const ImVec2& boxMin, const ImVec2& boxMax, const std::string& label) {
+        ImVec2 textSize = ImGui::CalcTextSize(label.c_str());
+        if (textSize.x <= boxMax.x - boxMin.x) {
+            drawList->AddText(ImVec2((boxMin.x + boxMax.x - textSize.x) / 2, (boxMin.y + boxMax.y - textSize.y) / 2),
+                              IM_COL32(255, 255, 255, 255), label.c_str());
+        }
+    };
+    
+    std::vector<int64_t> prefix(size + 1, 0);
+    for (int i = 0; i < size; ++i) {
+        prefix[i + 1] = prefix[i] + m_rangeValues[i];
+        ImVec2 boxMin(columnX(i) + 1, baseY - rowHeight + 2);
+        ImVec2 boxMax(columnX(i + 1) - 1, baseY);
+        drawList->AddRectFilled(boxMin, boxMax, IM_COL32(90, 90, 90, 255));
+        drawLabel(boxMin, boxMax, std::to_string(m_rangeValues[i]));
+    }
+    
+    auto contains = [](const std::vector<int>& nodes, int node) {
+        return std::find(nodes.begin(), nodes.end(), node) != nodes.end();
+    };
+    for (int node = 1; node <= size; ++node) {
+        auto [first, last] = FenwickTree::NodeRange(node);
+        const int row = std::countr_zero(static_cast<unsigned int>(node)) + 1;
+        ImVec2 boxMin(columnX(first) + 1, baseY - (row + 1) * rowHeight + 2);
+        ImVec2 boxMax(columnX(last + 1) - 1, baseY - row * rowHeight);
+        
+        ImU32 color = IM_COL32(70, 70, 200, 255);
+        if (contains(m_fenwickTrace.added, node)) {
+            color = IM_COL32(40, 170, 90, 255);
+        } else if (contains(m_fenwickTrace.subtracted, node)) {
+            color = IM_COL32(200, 60, 60, 255);
+        }
+        drawList->AddRectFilled(boxMin, boxMax, color);
+        drawList->AddRect(boxMin, boxMax, IM_COL32(255, 255, 255, 255));
+        drawLabel(boxMin, boxMax, std::to_string(prefix[last + 1] - prefix[first]));
+        
+        if (ImGui::IsMouseHoveringRect(boxMin, boxMax)) {
+            ImGui::SetTooltip("Node %d covers elements [%d, %d]", node, first, last);
+        }
+    }
+}
+
+// B-tree / B+tree implementations
+bool TreeVisualizer::IsBTreeAlgorithm() const {
+    return m_currentAlgorithm == TreeAlgorithm::BTree || m_currentAlgorithm == TreeAlgorithm::BPlusTree;
+}
+
+void TreeVisualizer::EnsureBTree() {
+    if (!m_btree) {
+        RebuildBTree();
+    }
+}
+
+// Recreates the tree for the current variant and order, re-inserting the existing keys
+void TreeVisualizer::RebuildBTree() {
+    std::vector<int> keys = m_btree ? m_btree->Keys() : std::vector<int>{};
+    auto variant = m_currentAlgorithm == TreeAlgorithm::BPlusTree ? BTree::Variant::BPlusTree : BTree::Variant::BTree;
+    
+    m_btree = std::make_unique<BTree>(m_btreeOrder, variant);
+    for (int key : keys) {
+        m_btree->Insert(key);
+    }
+    m_btree->ResetStats();
+    m_btree->SetStepCallback([this](const std::string& description) { RecordStep(description); });
+    
+    m_nodeCount = static_cast<int>(m_btree->Size());
+    m_treeHeight = m_btree->Height();
+}
+
+// Bulk load without step recording; the key range grows with count so most keys are distinct
+void TreeVisualizer::InsertRandomKeys(int count) {
+    static std::mt19937 rng(std::random_device{}());
+    std::uniform_int_distribution<int> dist(1, std::max(999, count * 10));
+    
+    ResetVisualization();
+    auto startTime = std::chrono::high_resolution_clock::now();
+    m_recordSteps = false;
+    for (int i = 0; i < count; ++i) {
+        InsertValue(dist(rng));
+    }
+    m_recordSteps = true;
+    m_endTime = std::chrono::high_resolution_clock::now();
+    m_operationTime = std::chrono::duration<double, std::milli>(m_endTime - startTime).count();
+    RecordStep(nullptr, "Inserted {} random keys in {:.1f} ms", count, m_operationTime);
+}
+
+void TreeVisualizer::RangeScanValues(int low, int high) {
+    if (low > high) {
+        std::swap(low, high);
+    }
+    
+    ResetVisualization();
+    if (m_currentAlgorithm == TreeAlgorithm::AdaptiveRadixTree) {
+        EnsureRadixTree();
+        m_startTime = std::chrono::high_resolution_clock::now();
+        m_traversalResult = m_radixTree->RangeScan(low, high);
+        m_endTime = std::chrono::high_resolution_clock::now();
+        m_operationTime = std::chrono::duration<double, std::milli>(m_endTime - m_startTime).count();
+        RecordStep(nullptr, "Walking only the children whose bytes lie between those of {} and {}", low, high);
+        RecordStep(nullptr, "Range [{}, {}] returned {} keys", low, high, m_traversalResult.size());
+        m_showTraversal = true;
+        return;
+    }
+    
+    EnsureBTree();
+    m_startTime = std::chrono::high_resolution_clock::now();
+    m_traversalResult = m_btree->RangeScan(low, high);
+    m_endTime = std::chrono::high_resolution_clock::now();
+    m_operationTime = std::chrono::duration<double, std::milli>(m_endTime - m_startTime).count();
+    
+    if (m_btree->GetVariant() == BTree::Variant::BPlusTree) {
+        RecordStep(nullptr, "Descending to the leaf holding {}, then following the leaf chain", low);
+    } else {
+        RecordStep(nullptr, "In-order walk of subtrees overlapping [{}, {}]", low, high);
+    }
+    RecordStep(nullptr, "Range [{}, {}] returned {} keys", low, high, m_traversalResult.size());
+    m_showTraversal = true;
+}
+
+// Draws the tree level by level; each node is a row of key cells
+void TreeVisualizer::RenderBTree(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize) {
+    PROFILE_SCOPE("TreeVisualizer::RenderBTree");
+    struct PlacedNode {
+        const BTree::Node* node;
+        float left;
+        float width;
+    };
+    
+    std::vector<std::vector<PlacedNode>> levels;
+    std::vector<const BTree::Node*> current = { m_btree->Root() };
+    while (!current.empty()) {
+        std::vector<const BTree::Node*> next;
+        levels.emplace_back();
+        for (const BTree::Node* node : current) {
+            levels.back().push_back({ node, 0.0f, 0.0f });
+            for (const auto& child : node->children) {
+                next.push_back(child.get());
+            }
+        }
+        current = std::move(next);
+    }
+    
+    const float keyWidth = 30.0f;
+    const float boxHeight = 24.0f;
+    const float top = canvasPos.y + 40.0f;
+    const float levelHeight = std::min(90.0f, (canvasSize.y - 80.0f) / levels.size());
+    const bool bPlus = m_btree->GetVariant() == BTree::Variant::BPlusTree;
+    
+    for (auto& level : levels) {
+        float slot = canvasSize.x / level.size();
+        for (size_t i = 0; i < level.size(); ++i) {
+            float width = std::min(std::max(level[i].node->keys.size(), size_t(1)) * keyWidth, slot - 4.0f);
+            level[i].width = std::max(width, 1.0f);
+            level[i].left = canvasPos.x + slot * (i + 0.5f) - level[i].width / 2;
+        }
+    }
+    
+    // Edges: children of a level appear in order on the next level
+    for (size_t depth = 0; depth + 1 < levels.size(); ++depth) {
+        float parentY = top + depth * levelHeight + boxHeight;
+        float childY = top + (depth + 1) * levelHeight;
+        size_t cursor = 0;
+        for (const auto& parent : levels[depth]) {
+            size_t childCount = parent.node->children.size();
+            for (size_t c = 0; c < childCount; ++c) {
+                const auto& child = levels[depth + 1][cursor++];
+                float fromX = parent.left + parent.width * c / std::max(childCount - 1, size_t(1));
+                drawList->AddLine(ImVec2(fromX, parentY), ImVec2(child.left + child.width / 2, childY),
+                                 IM_COL32(150, 150, 150, 255), 1.5f);
+            }
+        }
+    }
+    
+    for (size_t depth = 0; depth < levels.size(); ++depth) {
+        float y = top + depth * levelHeight;
+        bool leafLevel = depth + 1 == levels.size();
+        ImU32 fillColor = leafLevel && bPlus ? IM_COL32(40, 140, 90, 255) : IM_COL32(70, 70, 200, 255);
+        
+        for (const auto& placed : levels[depth]) {
+            ImVec2 boxMin(placed.left, y);
+            ImVec2 boxMax(placed.left + placed.width, y + boxHeight);
+            drawList->AddRectFilled(boxMin, boxMax, fillColor);
+            drawList->AddRect(boxMin, boxMax, IM_COL32(255, 255, 255, 255));
+            
+            const auto& keys = placed.node->keys;
+            if (keys.empty()) {
+                continue;
+            }
+            
+            float cellWidth = placed.width / keys.size();
+            if (cellWidth >= keyWidth - 0.5f) {
+                for (size_t k = 0; k < keys.size(); ++k) {
+                    float cellX = placed.left + k * cellWidth;
+                    if (k > 0) {
+                        drawList->AddLine(ImVec2(cellX, y), ImVec2(cellX, y + boxHeight), IM_COL32(200, 200, 200, 255));
+                    }
+                    std::string keyStr = std::to_string(keys[k]);
+                    ImVec2 textSize = ImGui::CalcTextSize(keyStr.c_str());
+                    drawList->AddText(ImVec2(cellX + (cellWidth - textSize.x) / 2, y + (boxHeight - textSize.y) / 2),
+                                     IM_COL32(255, 255, 255, 255), keyStr.c_str());
+                }
+            } else {
+                // Too narrow for every key: show the key range if it fits
+                std::string rangeStr = fmt::format("{}..{}", keys.front(), keys.back());
+                ImVec2 textSize = ImGui::CalcTextSize(rangeStr.c_str());
+                if (textSize.x <= placed.width) {
+                    drawList->AddText(ImVec2(placed.left + (placed.width - textSize.x) / 2, y + (boxHeight - textSize.y) / 2),
+                                     IM_COL32(255, 255, 255, 255), rangeStr.c_str());
+                }
+            }
+        }
+        
+        // B+ tree leaf chain
+        if (leafLevel && bPlus) {
+            const auto& leaves = levels[depth];
+            float chainY = y + boxHeight / 2;
+            for (size_t i = 0; i + 1 < leaves.size(); ++i) {
+                float fromX = leaves[i].left + leaves[i].width;
+                float toX = leaves[i + 1].left;
+                if (toX - fromX < 6.0f) {
+                    continue;
+                }
+                drawList->AddLine(ImVec2(fromX, chainY), ImVec2(toX, chainY), IM_COL32(255, 165, 0, 255), 1.5f);
+                drawList->AddTriangleFilled(ImVec2(toX, chainY), ImVec2(toX - 5, chainY - 3), ImVec2(toX - 5, chainY + 3),
+                                           IM_COL32(255, 165, 0, 255));
+            }
+        }
+    }
+}
+
+// Benchmarks
+void TreeVisualizer::RenderBenchmarks() {
+    PROFILE_SCOPE("TreeVisualizer::RenderBenchmarks");
+    // One benchmark at a time; the worker runs it while the UI keeps drawing
+    const bool running = IsBenchmarkRunning();
+    ImGui::BeginDisabled(running);
+    ImGui::SliderInt("Benchmark Keys", &m_benchmarkKeys, 10000, 1000000);
+    if (ImGui::Button("Run Node Order Benchmark")) {
+        RunNodeOrderBenchmark();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Run Priority Queue Benchmark")) {
+        RunPriorityQueueBenchmark();
+    }
+    if (ImGui::Button("Run Concurrency Benchmark")) {
+        RunConcurrencyBenchmark();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Run Access Pattern Benchmark")) {
+        RunAccessPatternBenchmark();
+    }
+    if (ImGui::Button("Run Radix Tree Benchmark")) {
+        RunRadixTreeBenchmark();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Run Range Query Benchmark")) {
+        RunRangeQueryBenchmark();
+    }
+    if (ImGui::Button("Run Order Statistic Benchmark")) {
+        RunOrderStatisticBenchmark();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Run Static Layout Benchmark")) {
+        RunStaticLayoutBenchmark();
+    }
+    if (ImGui::Button("Run String Trie Benchmark")) {
+        RunStringTrieBenchmark();
+    }
+    ImGui::SameLine();
+    ImGui::TextDisabled("Uses the trie's dictionary path when it can be read");
+    ImGui::EndDisabled();
+    
+    if (running) {
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_benchmarkStartTime).count();
+        ImGui::Text("Running %s... %.1f s", m_benchmarkName.c_str(), elapsed);
+    } else if (!m_benchmarkReport.rows.empty() || !m_benchmarkReport.notes.empty()) {
+        RenderBenchmarkReport(m_benchmarkReport);
+    }
+}
+
+void TreeVisualizer::RenderBenchmarkReport(const BenchmarkReport& report) {
+    PROFILE_SCOPE("TreeVisualizer::RenderBenchmarkReport");
+    ImGui::TextWrapped("%s", report.title.c_str());
+    
+    if (!report.columns.empty() &&
+        ImGui::BeginTable("BenchmarkReport", static_cast<int>(report.columns.size()),
+                          ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollX)) {
+        for (const auto& column : report.columns) {
+            ImGui::TableSetupColumn(column.c_str());
+        }
+        ImGui::TableHeadersRow();
+        
+        for (const auto& row : report.rows) {
+            ImGui::TableNextRow();
+            for (size_t i = 0; i < row.size() && i < report.columns.size(); ++i) {
+                ImGui::TableSetColumnIndex(static_cast<int>(i));
+                ImGui::TextUnformatted(row[i].c_str());
+            }
+        }
+        ImGui::EndTable();
+    }
+    
+    for (const auto& note : report.notes) {
+        ImGui::TextDisabled("%s", note.c_str());
+    }
+}
+
+void TreeVisualizer::RunPriorityQueueBenchmark() {
+    HeapBenchmarkConfig config;
+    config.vertexCount = m_benchmarkKeys;
+    
+    StartBenchmark("Priority Queue Benchmark", [config] { return RunHeapBenchmark(config); });
+}
+
+void TreeVisualizer::RunAccessPatternBenchmark() {
+    AccessPatternBenchmarkConfig config;
+    config.keyCount = m_benchmarkKeys;
+    config.accessCount = m_benchmarkKeys * 5;
+    
+    StartBenchmark("Access Pattern Benchmark",
+                   [config] { return AlgorithmVisualizer::RunAccessPatternBenchmark(config); });
+}
+
+void TreeVisualizer::RunRadixTreeBenchmark() {
+    RadixTreeBenchmarkConfig config;
+    config.keyCount = m_benchmarkKeys;
+    config.lookupCount = m_benchmarkKeys * 2;
+    
+    StartBenchmark("Radix Tree Benchmark",
+                   [config] { return AlgorithmVisualizer::RunRadixTreeBenchmark(config); });
+}
+
+void TreeVisualizer::RunRangeQueryBenchmark() {
+    RangeQueryBenchmarkConfig config;
+    config.elementCount = m_benchmarkKeys;
+    config.updateCount = m_benchmarkKeys;
+    
+    StartBenchmark("Range Query Benchmark",
+                   [config] { return AlgorithmVisualizer::RunRangeQueryBenchmark(config); });
+}
+
+void TreeVisualizer::RunOrderStatisticBenchmark() {
+    OrderStatisticBenchmarkConfig config;
+    config.keyCount = m_benchmarkKeys;
+    config.queryCount = m_benchmarkKeys * 2;
+    
+    StartBenchmark("Order Statistic Benchmark",
+                   [config] { return AlgorithmVisualizer::RunOrderStatisticBenchmark(config); });
+}
+
+// Key counts are fixed so that they step across the cache levels; the slider sets the lookups per size
+void TreeVisualizer::RunStaticLayoutBenchmark() {
+    StaticLayoutBenchmarkConfig config;
+    config.lookupCount = m_benchmarkKeys * 10;
+    
+    StartBenchmark("Static Layout Benchmark",
+                   [config] { return AlgorithmVisualizer::RunStaticLayoutBenchmark(config); });
+}
+
+void TreeVisualizer::RunStringTrieBenchmark() {
+    StringTrieBenchmarkConfig config;
+    config.keyCount = m_benchmarkKeys;
+    config.lookupCount = m_benchmarkKeys * 5;
+    config.dictionaryPath = m_dictionaryPath;
+    
+    StartBenchmark("String Trie Benchmark",
+                   [config] { return AlgorithmVisualizer::RunStringTrieBenchmark(config); });
+}
+
+void TreeVisualizer::RunConcurrencyBenchmark() {
+    ConcurrentSetBenchmarkConfig config;
+    config.keyRange = m_benchmarkKeys;
+    
+    StartBenchmark("Concurrent Set Benchmark", [config] { return RunConcurrentSetBenchmark(config); });
+}
+
+void TreeVisualizer::RunNodeOrderBenchmark() {
+    BTreeBenchmarkConfig config;
+    config.keyCount = m_benchmarkKeys;
+    config.lookupCount = m_benchmarkKeys * 2;
+    
+    StartBenchmark("B-Tree Node Order Benchmark", [config] { return RunBTreeBenchmark(config); });
+}
+
+// Benchmarks only read their config, so they run on the benchmark worker untouched by the UI
+void TreeVisualizer::StartBenchmark(std::string name, std::function<BenchmarkReport()> run) {
+    if (IsBenchmarkRunning()) {
+        return;
+    }
+    if (!m_benchmarkPool) {
+        m_benchmarkPool = std::make_unique<TaskPool>(1);
+    }
+    m_benchmarkName = std::move(name);
+    m_benchmarkStartTime = std::chrono::steady_clock::now();
+    m_benchmarkResult = m_benchmarkPool->Submit(std::move(run));
+}
+
+void TreeVisualizer::PollBenchmark() {
+    if (!IsBenchmarkRunning() ||
+        m_benchmarkResult.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        return;
+    }
+    
+    try {
+        m_benchmarkReport = m_benchmarkResult.get();
+    } catch (const std::exception& e) {
+        m_benchmarkReport = BenchmarkReport{};
+        m_benchmarkReport.title = fmt::format("{} failed: {}", m_benchmarkName, e.what());
+        return;
+    }
+    
+    if (m_performanceCallback) {
+        m_performanceCallback(m_benchmarkName, m_benchmarkReport.totalMilliseconds,
+                              static_cast<int>(m_benchmarkReport.totalOperations), 0);
+    }
+}
+
+// Binary tree layout and view
+bool TreeVisualizer::IsBinaryTreeAlgorithm() const {
+    return m_currentAlgorithm == TreeAlgorithm::BinarySearchTree || m_currentAlgorithm == TreeAlgorithm::AVLTree ||
+           m_currentAlgorithm == TreeAlgorithm::RedBlackTree || m_currentAlgorithm == TreeAlgorithm::SplayTree ||
+           m_currentAlgorithm == TreeAlgorithm::Treap;
+}
+
+void TreeVisualizer::BuildLayout() {
+    PROFILE_SCOPE("TreeVisualizer::BuildLayout");
+    m_layoutDirty = false;
+    std::shared_ptr<const TreeSnapshot> snapshot = MakeSnapshot(IsBinaryTreeAlgorithm() ? m_root.get() : nullptr);
+    if (IsBinaryTreeAlgorithm()) {
+        m_nodeCount = static_cast<int>(snapshot->nodes.size());
+        m_treeHeight = snapshot->height;
+    }
+    m_snapshot.Publish(std::move(snapshot));
+}
+
+// Three linear passes over an explicit stack, so degenerate (list-shaped) trees
+// of any size never recurse: pre-order flatten, subtree sizes bottom-up, ranks top-down.
+// Only reads the tree, so the worker can call it on the tree it owns.
+std::shared_ptr<const TreeSnapshot> TreeVisualizer::MakeSnapshot(const TreeNode* root) {
+    auto snapshot = std::make_shared<TreeSnapshot>();
+    std::vector<TreeLayoutNode>& layout = snapshot->nodes;
+
+    struct Pending {
+        const TreeNode* node;
+        int parent;
+        bool isLeft;
+    };
+    std::vector<Pending> stack;
+    if (root) {
+        stack.push_back({ root, -1, false });
+    }
+    while (!stack.empty()) {
+        Pending pending = stack.back();
+        stack.pop_back();
+
+        const int index = static_cast<int>(layout.size());
+        const TreeNode* node = pending.node;
+        TreeLayoutNode& entry = layout.emplace_back();
+        entry.value = node->value;
+        entry.priority = node->priority;
+        entry.isHighlighted = node->isHighlighted;
+        entry.isNew = node->isNew;
+        entry.isDeleted = node->isDeleted;
+        entry.isRed = node->color == TreeNode::RED;
+        if (pending.parent >= 0) {
+            TreeLayoutNode& parent = layout[pending.parent];
+            entry.depth = parent.depth + 1;
+            (pending.isLeft ? parent.left : parent.right) = index;
+        }
+
+        if (node->right) {
+            stack.push_back({ node->right.get(), index, false });
+        }
+        if (node->left) {
+            stack.push_back({ node->left.get(), index, true });
+        }
+    }
+
+    // Children always follow their parent, so a reverse sweep sees them first
+    for (int i = static_cast<int>(layout.size()) - 1; i >= 0; --i) {
+        TreeLayoutNode& entry = layout[i];
+        entry.subtreeBottom = entry.depth;
+        for (int child : { entry.left, entry.right }) {
+            if (child >= 0) {
+                entry.subtreeSize += layout[child].subtreeSize;
+                entry.subtreeBottom = std::max(entry.subtreeBottom, layout[child].subtreeBottom);
+            }
+        }
+    }
+
+    for (TreeLayoutNode& entry : layout) {
+        entry.x = entry.minX + (entry.left >= 0 ? layout[entry.left].subtreeSize : 0);
+        if (entry.left >= 0) {
+            layout[entry.left].minX = entry.minX;
+        }
+        if (entry.right >= 0) {
+            layout[entry.right].minX = entry.x + 1;
+        }
+    }
+
+    snapshot->height = layout.empty() ? 0 : layout[0].subtreeBottom + 1;
+    return snapshot;
+}
+
+void TreeVisualizer::FitView(const TreeSnapshot& snapshot, const ImVec2& canvasSize) {
+    m_viewScale = 1.0f;
+    if (snapshot.nodes.empty()) {
+        return;
+    }
+
+    const float keys = static_cast<float>(snapshot.nodes[0].subtreeSize);
+    const float levels = static_cast<float>(snapshot.height);
+    m_fitUnitWidth = std::min(MAX_UNIT_WIDTH, std::max(canvasSize.x - 2 * VIEW_MARGIN, 1.0f) / keys);
+    m_fitLevelHeight = std::clamp((canvasSize.y - VIEW_TOP_MARGIN - VIEW_MARGIN) / levels, MIN_LEVEL_HEIGHT, MAX_LEVEL_HEIGHT);
+    m_viewOffsetX = (canvasSize.x - keys * m_fitUnitWidth) / 2;
+    m_viewOffsetY = VIEW_TOP_MARGIN;
+}
+
+float TreeVisualizer::ViewUnitWidth() const {
+    return m_fitUnitWidth * m_viewScale;
+}
+
+// Levels stop spreading once they reach full size so zooming into wide trees stays usable
+float TreeVisualizer::ViewLevelHeight() const {
+    return std::min(m_fitLevelHeight * m_viewScale, std::max(m_fitLevelHeight, MAX_LEVEL_HEIGHT));
+}
+
+void TreeVisualizer::HandleViewInput(const ImVec2& canvasPos) {
+    const ImGuiIO& io = ImGui::GetIO();
+    if (ImGui::IsItemHovered() && io.MouseWheel != 0.0f && m_nodeCount > 0) {
+        // Keep the tree point under the cursor fixed while zooming
+        const float mouseX = io.MousePos.x - canvasPos.x;
+        const float mouseY = io.MousePos.y - canvasPos.y;
+        const float rank = (mouseX - m_viewOffsetX) / ViewUnitWidth();
+        const float depth = (mouseY - m_viewOffsetY) / ViewLevelHeight();
+        const float maxScale = std::max(1.0f, MAX_UNIT_WIDTH / m_fitUnitWidth);
+        m_viewScale = std::clamp(m_viewScale * std::pow(1.2f, io.MouseWheel), 0.25f, maxScale);
+        m_viewOffsetX = mouseX - rank * ViewUnitWidth();
+        m_viewOffsetY = mouseY - depth * ViewLevelHeight();
+        m_autoFit = false;
+    }
+    if (ImGui::IsItemActive() && ImGui::IsMouseDragging(ImGuiMouseButton_Left)) {
+        m_viewOffsetX += io.MouseDelta.x;
+        m_viewOffsetY += io.MouseDelta.y;
+        m_autoFit = false;
+    }
+}
+
+// Walks the flat layout top-down, skipping subtrees that fall outside the canvas and
+// drawing subtrees too narrow to read as a single summary triangle, so the cost
+// tracks what is on screen rather than the size of the tree
+void TreeVisualizer::RenderTreeLayout(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize) {
+    PROFILE_SCOPE("TreeVisualizer::RenderTreeLayout");
+    m_visibleNodes = 0;
+    m_collapsedSubtrees = 0;
+    // Holding the pointer keeps this version alive for the frame, whatever the worker publishes meanwhile
+    std::shared_ptr<const TreeSnapshot> snapshot = m_snapshot.Load();
+    const std::vector<TreeLayoutNode>& layout = snapshot->nodes;
+    if (layout.empty()) {
+        return;
+    }
+    if (m_autoFit) {
+        FitView(*snapshot, canvasSize);
+    }
+
+    const float unit = ViewUnitWidth();
+    const float level = ViewLevelHeight();
+    const float originX = canvasPos.x + m_viewOffsetX;
+    const float originY = canvasPos.y + m_viewOffsetY;
+    const float radius = std::clamp(0.4f * std::min(unit, level), MIN_NODE_RADIUS, MAX_NODE_RADIUS);
+    const ImVec2 canvasMax(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y);
+    auto position = [&](const TreeLayoutNode& node) {
+        return ImVec2(originX + (node.x + 0.5f) * unit, originY + node.depth * level);
+    };
+
+    drawList->PushClipRect(canvasPos, canvasMax, true);
+
+    std::vector<int> stack = { 0 };
+    std::vector<int> visible;
+    while (!stack.empty()) {
+        const int index = stack.back();
+        stack.pop_back();
+        const TreeLayoutNode& node = layout[index];
+
+        const float left = originX + node.minX * unit;
+        const float right = left + node.subtreeSize * unit;
+        const float top = originY + node.depth * level;
+        const float bottom = originY + node.subtreeBottom * level;
+        if (right + radius < canvasPos.x || left - radius > canvasMax.x ||
+            bottom + radius < canvasPos.y || top - radius > canvasMax.y) {
+            continue;
+        }
+
+        const ImVec2 center = position(node);
+        if (node.subtreeSize > 1 && right - left < COLLAPSE_WIDTH) {
+            DrawCollapsedSubtree(node, drawList, center, left, right, std::max(bottom, top + radius));
+            m_collapsedSubtrees++;
+            continue;
+        }
+
+        for (int child : { node.left, node.right }) {
+            if (child >= 0) {
+                DrawEdge(drawList, center, position(layout[child]));
+                stack.push_back(child);
+            }
+        }
+        visible.push_back(index);
+    }
+
+    // Nodes go on top of every edge
+    for (int index : visible) {
+        DrawNode(layout[index], drawList, position(layout[index]), radius);
+    }
+    m_visibleNodes = static_cast<int>(visible.size());
+
+    drawList->PopClipRect();
+}
+
+void TreeVisualizer::DrawNode(const TreeLayoutNode& node, ImDrawList* drawList, const ImVec2& center, float radius) const {
+    ImU32 nodeColor = IM_COL32(70, 70, 200, 255);
+    if (m_currentAlgorithm == TreeAlgorithm::RedBlackTree) {
+        nodeColor = node.isRed ? IM_COL32(200, 40, 40, 255) : IM_COL32(40, 40, 40, 255);
+    }
+    if (node.isHighlighted) {
+        nodeColor = IM_COL32(255, 255, 0, 255);
+    } else if (node.isNew) {
+        nodeColor = IM_COL32(0, 255, 0, 255);
+    } else if (node.isDeleted) {
+        nodeColor = IM_COL32(255, 0, 0, 255);
+    }
+
+    drawList->AddCircleFilled(center, radius, nodeColor);
+    if (radius < LABEL_NODE_RADIUS) {
+        return;
+    }
+    drawList->AddCircle(center, radius, IM_COL32(255, 255, 255, 255), 0, 2.0f);
+
+    // Draw value
+    std::string valueStr = std::to_string(node.value);
+    ImVec2 textSize = ImGui::CalcTextSize(valueStr.c_str());
+    drawList->AddText(
+        ImVec2(center.x - textSize.x / 2, center.y - textSize.y / 2),
+        IM_COL32(255, 255, 255, 255),
+        valueStr.c_str()
+    );
+
+    if (m_showSubtreeSizes) {
+        std::string sizeStr = fmt::format("n{}", node.subtreeSize);
+        drawList->AddText(ImVec2(center.x + radius * 0.7f, center.y - radius - 12), IM_COL32(150, 220, 255, 255),
+                          sizeStr.c_str());
+    }
+
+    if (m_currentAlgorithm == TreeAlgorithm::Treap) {
+        std::string priorityStr = fmt::format("p{}", node.priority);
+        ImVec2 prioritySize = ImGui::CalcTextSize(priorityStr.c_str());
+        drawList->AddText(ImVec2(center.x - prioritySize.x / 2, center.y + radius + 1), IM_COL32(255, 165, 0, 255),
+                          priorityStr.c_str());
+    }
+}
+
+void TreeVisualizer::DrawEdge(ImDrawList* drawList, const ImVec2& from, const ImVec2& to) const {
+    drawList->AddLine(from, to, IM_COL32(150, 150, 150, 255), 2.0f);
+}
+
+void TreeVisualizer::DrawCollapsedSubtree(const TreeLayoutNode& node, ImDrawList* drawList, const ImVec2& apex,
+                                          float left, float right, float bottom) const {
+    const ImVec2 bottomLeft(std::min(left, apex.x - 1), bottom);
+    const ImVec2 bottomRight(std::max(right, apex.x + 1), bottom);
+    drawList->AddTriangleFilled(apex, bottomRight, bottomLeft, IM_COL32(70, 70, 200, 140));
+
+    if (ImGui::IsMouseHoveringRect(ImVec2(bottomLeft.x, apex.y), bottomRight)) {
+        ImGui::SetTooltip("%d keys under %d, depth %d-%d", node.subtreeSize, node.value, node.depth, node.subtreeBottom);
+    }
+}
+
+// Background jobs
+void TreeVisualizer::StartBackgroundJob(TreeJob job, int operations) {
+    if (IsBackgroundJobRunning() || !IsBinaryTreeAlgorithm()) {
+        return;
+    }
+    
+    ResetVisualization();
+    ThawTree("Background job");
+    m_recordSteps = false;
+    m_jobKind = job;
+    m_jobOperations = operations;
+    m_jobCancel.store(false, std::memory_order_relaxed);
+    m_jobFinished.store(false, std::memory_order_relaxed);
+    m_jobProgress.store(0, std::memory_order_relaxed);
+    m_jobStartTime = std::chrono::steady_clock::now();
+    m_jobRateTime = m_jobStartTime;
+    m_jobRateProgress = 0;
+    m_jobOpsPerSecond = 0.0;
+    m_jobThread = std::thread(&TreeVisualizer::RunBackgroundJob, this, job, operations, std::random_device{}());
+}
+
+// Worker thread. Works in batches, and after a batch publishes a new snapshot once
+// SNAPSHOT_INTERVAL has passed; on large trees the interval stretches so that
+// snapshot building stays a small fraction of the worker's time.
+void TreeVisualizer::RunBackgroundJob(TreeJob job, int operations, unsigned int seed) {
+    Profiler::SetThreadName("Tree job");
+    PROFILE_SCOPE("TreeVisualizer::RunBackgroundJob");
+    using Clock = std::chrono::steady_clock;
+    std::mt19937 rng(seed);
+    // Bulk inserts want mostly distinct keys; the mixed workload settles around a bounded size
+    const int keyRange = job == TreeJob::BulkInsert ? std::max(999, operations * 10) : std::max(999, operations / 4);
+    std::uniform_int_distribution<int> keys(1, keyRange);
+    std::uniform_int_distribution<int> mix(0, 3);
+    
+    Clock::time_point nextPublish = Clock::now() + SNAPSHOT_INTERVAL;
+    int done = 0;
+    while (done < operations && !m_jobCancel.load(std::memory_order_relaxed)) {
+        const int batchEnd = std::min(operations, done + JOB_BATCH);
+        for (; done < batchEnd; ++done) {
+            const int key = keys(rng);
+            const int choice = job == TreeJob::BulkInsert ? 0 : mix(rng);
+            if (choice <= 1) {
+                InsertTreeNode(key);
+            } else if (choice == 2) {
+                DeleteTreeNode(key);
+            } else {
+                FindTreeNode(key);
+            }
+        }
+        m_jobProgress.store(done, std::memory_order_relaxed);
+        
+        const Clock::time_point now = Clock::now();
+        if (now >= nextPublish) {
+            m_snapshot.Publish(MakeSnapshot(m_root.get()));
+            const Clock::time_point built = Clock::now();
+            nextPublish = built + std::max<Clock::duration>(SNAPSHOT_INTERVAL, (built - now) * SNAPSHOT_COST_FACTOR);
+        }
+    }
+    
+    m_snapshot.Publish(MakeSnapshot(m_root.get()));
+    m_jobFinished.store(true, std::memory_order_release);
+}
+
+void TreeVisualizer::PollBackgroundJob() {
+    if (!IsBackgroundJobRunning()) {
+        return;
+    }
+    
+    auto now = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(now - m_jobRateTime).count();
+    if (elapsed >= RATE_INTERVAL_SECONDS) {
+        int progress = m_jobProgress.load(std::memory_order_relaxed);
+        m_jobOpsPerSecond = (progress - m_jobRateProgress) / elapsed;
+        m_jobRateProgress = progress;
+        m_jobRateTime = now;
+    }
+    
+    std::shared_ptr<const TreeSnapshot> snapshot = m_snapshot.Load();
+    m_nodeCount = static_cast<int>(snapshot->nodes.size());
+    m_treeHeight = snapshot->height;
+    
+    if (m_jobFinished.load(std::memory_order_acquire)) {
+        FinishBackgroundJob();
+    }
+}
+
+void TreeVisualizer::FinishBackgroundJob() {
+    m_jobThread.join();
+    m_recordSteps = true;
+    m_layoutDirty = true;
+    
+    const int done = m_jobProgress.load(std::memory_order_relaxed);
+    m_operationTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_jobStartTime).count();
+    m_jobOpsPerSecond = m_operationTime > 0.0 ? done * 1000.0 / m_operationTime : 0.0;
+    const char* jobName = m_jobKind == TreeJob::BulkInsert ? "Bulk insert" : "Mixed workload";
+    RecordStep(nullptr, "{} finished {} of {} operations in {:.1f} ms ({:.0f} ops/sec)",
+               jobName, done, m_jobOperations, m_operationTime, m_jobOpsPerSecond);
+    
+    if (m_performanceCallback) {
+        m_performanceCallback(fmt::format("{} ({})", jobName, GetAlgorithmName(m_currentAlgorithm)), m_operationTime,
+                              done, 0);
+    }
+}
+
+void TreeVisualizer::RenderBackgroundJob() {
+    PROFILE_SCOPE("TreeVisualizer::RenderBackgroundJob");
+    if (!IsBackgroundJobRunning()) {
+        ImGui::SliderInt("Job Size", &m_jobSize, MIN_JOB_OPERATIONS, MAX_JOB_OPERATIONS, "%d ops",
+                         ImGuiSliderFlags_Logarithmic);
+        if (ImGui::Button("Bulk Insert")) {
+            StartBackgroundJob(TreeJob::BulkInsert, m_jobSize);
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Mixed Workload")) {
+            StartBackgroundJob(TreeJob::MixedWorkload, m_jobSize);
+        }
+        return;
+    }
+    
+    const int progress = m_jobProgress.load(std::memory_order_relaxed);
+    std::string overlay = fmt::format("{} / {}", progress, m_jobOperations);
+    ImGui::ProgressBar(static_cast<float>(progress) / m_jobOperations, ImVec2(-1, 0), overlay.c_str());
+    ImGui::Text("%.0f ops/sec", m_jobOpsPerSecond);
+    ImGui::SameLine();
+    if (ImGui::Button("Cancel Job")) {
+        m_jobCancel.store(true, std::memory_order_relaxed);
+    }
+}
+
+// Explicit stack of raw pointers: no recursion on degenerate trees and no refcount traffic per node
+void TreeVisualizer::InorderTraversal(const TreeNode* node, std::vector<int>& result) {
+    std::vector<const TreeNode*> stack;
+    size_t visited = 0;
+    while (node || !stack.empty()) {
+        while (node) {
+            stack.push_back(node);
+            node = node->left.get();
+        }
+        node = stack.back();
+        stack.pop_back();
+        result.push_back(node->value);
+        if (visited++ < TRAVERSAL_STEP_LIMIT) {
+            RecordStep(nullptr, "Visiting node {}", node->value);
+        }
+        node = node->right.get();
+    }
+    if (visited > TRAVERSAL_STEP_LIMIT) {
+        RecordStep(nullptr, "Visited {} more nodes without recording each", visited - TRAVERSAL_STEP_LIMIT);
+    }
+}
+
 void TreeVisualizer::ClearTree() {
     m_root = nullptr;
     m_heap.clear();
+    m_btree.reset();
+    m_pairingHeap.reset();
+    m_radixHeap.reset();
+    m_skipList.reset();
+    m_skipListPath.clear();
+    m_radixTree.reset();
+    m_trie.reset();
+    m_triePath.clear();
+    m_trieMatches.clear();
+    m_segmentTree.reset();
+    m_fenwickTree.reset();
+    m_rangeValues.clear();
+    m_segmentTrace = {};
+    m_fenwickTrace = {};
+    m_frozenTree.reset();
+    m_frozenPath.clear();
+    m_layoutDirty = true;
+    m_autoFit = true;
     m_nodeCount = 0;
     m_treeHeight = 0;
     m_comparisons = 0;
@@ -715,6 +2991,9 @@ void TreeVisualizer::ResetVisualization() {
 }
 
 void TreeVisualizer::RecordStep(const std::string& description, std::shared_ptr<TreeNode> highlighted) {
+    if (!m_recordSteps) {
+        return;
+    }
     TreeStep step;
     step.description = description;
     step.highlightedNode = highlighted;
@@ -735,28 +3014,461 @@ void TreeVisualizer::PlayStepSound(bool isComparison, bool isInsertion, bool isR
     }
 }
 
-// Placeholder implementations for advanced features
+// AVL tree: after every change on the way back up, a node whose subtrees differ in
+// height by two is rotated back into balance. Same rules as the AVLTree baseline.
 std::shared_ptr<TreeNode> TreeVisualizer::AVLInsert(std::shared_ptr<TreeNode> root, int value) {
-    // Simplified - would need full AVL implementation
-    return BSTInsert(root, value);
+    if (!root) {
+        RecordStep(nullptr, "Creating new node with value {}", value);
+        auto newNode = std::make_shared<TreeNode>(value);
+        newNode->isNew = true;
+        return newNode;
+    }
+    
+    RecordStep(root, "Comparing {} with {}", value, root->value);
+    m_comparisons++;
+    
+    if (value < root->value) {
+        root->left = AVLInsert(root->left, value);
+    } else if (value > root->value) {
+        root->right = AVLInsert(root->right, value);
+    } else {
+        RecordStep(root, "{} is already in the tree", value);
+        return root;
+    }
+    
+    UpdateSubtree(root);
+    return AVLRebalance(root);
 }
 
 std::shared_ptr<TreeNode> TreeVisualizer::AVLDelete(std::shared_ptr<TreeNode> root, int value) {
-    return BSTDelete(root, value);
+    if (!root) {
+        RecordStep(nullptr, "Value {} not found", value);
+        return root;
+    }
+    
+    RecordStep(root, "Comparing {} with {}", value, root->value);
+    m_comparisons++;
+    
+    if (value < root->value) {
+        root->left = AVLDelete(root->left, value);
+    } else if (value > root->value) {
+        root->right = AVLDelete(root->right, value);
+    } else {
+        RecordStep(root, "Found node to delete: {}", value);
+        root->isDeleted = true;
+        if (!root->left) {
+            return root->right;
+        } else if (!root->right) {
+            return root->left;
+        }
+        
+        std::shared_ptr<TreeNode> successor = root->right;
+        while (successor->left) {
+            successor = successor->left;
+        }
+        RecordStep(successor, "Replacing {} with its in-order successor {}", value, successor->value);
+        root->value = successor->value;
+        root->isDeleted = false;
+        root->right = AVLDelete(root->right, successor->value);
+    }
+    
+    UpdateSubtree(root);
+    return AVLRebalance(root);
+}
+
+std::shared_ptr<TreeNode> TreeVisualizer::AVLRebalance(std::shared_ptr<TreeNode> node) {
+    const int balance = GetBalance(node);
+    if (balance > 1) {
+        if (GetBalance(node->left) < 0) {
+            RecordStep(node, "Balance of {} is {}: left-right case", node->value, balance);
+            node->left = RotateLeft(node->left);
+        } else {
+            RecordStep(node, "Balance of {} is {}: left-left case", node->value, balance);
+        }
+        return RotateRight(node);
+    }
+    if (balance < -1) {
+        if (GetBalance(node->right) > 0) {
+            RecordStep(node, "Balance of {} is {}: right-left case", node->value, balance);
+            node->right = RotateRight(node->right);
+        } else {
+            RecordStep(node, "Balance of {} is {}: right-right case", node->value, balance);
+        }
+        return RotateLeft(node);
+    }
+    return node;
+}
+
+// Left-leaning red-black tree (Sedgewick), mirroring the RedBlackTree baseline:
+// a red node is the lower half of a 3-node and always hangs on the left
+std::shared_ptr<TreeNode> TreeVisualizer::RBInsert(std::shared_ptr<TreeNode> root, int value) {
+    root = RBInsertAt(root, value);
+    root->color = TreeNode::BLACK;
+    return root;
+}
+
+std::shared_ptr<TreeNode> TreeVisualizer::RBDelete(std::shared_ptr<TreeNode> root, int value) {
+    if (!ContainsKey(root.get(), value)) {
+        RecordStep(nullptr, "Value {} not found", value);
+        return root;
+    }
+    
+    // Deletion walks down keeping the current node red, so a leaf can be removed outright
+    if (!IsRed(root->left.get()) && !IsRed(root->right.get())) {
+        root->color = TreeNode::RED;
+    }
+    root = RBDeleteAt(root, value);
+    if (root) {
+        root->color = TreeNode::BLACK;
+    }
+    return root;
+}
+
+std::shared_ptr<TreeNode> TreeVisualizer::RBInsertAt(std::shared_ptr<TreeNode> node, int value) {
+    if (!node) {
+        RecordStep(nullptr, "Creating new red node with value {}", value);
+        auto newNode = std::make_shared<TreeNode>(value);
+        newNode->isNew = true;
+        return newNode;
+    }
+    
+    RecordStep(node, "Comparing {} with {}", value, node->value);
+    m_comparisons++;
+    
+    if (value < node->value) {
+        node->left = RBInsertAt(node->left, value);
+    } else if (value > node->value) {
+        node->right = RBInsertAt(node->right, value);
+    } else {
+        RecordStep(node, "{} is already in the tree", value);
+    }
+    return RBBalance(node);
+}
+
+std::shared_ptr<TreeNode> TreeVisualizer::RBDeleteMin(std::shared_ptr<TreeNode> node) {
+    if (!node->left) {
+        return nullptr;
+    }
+    if (!IsRed(node->left.get()) && !IsRed(node->left->left.get())) {
+        node = MoveRedLeft(node);
+    }
+    node->left = RBDeleteMin(node->left);
+    return RBBalance(node);
+}
+
+// Assumes the key is present (checked by RBDelete)
+std::shared_ptr<TreeNode> TreeVisualizer::RBDeleteAt(std::shared_ptr<TreeNode> node, int value) {
+    RecordStep(node, "Comparing {} with {}", value, node->value);
+    m_comparisons++;
+    
+    if (value < node->value) {
+        if (!IsRed(node->left.get()) && !IsRed(node->left->left.get())) {
+            node = MoveRedLeft(node);
+        }
+        node->left = RBDeleteAt(node->left, value);
+    } else {
+        if (IsRed(node->left.get())) {
+            node = RBRotateRight(node);
+        }
+        if (value == node->value && !node->right) {
+            RecordStep(node, "Removing red leaf {}", value);
+            return nullptr;
+        }
+        if (!IsRed(node->right.get()) && !IsRed(node->right->left.get())) {
+            node = MoveRedRight(node);
+        }
+        if (value == node->value) {
+            const TreeNode* successor = node->right.get();
+            while (successor->left) {
+                successor = successor->left.get();
+            }
+            RecordStep(node, "Replacing {} with its in-order successor {}", value, successor->value);
+            node->value = successor->value;
+            node->right = RBDeleteMin(node->right);
+        } else {
+            node->right = RBDeleteAt(node->right, value);
+        }
+    }
+    return RBBalance(node);
+}
+
+// Restores the left-leaning invariants on the way back up
+std::shared_ptr<TreeNode> TreeVisualizer::RBBalance(std::shared_ptr<TreeNode> node) {
+    if (IsRed(node->right.get()) && !IsRed(node->left.get())) {
+        RecordStep(node, "Red link leans right at {}", node->value);
+        node = RBRotateLeft(node);
+    }
+    if (IsRed(node->left.get()) && IsRed(node->left->left.get())) {
+        RecordStep(node, "Two red links in a row below {}", node->value);
+        node = RBRotateRight(node);
+    }
+    if (IsRed(node->left.get()) && IsRed(node->right.get())) {
+        FlipColors(node);
+    }
+    UpdateSubtree(node);
+    return node;
+}
+
+std::shared_ptr<TreeNode> TreeVisualizer::MoveRedLeft(std::shared_ptr<TreeNode> node) {
+    FlipColors(node);
+    if (IsRed(node->right->left.get())) {
+        node->right = RBRotateRight(node->right);
+        node = RBRotateLeft(node);
+        FlipColors(node);
+    }
+    return node;
+}
+
+std::shared_ptr<TreeNode> TreeVisualizer::MoveRedRight(std::shared_ptr<TreeNode> node) {
+    FlipColors(node);
+    if (IsRed(node->left->left.get())) {
+        node = RBRotateRight(node);
+        FlipColors(node);
+    }
+    return node;
+}
+
+std::shared_ptr<TreeNode> TreeVisualizer::RBRotateLeft(std::shared_ptr<TreeNode> node) {
+    const TreeNode::Color color = node->color;
+    std::shared_ptr<TreeNode> pivot = RotateLeft(node);
+    pivot->color = color;
+    node->color = TreeNode::RED;
+    return pivot;
+}
+
+std::shared_ptr<TreeNode> TreeVisualizer::RBRotateRight(std::shared_ptr<TreeNode> node) {
+    const TreeNode::Color color = node->color;
+    std::shared_ptr<TreeNode> pivot = RotateRight(node);
+    pivot->color = color;
+    node->color = TreeNode::RED;
+    return pivot;
+}
+
+void TreeVisualizer::FlipColors(const std::shared_ptr<TreeNode>& node) {
+    const auto flip = [](TreeNode& target) {
+        target.color = target.color == TreeNode::RED ? TreeNode::BLACK : TreeNode::RED;
+    };
+    flip(*node);
+    flip(*node->left);
+    flip(*node->right);
+    RecordStep(node, "Color flip at {}: now {}", node->value, node->color == TreeNode::RED ? "red" : "black");
 }
 
 std::shared_ptr<TreeNode> TreeVisualizer::RotateLeft(std::shared_ptr<TreeNode> x) {
-    RecordStep("Performing left rotation", x);
+    RecordStep(x, "Performing left rotation at {}", x->value);
+    if (m_recordSteps) {
+        m_steps.back().isRotation = true;
+    }
     m_rotations++;
-    // Implementation would go here
-    return x;
+    
+    std::shared_ptr<TreeNode> y = x->right;
+    x->right = y->left;
+    y->left = x;
+    UpdateHeight(x);
+    UpdateHeight(y);
+    RecordStep(y, "Sizes after rotation: {} has {}, {} has {}", y->value, y->size, x->value, x->size);
+    return y;
 }
 
 std::shared_ptr<TreeNode> TreeVisualizer::RotateRight(std::shared_ptr<TreeNode> y) {
-    RecordStep("Performing right rotation", y);
+    RecordStep(y, "Performing right rotation at {}", y->value);
+    if (m_recordSteps) {
+        m_steps.back().isRotation = true;
+    }
     m_rotations++;
-    // Implementation would go here
-    return y;
+    
+    std::shared_ptr<TreeNode> x = y->left;
+    y->left = x->right;
+    x->right = y;
+    UpdateHeight(y);
+    UpdateHeight(x);
+    RecordStep(x, "Sizes after rotation: {} has {}, {} has {}", x->value, x->size, y->value, y->size);
+    return x;
+}
+
+// Top-down splay (Sleator-Tarjan), the same single pass as the benchmark SplayTree:
+// walking down the search path, nodes above value are linked into a right tree and
+// nodes below it into a left tree, and both are reassembled under the last node
+// reached. No recursion, so the O(n)-deep paths sequential access builds are safe.
+std::shared_ptr<TreeNode> TreeVisualizer::Splay(std::shared_ptr<TreeNode> root, int value) {
+    if (!root) {
+        return root;
+    }
+    
+    TreeNode header(0);
+    TreeNode* leftMax = &header;  // Largest node of the left tree
+    TreeNode* rightMin = &header; // Smallest node of the right tree
+    // Linked nodes lose a subtree on the way down; their sizes are refreshed once it is reattached
+    std::vector<std::shared_ptr<TreeNode>> leftSpine;
+    std::vector<std::shared_ptr<TreeNode>> rightSpine;
+    std::shared_ptr<TreeNode> node = std::move(root);
+    
+    for (;;) {
+        m_comparisons++;
+        if (value < node->value) {
+            if (!node->left) {
+                break;
+            }
+            m_comparisons++;
+            if (value < node->left->value) {
+                RecordStep(node, "Zig-zig: {} lies left-left of {}", value, node->value);
+                node = RotateRight(node);
+                if (!node->left) {
+                    break;
+                }
+            }
+            RecordStep(node, "{} and its right subtree join the right tree", node->value);
+            rightMin->left = node;
+            rightMin = node.get();
+            rightSpine.push_back(node);
+            node = node->left;
+        } else if (value > node->value) {
+            if (!node->right) {
+                break;
+            }
+            m_comparisons++;
+            if (value > node->right->value) {
+                RecordStep(node, "Zig-zig: {} lies right-right of {}", value, node->value);
+                node = RotateLeft(node);
+                if (!node->right) {
+                    break;
+                }
+            }
+            RecordStep(node, "{} and its left subtree join the left tree", node->value);
+            leftMax->right = node;
+            leftMax = node.get();
+            leftSpine.push_back(node);
+            node = node->right;
+        } else {
+            break;
+        }
+    }
+    
+    leftMax->right = node->left;
+    rightMin->left = node->right;
+    node->left = header.right;
+    node->right = header.left;
+    for (auto it = leftSpine.rbegin(); it != leftSpine.rend(); ++it) {
+        UpdateHeight(*it);
+    }
+    for (auto it = rightSpine.rbegin(); it != rightSpine.rend(); ++it) {
+        UpdateHeight(*it);
+    }
+    UpdateHeight(node);
+    if (!leftSpine.empty() || !rightSpine.empty()) {
+        RecordStep(node, "Reassembled left and right trees under {}", node->value);
+    }
+    return node;
+}
+
+std::shared_ptr<TreeNode> TreeVisualizer::SplayInsert(std::shared_ptr<TreeNode> root, int value) {
+    if (!root) {
+        RecordStep(nullptr, "Creating new node with value {}", value);
+        auto newNode = std::make_shared<TreeNode>(value);
+        newNode->isNew = true;
+        return newNode;
+    }
+    
+    root = Splay(root, value);
+    if (root->value == value) {
+        RecordStep(root, "{} is already in the tree (now at the root)", value);
+        return root;
+    }
+    
+    // The splayed root is value's neighbour: split around it under the new root
+    auto newNode = std::make_shared<TreeNode>(value);
+    newNode->isNew = true;
+    if (value < root->value) {
+        newNode->left = root->left;
+        newNode->right = root;
+        root->left = nullptr;
+    } else {
+        newNode->right = root->right;
+        newNode->left = root;
+        root->right = nullptr;
+    }
+    UpdateHeight(root);
+    UpdateHeight(newNode);
+    RecordStep(newNode, "New root {} takes {} as a child", value, root->value);
+    return newNode;
+}
+
+std::shared_ptr<TreeNode> TreeVisualizer::SplayDelete(std::shared_ptr<TreeNode> root, int value) {
+    root = Splay(root, value);
+    if (!root || root->value != value) {
+        RecordStep(nullptr, "Value {} not found", value);
+        return root;
+    }
+    
+    RecordStep(root, "Splayed {} to the root, removing it", value);
+    if (!root->left) {
+        return root->right;
+    }
+    
+    // Everything on the left is smaller, so splaying value there brings up its maximum with no right child
+    std::shared_ptr<TreeNode> left = Splay(root->left, value);
+    left->right = root->right;
+    UpdateHeight(left);
+    RecordStep(left, "Joined subtrees under {}", left->value);
+    return left;
+}
+
+std::shared_ptr<TreeNode> TreeVisualizer::TreapInsert(std::shared_ptr<TreeNode> root, int value) {
+    if (!root) {
+        auto newNode = std::make_shared<TreeNode>(value);
+        newNode->isNew = true;
+        newNode->priority = std::uniform_int_distribution<int>(1, 99)(m_treapRng);
+        RecordStep(newNode, "Creating node {} with priority {}", value, newNode->priority);
+        return newNode;
+    }
+    
+    RecordStep(root, "Comparing {} with {}", value, root->value);
+    m_comparisons++;
+    
+    if (value < root->value) {
+        root->left = TreapInsert(root->left, value);
+        if (root->left->priority > root->priority) {
+            RecordStep(nullptr, "Priority {} > {}: rotate {} up", root->left->priority, root->priority, root->left->value);
+            root = RotateRight(root);
+        }
+    } else if (value > root->value) {
+        root->right = TreapInsert(root->right, value);
+        if (root->right->priority > root->priority) {
+            RecordStep(nullptr, "Priority {} > {}: rotate {} up", root->right->priority, root->priority, root->right->value);
+            root = RotateLeft(root);
+        }
+    }
+    UpdateSubtree(root);
+    return root;
+}
+
+std::shared_ptr<TreeNode> TreeVisualizer::TreapDelete(std::shared_ptr<TreeNode> root, int value) {
+    if (!root) {
+        RecordStep(nullptr, "Value {} not found", value);
+        return root;
+    }
+    
+    RecordStep(root, "Comparing {} with {}", value, root->value);
+    m_comparisons++;
+    
+    if (value < root->value) {
+        root->left = TreapDelete(root->left, value);
+    } else if (value > root->value) {
+        root->right = TreapDelete(root->right, value);
+    } else if (!root->left || !root->right) {
+        RecordStep(root, "Removing {}", value);
+        root->isDeleted = true;
+        return root->left ? root->left : root->right;
+    } else if (root->left->priority > root->right->priority) {
+        // Rotate the higher-priority child up and keep sinking the doomed node
+        root = RotateRight(root);
+        root->right = TreapDelete(root->right, value);
+    } else {
+        root = RotateLeft(root);
+        root->left = TreapDelete(root->left, value);
+    }
+    UpdateSubtree(root);
+    return root;
 }
 
 int TreeVisualizer::GetHeight(std::shared_ptr<TreeNode> node) {
@@ -770,23 +3482,246 @@ int TreeVisualizer::GetBalance(std::shared_ptr<TreeNode> node) {
 void TreeVisualizer::UpdateHeight(std::shared_ptr<TreeNode> node) {
     if (node) {
         node->height = 1 + std::max(GetHeight(node->left), GetHeight(node->right));
+        node->size = 1 + SubtreeSize(node->left.get()) + SubtreeSize(node->right.get());
+    }
+}
+
+void TreeVisualizer::UpdateSubtree(const std::shared_ptr<TreeNode>& node) {
+    const int oldSize = node->size;
+    UpdateHeight(node);
+    if (node->size != oldSize) {
+        RecordStep(node, "Subtree size of {}: {} -> {}", node->value, oldSize, node->size);
+    }
+}
+
+// Order statistics: the left subtree of a node holds exactly the keys ranked below it
+std::shared_ptr<TreeNode> TreeVisualizer::SelectNode(int rank) {
+    std::shared_ptr<TreeNode> node = m_root;
+    while (node) {
+        m_comparisons++;
+        const int leftSize = SubtreeSize(node->left.get());
+        if (rank < leftSize) {
+            RecordStep(node, "Left of {} holds {} keys > rank {}: going left", node->value, leftSize, rank);
+            node = node->left;
+        } else if (rank == leftSize) {
+            RecordStep(node, "Left of {} holds exactly {} keys: found", node->value, leftSize);
+            return node;
+        } else {
+            RecordStep(node, "Skipping {} left keys and {}: rank {} -> {} on the right", leftSize, node->value, rank,
+                       rank - leftSize - 1);
+            rank -= leftSize + 1;
+            node = node->right;
+        }
+    }
+    return nullptr;
+}
+
+int TreeVisualizer::CountBelow(int value, bool inclusive) {
+    int count = 0;
+    std::shared_ptr<TreeNode> node = m_root;
+    while (node) {
+        m_comparisons++;
+        if (node->value < value || (inclusive && node->value == value)) {
+            count += SubtreeSize(node->left.get()) + 1;
+            RecordStep(node, "{} and its {} left keys count: {} so far", node->value, SubtreeSize(node->left.get()), count);
+            node = node->right;
+        } else {
+            RecordStep(node, "{} is too large, going left", node->value);
+            node = node->left;
+        }
+    }
+    return count;
+}
+
+void TreeVisualizer::SelectValue(int rank) {
+    ResetVisualization();
+    m_comparisons = 0;
+    m_startTime = std::chrono::high_resolution_clock::now();
+    std::shared_ptr<TreeNode> node = rank >= 1 ? SelectNode(rank - 1) : nullptr;
+    m_endTime = std::chrono::high_resolution_clock::now();
+    m_operationTime = std::chrono::duration<double, std::milli>(m_endTime - m_startTime).count();
+    
+    if (node) {
+        node->isHighlighted = true;
+        m_layoutDirty = true;
+        RecordStep(node, "Key of rank {}: {}", rank, node->value);
+    } else {
+        RecordStep(nullptr, "Rank {} is outside 1..{}", rank, SubtreeSize(m_root.get()));
+    }
+}
+
+void TreeVisualizer::RankValue(int value) {
+    ResetVisualization();
+    m_comparisons = 0;
+    m_startTime = std::chrono::high_resolution_clock::now();
+    const int below = CountBelow(value, false);
+    m_endTime = std::chrono::high_resolution_clock::now();
+    m_operationTime = std::chrono::duration<double, std::milli>(m_endTime - m_startTime).count();
+    RecordStep(nullptr, "{} keys are below {}, so it ranks {} of {}", below, value, below + 1, SubtreeSize(m_root.get()));
+}
+
+void TreeVisualizer::CountRangeValues(int low, int high) {
+    if (low > high) {
+        std::swap(low, high);
+    }
+    
+    ResetVisualization();
+    m_comparisons = 0;
+    m_startTime = std::chrono::high_resolution_clock::now();
+    RecordStep(nullptr, "Counting keys <= {}", high);
+    const int upTo = CountBelow(high, true);
+    RecordStep(nullptr, "Counting keys < {}", low);
+    const int below = CountBelow(low, false);
+    m_endTime = std::chrono::high_resolution_clock::now();
+    m_operationTime = std::chrono::duration<double, std::milli>(m_endTime - m_startTime).count();
+    RecordStep(nullptr, "{} keys in [{}, {}] ({} - {})", upTo - below, low, high, upTo, below);
+}
+
+// Nearest-rank percentile: the smallest key with at least p% of the keys at or below it
+void TreeVisualizer::PercentileValue(int percentile) {
+    const int size = SubtreeSize(m_root.get());
+    if (size == 0) {
+        ResetVisualization();
+        RecordStep("Tree is empty");
+        return;
     }
+    const int rank = std::max(1, static_cast<int>(std::ceil(percentile / 100.0 * size)));
+    SelectValue(rank);
+    RecordStep(nullptr, "p{} of {} keys is rank {}", percentile, size, rank);
 }
 
-void TreeVisualizer::PreorderTraversal(std::shared_ptr<TreeNode> node, std::vector<int>& result) {
-    if (!node) return;
+// In-order walk with an explicit stack, so trees built by a background job do not overflow the call stack
+void TreeVisualizer::FreezeTree() {
+    if (!IsBinaryTreeAlgorithm() || IsBackgroundJobRunning()) {
+        return;
+    }
     
-    result.push_back(node->value);
-    PreorderTraversal(node->left, result);
-    PreorderTraversal(node->right, result);
+    ResetVisualization();
+    m_startTime = std::chrono::high_resolution_clock::now();
+    
+    std::vector<int> keys;
+    keys.reserve(m_nodeCount);
+    std::vector<const TreeNode*> stack;
+    const TreeNode* node = m_root.get();
+    while (node || !stack.empty()) {
+        while (node) {
+            stack.push_back(node);
+            node = node->left.get();
+        }
+        node = stack.back();
+        stack.pop_back();
+        keys.push_back(node->value);
+        node = node->right.get();
+    }
+    
+    const auto layout = static_cast<StaticSearchTree::Layout>(m_frozenLayout);
+    m_frozenTree = std::make_unique<StaticSearchTree>(keys, layout);
+    m_frozenPath.clear();
+    
+    m_endTime = std::chrono::high_resolution_clock::now();
+    m_operationTime = std::chrono::duration<double, std::milli>(m_endTime - m_startTime).count();
+    RecordStep(nullptr, "Froze {} keys into a {} array: {} slots over {} levels ({} bytes)", keys.size(),
+               StaticSearchTree::LayoutName(layout), m_frozenTree->SlotCount(), m_frozenTree->Height(),
+               m_frozenTree->MemoryBytes());
+}
+
+void TreeVisualizer::ThawTree(const char* reason) {
+    if (!m_frozenTree) {
+        return;
+    }
+    m_frozenTree.reset();
+    m_frozenPath.clear();
+    RecordStep(nullptr, "{}: frozen layout discarded", reason);
 }
 
-void TreeVisualizer::PostorderTraversal(std::shared_ptr<TreeNode> node, std::vector<int>& result) {
-    if (!node) return;
+// Two rows at the bottom of the canvas: the whole array scaled to the canvas width with
+// a tick per slot the last search visited, and the leading slots coloured by depth
+void TreeVisualizer::RenderFrozenLayout(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize) {
+    PROFILE_SCOPE("TreeVisualizer::RenderFrozenLayout");
+    const int slotCount = static_cast<int>(m_frozenTree->SlotCount());
+    const float width = canvasSize.x - 2.0f * VIEW_MARGIN;
+    if (slotCount == 0 || width <= 0.0f) {
+        return;
+    }
+    
+    const float left = canvasPos.x + VIEW_MARGIN;
+    const float cellsTop = canvasPos.y + canvasSize.y - VIEW_MARGIN - FROZEN_ROW_HEIGHT;
+    const float overviewTop = cellsTop - FROZEN_ROW_HEIGHT - 4.0f;
+    const int height = std::max(m_frozenTree->Height(), 1);
+    auto depthColor = [height](int depth) {
+        // Root blue fading to green at the leaves
+        const float t = static_cast<float>(depth) / height;
+        return IM_COL32(static_cast<int>(70 + 30 * t), static_cast<int>(80 + 120 * t), static_cast<int>(210 - 130 * t), 255);
+    };
+    
+    std::vector<int> lines;
+    for (int slot : m_frozenPath) {
+        lines.push_back(slot * static_cast<int>(sizeof(int)) / CACHE_LINE_BYTES);
+    }
+    std::sort(lines.begin(), lines.end());
+    lines.erase(std::unique(lines.begin(), lines.end()), lines.end());
+    std::string caption = fmt::format("{}: {} slots, {} bytes", StaticSearchTree::LayoutName(m_frozenTree->GetLayout()),
+                                      slotCount, m_frozenTree->MemoryBytes());
+    if (!m_frozenPath.empty()) {
+        caption += fmt::format(" | last search: {} slots in {} cache lines", m_frozenPath.size(), lines.size());
+    }
+    drawList->AddText(ImVec2(left, overviewTop - ImGui::GetTextLineHeight() - 2.0f), IM_COL32(220, 220, 220, 255),
+                      caption.c_str());
+    
+    drawList->AddRectFilled(ImVec2(left, overviewTop), ImVec2(left + width, overviewTop + FROZEN_ROW_HEIGHT),
+                            IM_COL32(50, 50, 60, 255));
+    for (int slot : m_frozenPath) {
+        const float x = left + width * (slot + 0.5f) / slotCount;
+        drawList->AddLine(ImVec2(x, overviewTop), ImVec2(x, overviewTop + FROZEN_ROW_HEIGHT),
+                          IM_COL32(255, 255, 0, 255), 2.0f);
+    }
     
-    PostorderTraversal(node->left, result);
-    PostorderTraversal(node->right, result);
-    result.push_back(node->value);
+    const int shown = std::min(slotCount, static_cast<int>(width / FROZEN_MIN_CELL));
+    const float cell = width / shown;
+    for (int slot = 0; slot < shown; ++slot) {
+        const ImVec2 min(left + slot * cell, cellsTop);
+        const ImVec2 max(min.x + cell - 1.0f, cellsTop + FROZEN_ROW_HEIGHT);
+        const bool padding = m_frozenTree->IsPadding(slot);
+        drawList->AddRectFilled(min, max, padding ? IM_COL32(60, 60, 60, 255) : depthColor(m_frozenTree->DepthOfSlot(slot)));
+        if (std::find(m_frozenPath.begin(), m_frozenPath.end(), slot) != m_frozenPath.end()) {
+            drawList->AddRect(min, max, IM_COL32(255, 255, 0, 255), 0.0f, 0, 2.0f);
+        }
+        if (cell >= FROZEN_LABEL_CELL && !padding) {
+            drawList->AddText(ImVec2(min.x + 2.0f, min.y + 2.0f), IM_COL32(255, 255, 255, 255),
+                              std::to_string(m_frozenTree->KeyAt(slot)).c_str());
+        }
+    }
+}
+
+void TreeVisualizer::PreorderTraversal(const TreeNode* node, std::vector<int>& result) {
+    std::vector<const TreeNode*> stack;
+    if (node) {
+        stack.push_back(node);
+    }
+    while (!stack.empty()) {
+        node = stack.back();
+        stack.pop_back();
+        result.push_back(node->value);
+        if (node->right) stack.push_back(node->right.get());
+        if (node->left) stack.push_back(node->left.get());
+    }
+}
+
+// Reverse of a root-right-left pre-order
+void TreeVisualizer::PostorderTraversal(const TreeNode* node, std::vector<int>& result) {
+    const size_t first = result.size();
+    std::vector<const TreeNode*> stack;
+    if (node) {
+        stack.push_back(node);
+    }
+    while (!stack.empty()) {
+        node = stack.back();
+        stack.pop_back();
+        result.push_back(node->value);
+        if (node->left) stack.push_back(node->left.get());
+        if (node->right) stack.push_back(node->right.get());
+    }
+    std::reverse(result.begin() + static_cast<std::ptrdiff_t>(first), result.end());
 }
 
 void TreeVisualizer::LevelOrderTraversal() {
@@ -800,7 +3735,7 @@ void TreeVisualizer::LevelOrderTraversal() {
         queue.pop();
         
         m_traversalResult.push_back(node->value);
-        RecordStep(fmt::format("Visiting node {}", node->value), node);
+        RecordStep(node, "Visiting node {}", node->value);
         
         if (node->left) queue.push(node->left);
                  if (node->right) queue.push(node->right);
@@ -814,6 +3749,17 @@ std::string TreeVisualizer::GetAlgorithmName(TreeAlgorithm algorithm) const {
         case TreeAlgorithm::MinHeap: return "Min Heap";
         case TreeAlgorithm::MaxHeap: return "Max Heap";
         case TreeAlgorithm::RedBlackTree: return "Red-Black Tree";
+        case TreeAlgorithm::BTree: return "B-Tree";
+        case TreeAlgorithm::BPlusTree: return "B+ Tree";
+        case TreeAlgorithm::PairingHeap: return "Pairing Heap";
+        case TreeAlgorithm::RadixHeap: return "Radix Heap";
+        case TreeAlgorithm::SkipList: return "Skip List";
+        case TreeAlgorithm::SplayTree: return "Splay Tree";
+        case TreeAlgorithm::Treap: return "Treap";
+        case TreeAlgorithm::AdaptiveRadixTree: return "Adaptive Radix Tree";
+        case TreeAlgorithm::SegmentTree: return "Segment Tree";
+        case TreeAlgorithm::FenwickTree: return "Fenwick Tree";
+        case TreeAlgorithm::PatriciaTrie: return "Patricia Trie";
         default: return "Unknown Tree";
     }
 }
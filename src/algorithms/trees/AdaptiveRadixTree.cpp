@@ -0,0 +1,780 @@
+#include "algorithms/trees/AdaptiveRadixTree.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ALGO1_ART_SSE2 1
+#endif
+
+namespace AlgorithmVisualizer {
+
+namespace {
+
+using ART = AdaptiveRadixTree;
+
+// Shrink below the grow thresholds so a node at the boundary does not flip back and forth
+constexpr int NODE256_SHRINK = 37;
+constexpr int NODE48_SHRINK = 12;
+constexpr int NODE16_SHRINK = 3;
+
+// Slot holding byte among the first count keys, or -1
+int Node16Find(const uint8_t* keys, int count, uint8_t byte) {
+#if defined(ALGO1_ART_SSE2)
+    const __m128i matches = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)),
+                                           _mm_load_si128(reinterpret_cast<const __m128i*>(keys)));
+    const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(matches)) & ((1u << count) - 1);
+    return mask ? std::countr_zero(mask) : -1;
+#else
+    for (int i = 0; i < count; ++i) {
+        if (keys[i] == byte) {
+            return i;
+        }
+    }
+    return -1;
+#endif
+}
+
+// Number of keys below byte, i.e. its sorted insert position
+int Node16LowerBound(const uint8_t* keys, int count, uint8_t byte) {
+#if defined(ALGO1_ART_SSE2)
+    // SSE2 only compares signed bytes; flipping the top bit maps unsigned order onto signed order
+    const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80));
+    const __m128i needle = _mm_xor_si128(_mm_set1_epi8(static_cast<char>(byte)), bias);
+    const __m128i block = _mm_xor_si128(_mm_load_si128(reinterpret_cast<const __m128i*>(keys)), bias);
+    const unsigned greater = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmplt_epi8(needle, block))) &
+                             ((1u << count) - 1);
+    return greater ? std::countr_zero(greater) : count;
+#else
+    int i = 0;
+    while (i < count && keys[i] < byte) {
+        i++;
+    }
+    return i;
+#endif
+}
+
+// Calls fn(byte, child) for every child of node in key-byte order
+template <typename Fn>
+void VisitChildren(const ART::InnerNode* node, Fn&& fn) {
+    switch (node->type) {
+    case ART::NodeType::Node4: {
+        const auto* n = static_cast<const ART::Node4*>(node);
+        for (int i = 0; i < n->childCount; ++i) {
+            fn(n->keys[i], n->children[i]);
+        }
+        break;
+    }
+    case ART::NodeType::Node16: {
+        const auto* n = static_cast<const ART::Node16*>(node);
+        for (int i = 0; i < n->childCount; ++i) {
+            fn(n->keys[i], n->children[i]);
+        }
+        break;
+    }
+    case ART::NodeType::Node48: {
+        const auto* n = static_cast<const ART::Node48*>(node);
+        for (int byte = 0; byte < 256; ++byte) {
+            if (n->childIndex[byte]) {
+                fn(static_cast<uint8_t>(byte), n->children[n->childIndex[byte] - 1]);
+            }
+        }
+        break;
+    }
+    case ART::NodeType::Node256: {
+        const auto* n = static_cast<const ART::Node256*>(node);
+        for (int byte = 0; byte < 256; ++byte) {
+            if (n->children[byte]) {
+                fn(static_cast<uint8_t>(byte), n->children[byte]);
+            }
+        }
+        break;
+    }
+    case ART::NodeType::Leaf:
+        break;
+    }
+}
+
+int HeightOf(const ART::Node* node) {
+    if (!node) {
+        return 0;
+    }
+    int height = 0;
+    if (node->type != ART::NodeType::Leaf) {
+        VisitChildren(static_cast<const ART::InnerNode*>(node), [&](uint8_t, const ART::Node* child) {
+            height = std::max(height, HeightOf(child));
+        });
+    }
+    return height + 1;
+}
+
+} // namespace
+
+AdaptiveRadixTree::~AdaptiveRadixTree() {
+    Clear();
+}
+
+// Key encoding
+AdaptiveRadixTree::IntKey AdaptiveRadixTree::EncodeInt(int key) {
+    const uint32_t bits = static_cast<uint32_t>(key) ^ 0x80000000u;
+    return { static_cast<char>(bits >> 24), static_cast<char>(bits >> 16),
+             static_cast<char>(bits >> 8), static_cast<char>(bits) };
+}
+
+int AdaptiveRadixTree::DecodeInt(std::string_view key) {
+    uint32_t bits = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        bits = (bits << 8) | KeyByte(key, i);
+    }
+    return static_cast<int>(bits ^ 0x80000000u);
+}
+
+std::string AdaptiveRadixTree::TerminatedString(std::string_view key) {
+    std::string terminated(key);
+    terminated.push_back('\0');
+    return terminated;
+}
+
+bool AdaptiveRadixTree::Insert(int key) {
+    const IntKey encoded = EncodeInt(key);
+    return InsertKey(std::string_view(encoded.data(), encoded.size()));
+}
+
+bool AdaptiveRadixTree::Erase(int key) {
+    const IntKey encoded = EncodeInt(key);
+    return EraseKey(std::string_view(encoded.data(), encoded.size()));
+}
+
+bool AdaptiveRadixTree::Contains(int key) const {
+    const IntKey encoded = EncodeInt(key);
+    return ContainsKey(std::string_view(encoded.data(), encoded.size()));
+}
+
+bool AdaptiveRadixTree::InsertString(std::string_view key) {
+    return key.find('\0') == std::string_view::npos && InsertKey(TerminatedString(key));
+}
+
+bool AdaptiveRadixTree::EraseString(std::string_view key) {
+    return key.find('\0') == std::string_view::npos && EraseKey(TerminatedString(key));
+}
+
+bool AdaptiveRadixTree::ContainsString(std::string_view key) const {
+    return key.find('\0') == std::string_view::npos && ContainsKey(TerminatedString(key));
+}
+
+// Node management
+template <typename T, typename... Args>
+T* AdaptiveRadixTree::NewNode(Args&&... args) {
+    T* node = new T(std::forward<Args>(args)...);
+    m_nodeCounts[static_cast<size_t>(node->type)]++;
+    return node;
+}
+
+void AdaptiveRadixTree::DeleteNode(Node* node) {
+    m_nodeCounts[static_cast<size_t>(node->type)]--;
+    if (m_lastChanged == node) {
+        m_lastChanged = nullptr;
+    }
+    switch (node->type) {
+    case NodeType::Leaf: delete static_cast<Leaf*>(node); break;
+    case NodeType::Node4: delete static_cast<Node4*>(node); break;
+    case NodeType::Node16: delete static_cast<Node16*>(node); break;
+    case NodeType::Node48: delete static_cast<Node48*>(node); break;
+    case NodeType::Node256: delete static_cast<Node256*>(node); break;
+    }
+}
+
+// Recursion depth is bounded by the key length, not the key count
+void AdaptiveRadixTree::FreeSubtree(Node* node) {
+    if (!node) {
+        return;
+    }
+    if (node->type != NodeType::Leaf) {
+        VisitChildren(static_cast<const InnerNode*>(node), [&](uint8_t, const Node* child) {
+            FreeSubtree(const_cast<Node*>(child));
+        });
+    }
+    DeleteNode(node);
+}
+
+void AdaptiveRadixTree::Clear() {
+    FreeSubtree(m_root);
+    m_root = nullptr;
+    m_size = 0;
+    m_lastChanged = nullptr;
+}
+
+void AdaptiveRadixTree::CopyHeader(InnerNode* to, const InnerNode* from) {
+    to->childCount = from->childCount;
+    to->prefixLength = from->prefixLength;
+    to->prefix = from->prefix;
+}
+
+int AdaptiveRadixTree::Height() const {
+    return HeightOf(m_root);
+}
+
+size_t AdaptiveRadixTree::MemoryBytes() const {
+    return NodeCount(NodeType::Leaf) * sizeof(Leaf) + NodeCount(NodeType::Node4) * sizeof(Node4) +
+           NodeCount(NodeType::Node16) * sizeof(Node16) + NodeCount(NodeType::Node48) * sizeof(Node48) +
+           NodeCount(NodeType::Node256) * sizeof(Node256);
+}
+
+// Lookup
+AdaptiveRadixTree::Node** AdaptiveRadixTree::FindChild(InnerNode* node, uint8_t byte) {
+    switch (node->type) {
+    case NodeType::Node4: {
+        auto* n = static_cast<Node4*>(node);
+        for (int i = 0; i < n->childCount; ++i) {
+            if (n->keys[i] == byte) {
+                return &n->children[i];
+            }
+        }
+        return nullptr;
+    }
+    case NodeType::Node16: {
+        auto* n = static_cast<Node16*>(node);
+        int slot = Node16Find(n->keys.data(), n->childCount, byte);
+        return slot >= 0 ? &n->children[slot] : nullptr;
+    }
+    case NodeType::Node48: {
+        auto* n = static_cast<Node48*>(node);
+        return n->childIndex[byte] ? &n->children[n->childIndex[byte] - 1] : nullptr;
+    }
+    case NodeType::Node256: {
+        auto* n = static_cast<Node256*>(node);
+        return n->children[byte] ? &n->children[byte] : nullptr;
+    }
+    case NodeType::Leaf:
+        break;
+    }
+    return nullptr;
+}
+
+const AdaptiveRadixTree::Node* AdaptiveRadixTree::FindChild(const InnerNode* node, uint8_t byte) {
+    Node* const* slot = FindChild(const_cast<InnerNode*>(node), byte);
+    return slot ? *slot : nullptr;
+}
+
+const AdaptiveRadixTree::Leaf* AdaptiveRadixTree::Minimum(const Node* node) {
+    while (node && node->type != NodeType::Leaf) {
+        const Node* first = nullptr;
+        VisitChildren(static_cast<const InnerNode*>(node), [&](uint8_t, const Node* child) {
+            if (!first) {
+                first = child;
+            }
+        });
+        node = first;
+    }
+    return static_cast<const Leaf*>(node);
+}
+
+// Length of the common run between the node's compressed path and key[depth..].
+// Bytes beyond MAX_PREFIX are read from a leaf, so the result is exact.
+size_t AdaptiveRadixTree::PrefixMismatch(const InnerNode* node, std::string_view key, size_t depth) {
+    const size_t stored = std::min<size_t>(node->prefixLength, MAX_PREFIX);
+    size_t i = 0;
+    for (; i < stored; ++i) {
+        if (node->prefix[i] != KeyByte(key, depth + i)) {
+            return i;
+        }
+    }
+    if (node->prefixLength > MAX_PREFIX) {
+        const Leaf* leaf = Minimum(node);
+        for (; i < node->prefixLength; ++i) {
+            if (KeyByte(leaf->key, depth + i) != KeyByte(key, depth + i)) {
+                return i;
+            }
+        }
+    }
+    return i;
+}
+
+// Optimistic search: only the stored prefix bytes are compared on the way down,
+// the full key comparison at the leaf covers anything that was skipped
+bool AdaptiveRadixTree::ContainsKey(std::string_view key) const {
+    const Node* node = m_root;
+    size_t depth = 0;
+    while (node) {
+        m_stats.nodesVisited++;
+        if (node->type == NodeType::Leaf) {
+            return static_cast<const Leaf*>(node)->key == key;
+        }
+        const auto* inner = static_cast<const InnerNode*>(node);
+        const size_t stored = std::min<size_t>(inner->prefixLength, MAX_PREFIX);
+        for (size_t i = 0; i < stored; ++i) {
+            if (inner->prefix[i] != KeyByte(key, depth + i)) {
+                return false;
+            }
+        }
+        depth += inner->prefixLength;
+        node = FindChild(inner, KeyByte(key, depth));
+        depth++;
+    }
+    return false;
+}
+
+// Insertion
+bool AdaptiveRadixTree::InsertKey(std::string_view key) {
+    m_lastChanged = nullptr;
+    if (!InsertAt(m_root, key, 0)) {
+        return false;
+    }
+    m_size++;
+    return true;
+}
+
+bool AdaptiveRadixTree::InsertAt(Node*& ref, std::string_view key, size_t depth) {
+    if (!ref) {
+        ref = NewNode<Leaf>(key);
+        return true;
+    }
+
+    if (ref->type == NodeType::Leaf) {
+        Leaf* existing = static_cast<Leaf*>(ref);
+        if (existing->key == key) {
+            EmitStep("Key already present");
+            return false;
+        }
+        // Lazy expansion: the leaf sat here because its path was unique. Both leaves go
+        // under a new Node4 whose prefix covers the bytes the two keys still share.
+        size_t limit = std::min(existing->key.size(), key.size());
+        limit = limit > depth ? limit - depth : 0;
+        size_t common = 0;
+        while (common < limit && existing->key[depth + common] == key[depth + common]) {
+            common++;
+        }
+        Node4* node = NewNode<Node4>();
+        node->prefixLength = static_cast<uint32_t>(common);
+        std::memcpy(node->prefix.data(), key.data() + depth, std::min(common, MAX_PREFIX));
+        const uint8_t oldByte = KeyByte(existing->key, depth + common);
+        const uint8_t newByte = KeyByte(key, depth + common);
+        ref = node;
+        AddChild(ref, oldByte, existing);
+        AddChild(ref, newByte, NewNode<Leaf>(key));
+        m_stats.leafExpansions++;
+        m_lastChanged = node;
+        EmitStep("Leaf expanded at depth {}: new Node4 with a {}-byte prefix branches on 0x{:02x} / 0x{:02x}",
+                 depth, common, oldByte, newByte);
+        return true;
+    }
+
+    InnerNode* inner = static_cast<InnerNode*>(ref);
+    m_stats.nodesVisited++;
+    if (inner->prefixLength > 0) {
+        const size_t mismatch = PrefixMismatch(inner, key, depth);
+        if (mismatch < inner->prefixLength) {
+            // The key leaves the compressed path part-way: split it at the first differing byte
+            Node4* parent = NewNode<Node4>();
+            parent->prefixLength = static_cast<uint32_t>(mismatch);
+            std::memcpy(parent->prefix.data(), inner->prefix.data(), std::min(mismatch, MAX_PREFIX));
+            uint8_t innerByte = 0;
+            if (inner->prefixLength <= MAX_PREFIX) {
+                innerByte = inner->prefix[mismatch];
+                inner->prefixLength -= static_cast<uint32_t>(mismatch + 1);
+                std::memmove(inner->prefix.data(), inner->prefix.data() + mismatch + 1,
+                             std::min<size_t>(inner->prefixLength, MAX_PREFIX));
+            } else {
+                // Only the leaves have the bytes past MAX_PREFIX
+                const Leaf* leaf = Minimum(inner);
+                innerByte = KeyByte(leaf->key, depth + mismatch);
+                inner->prefixLength -= static_cast<uint32_t>(mismatch + 1);
+                std::memcpy(inner->prefix.data(), leaf->key.data() + depth + mismatch + 1,
+                            std::min<size_t>(inner->prefixLength, MAX_PREFIX));
+            }
+            ref = parent;
+            AddChild(ref, innerByte, inner);
+            AddChild(ref, KeyByte(key, depth + mismatch), NewNode<Leaf>(key));
+            m_stats.prefixSplits++;
+            m_lastChanged = parent;
+            EmitStep("Prefix split at depth {}: {} shared byte(s) stay in a new Node4 above the {}",
+                     depth, mismatch, NodeTypeName(inner->type));
+            return true;
+        }
+        depth += inner->prefixLength;
+    }
+
+    const uint8_t byte = KeyByte(key, depth);
+    if (Node** child = FindChild(inner, byte)) {
+        return InsertAt(*child, key, depth + 1);
+    }
+    AddChild(ref, byte, NewNode<Leaf>(key));
+    return true;
+}
+
+// Adds child under byte, replacing ref with the next larger node type when full
+void AdaptiveRadixTree::AddChild(Node*& ref, uint8_t byte, Node* child) {
+    switch (ref->type) {
+    case NodeType::Node4: {
+        auto* node = static_cast<Node4*>(ref);
+        if (node->childCount < 4) {
+            int pos = 0;
+            while (pos < node->childCount && node->keys[pos] < byte) {
+                pos++;
+            }
+            std::move_backward(node->keys.begin() + pos, node->keys.begin() + node->childCount,
+                               node->keys.begin() + node->childCount + 1);
+            std::move_backward(node->children.begin() + pos, node->children.begin() + node->childCount,
+                               node->children.begin() + node->childCount + 1);
+            node->keys[pos] = byte;
+            node->children[pos] = child;
+            node->childCount++;
+            return;
+        }
+        auto* grown = NewNode<Node16>();
+        CopyHeader(grown, node);
+        std::copy(node->keys.begin(), node->keys.end(), grown->keys.begin());
+        std::copy(node->children.begin(), node->children.end(), grown->children.begin());
+        ref = grown;
+        DeleteNode(node);
+        m_stats.grows++;
+        m_lastChanged = grown;
+        EmitStep("Node4 full: grew into Node16 for byte 0x{:02x}", byte);
+        AddChild(ref, byte, child);
+        return;
+    }
+    case NodeType::Node16: {
+        auto* node = static_cast<Node16*>(ref);
+        if (node->childCount < 16) {
+            int pos = Node16LowerBound(node->keys.data(), node->childCount, byte);
+            std::move_backward(node->keys.begin() + pos, node->keys.begin() + node->childCount,
+                               node->keys.begin() + node->childCount + 1);
+            std::move_backward(node->children.begin() + pos, node->children.begin() + node->childCount,
+                               node->children.begin() + node->childCount + 1);
+            node->keys[pos] = byte;
+            node->children[pos] = child;
+            node->childCount++;
+            return;
+        }
+        auto* grown = NewNode<Node48>();
+        CopyHeader(grown, node);
+        for (int i = 0; i < 16; ++i) {
+            grown->childIndex[node->keys[i]] = static_cast<uint8_t>(i + 1);
+            grown->children[i] = node->children[i];
+        }
+        ref = grown;
+        DeleteNode(node);
+        m_stats.grows++;
+        m_lastChanged = grown;
+        EmitStep("Node16 full: grew into Node48 for byte 0x{:02x}", byte);
+        AddChild(ref, byte, child);
+        return;
+    }
+    case NodeType::Node48: {
+        auto* node = static_cast<Node48*>(ref);
+        if (node->childCount < 48) {
+            int slot = 0;
+            while (node->children[slot]) {
+                slot++;
+            }
+            node->children[slot] = child;
+            node->childIndex[byte] = static_cast<uint8_t>(slot + 1);
+            node->childCount++;
+            return;
+        }
+        auto* grown = NewNode<Node256>();
+        CopyHeader(grown, node);
+        for (int b = 0; b < 256; ++b) {
+            if (node->childIndex[b]) {
+                grown->children[b] = node->children[node->childIndex[b] - 1];
+            }
+        }
+        ref = grown;
+        DeleteNode(node);
+        m_stats.grows++;
+        m_lastChanged = grown;
+        EmitStep("Node48 full: grew into Node256 for byte 0x{:02x}", byte);
+        AddChild(ref, byte, child);
+        return;
+    }
+    case NodeType::Node256: {
+        auto* node = static_cast<Node256*>(ref);
+        node->children[byte] = child;
+        node->childCount++;
+        return;
+    }
+    case NodeType::Leaf:
+        break;
+    }
+}
+
+// Erasure
+bool AdaptiveRadixTree::EraseKey(std::string_view key) {
+    m_lastChanged = nullptr;
+    if (!EraseAt(m_root, key, 0)) {
+        return false;
+    }
+    m_size--;
+    return true;
+}
+
+bool AdaptiveRadixTree::EraseAt(Node*& ref, std::string_view key, size_t depth) {
+    if (!ref) {
+        return false;
+    }
+    if (ref->type == NodeType::Leaf) {
+        // Only reached for a leaf at the root; deeper leaves are removed by their parent
+        if (static_cast<Leaf*>(ref)->key != key) {
+            return false;
+        }
+        DeleteNode(ref);
+        ref = nullptr;
+        return true;
+    }
+
+    InnerNode* inner = static_cast<InnerNode*>(ref);
+    const size_t stored = std::min<size_t>(inner->prefixLength, MAX_PREFIX);
+    for (size_t i = 0; i < stored; ++i) {
+        if (inner->prefix[i] != KeyByte(key, depth + i)) {
+            return false;
+        }
+    }
+    depth += inner->prefixLength;
+
+    const uint8_t byte = KeyByte(key, depth);
+    Node** slot = FindChild(inner, byte);
+    if (!slot) {
+        return false;
+    }
+    if ((*slot)->type != NodeType::Leaf) {
+        return EraseAt(*slot, key, depth + 1);
+    }
+    Leaf* leaf = static_cast<Leaf*>(*slot);
+    if (leaf->key != key) {
+        return false;
+    }
+    RemoveChild(ref, byte, slot);
+    DeleteNode(leaf);
+    return true;
+}
+
+// Removes the child under byte (at slot), replacing ref with the next smaller node type
+// when it drops to the shrink threshold. A Node4 left with one child disappears and its
+// prefix and key byte are prepended to the child's prefix.
+void AdaptiveRadixTree::RemoveChild(Node*& ref, uint8_t byte, Node** slot) {
+    switch (ref->type) {
+    case NodeType::Node4: {
+        auto* node = static_cast<Node4*>(ref);
+        const int pos = static_cast<int>(slot - node->children.data());
+        std::move(node->keys.begin() + pos + 1, node->keys.begin() + node->childCount, node->keys.begin() + pos);
+        std::move(node->children.begin() + pos + 1, node->children.begin() + node->childCount,
+                  node->children.begin() + pos);
+        node->childCount--;
+        if (node->childCount != 1) {
+            return;
+        }
+        Node* child = node->children[0];
+        if (child->type != NodeType::Leaf) {
+            auto* inner = static_cast<InnerNode*>(child);
+            std::array<uint8_t, MAX_PREFIX> merged{};
+            size_t length = std::min<size_t>(node->prefixLength, MAX_PREFIX);
+            std::copy_n(node->prefix.begin(), length, merged.begin());
+            if (length < MAX_PREFIX) {
+                merged[length++] = node->keys[0];
+            }
+            const size_t tail = std::min<size_t>(inner->prefixLength, MAX_PREFIX - length);
+            std::copy_n(inner->prefix.begin(), tail, merged.begin() + length);
+            inner->prefix = merged;
+            inner->prefixLength += node->prefixLength + 1;
+            m_lastChanged = inner;
+        }
+        ref = child;
+        DeleteNode(node);
+        m_stats.shrinks++;
+        EmitStep("Node4 down to one child: merged into the {} below", NodeTypeName(child->type));
+        return;
+    }
+    case NodeType::Node16: {
+        auto* node = static_cast<Node16*>(ref);
+        const int pos = static_cast<int>(slot - node->children.data());
+        std::move(node->keys.begin() + pos + 1, node->keys.begin() + node->childCount, node->keys.begin() + pos);
+        std::move(node->children.begin() + pos + 1, node->children.begin() + node->childCount,
+                  node->children.begin() + pos);
+        node->childCount--;
+        if (node->childCount != NODE16_SHRINK) {
+            return;
+        }
+        auto* shrunk = NewNode<Node4>();
+        CopyHeader(shrunk, node);
+        std::copy_n(node->keys.begin(), node->childCount, shrunk->keys.begin());
+        std::copy_n(node->children.begin(), node->childCount, shrunk->children.begin());
+        ref = shrunk;
+        DeleteNode(node);
+        m_stats.shrinks++;
+        m_lastChanged = shrunk;
+        EmitStep("Node16 down to {} children: shrank into Node4", NODE16_SHRINK);
+        return;
+    }
+    case NodeType::Node48: {
+        auto* node = static_cast<Node48*>(ref);
+        node->children[node->childIndex[byte] - 1] = nullptr;
+        node->childIndex[byte] = 0;
+        node->childCount--;
+        if (node->childCount != NODE48_SHRINK) {
+            return;
+        }
+        auto* shrunk = NewNode<Node16>();
+        CopyHeader(shrunk, node);
+        int count = 0;
+        for (int b = 0; b < 256; ++b) {
+            if (node->childIndex[b]) {
+                shrunk->keys[count] = static_cast<uint8_t>(b);
+                shrunk->children[count] = node->children[node->childIndex[b] - 1];
+                count++;
+            }
+        }
+        ref = shrunk;
+        DeleteNode(node);
+        m_stats.shrinks++;
+        m_lastChanged = shrunk;
+        EmitStep("Node48 down to {} children: shrank into Node16", NODE48_SHRINK);
+        return;
+    }
+    case NodeType::Node256: {
+        auto* node = static_cast<Node256*>(ref);
+        node->children[byte] = nullptr;
+        node->childCount--;
+        if (node->childCount != NODE256_SHRINK) {
+            return;
+        }
+        auto* shrunk = NewNode<Node48>();
+        CopyHeader(shrunk, node);
+        int count = 0;
+        for (int b = 0; b < 256; ++b) {
+            if (node->children[b]) {
+                shrunk->children[count] = node->children[b];
+                shrunk->childIndex[b] = static_cast<uint8_t>(++count);
+            }
+        }
+        ref = shrunk;
+        DeleteNode(node);
+        m_stats.shrinks++;
+        m_lastChanged = shrunk;
+        EmitStep("Node256 down to {} children: shrank into Node48", NODE256_SHRINK);
+        return;
+    }
+    case NodeType::Leaf:
+        break;
+    }
+}
+
+// Ordered traversal
+template <typename Visit>
+void AdaptiveRadixTree::WalkSubtree(const Node* node, Visit& visit) {
+    if (!node) {
+        return;
+    }
+    if (node->type == NodeType::Leaf) {
+        visit(std::string_view(static_cast<const Leaf*>(node)->key));
+        return;
+    }
+    VisitChildren(static_cast<const InnerNode*>(node), [&](uint8_t, const Node* child) {
+        WalkSubtree(child, visit);
+    });
+}
+
+void AdaptiveRadixTree::ForEach(const KeyVisitor& visit) const {
+    WalkSubtree(m_root, visit);
+}
+
+void AdaptiveRadixTree::ForEachChild(const InnerNode* node, const std::function<void(uint8_t, const Node*)>& visit) {
+    VisitChildren(node, visit);
+}
+
+std::vector<int> AdaptiveRadixTree::Keys() const {
+    std::vector<int> keys;
+    keys.reserve(m_size);
+    auto collect = [&](std::string_view key) { keys.push_back(DecodeInt(key)); };
+    WalkSubtree(m_root, collect);
+    return keys;
+}
+
+std::vector<std::string> AdaptiveRadixTree::StringKeys() const {
+    std::vector<std::string> keys;
+    keys.reserve(m_size);
+    auto collect = [&](std::string_view key) { keys.emplace_back(key.substr(0, key.size() - 1)); };
+    WalkSubtree(m_root, collect);
+    return keys;
+}
+
+std::vector<int> AdaptiveRadixTree::RangeScan(int low, int high) const {
+    std::vector<int> out;
+    if (low > high) {
+        return out;
+    }
+    const IntKey lowKey = EncodeInt(low);
+    const IntKey highKey = EncodeInt(high);
+    CollectRange(m_root, 0, std::string_view(lowKey.data(), lowKey.size()),
+                 std::string_view(highKey.data(), highKey.size()), true, true, out);
+    return out;
+}
+
+// onLow / onHigh: the path so far equals that bound's prefix, so it still constrains the
+// next byte. Once the path moves strictly inside the range the whole subtree qualifies.
+void AdaptiveRadixTree::CollectRange(const Node* node, size_t depth, std::string_view low, std::string_view high,
+                                     bool onLow, bool onHigh, std::vector<int>& out) const {
+    if (!node) {
+        return;
+    }
+    if (node->type == NodeType::Leaf) {
+        // Lazily placed leaves can differ from the bounds below depth, so compare in full
+        std::string_view key = static_cast<const Leaf*>(node)->key;
+        if (key >= low && key <= high) {
+            out.push_back(DecodeInt(key));
+        }
+        return;
+    }
+
+    const auto* inner = static_cast<const InnerNode*>(node);
+    if (inner->prefixLength > 0 && (onLow || onHigh)) {
+        const Leaf* leaf = inner->prefixLength > MAX_PREFIX ? Minimum(inner) : nullptr;
+        for (size_t i = 0; i < inner->prefixLength && (onLow || onHigh); ++i) {
+            const uint8_t byte = leaf ? KeyByte(leaf->key, depth + i) : inner->prefix[i];
+            if (onLow) {
+                const uint8_t bound = KeyByte(low, depth + i);
+                if (byte < bound) {
+                    return;
+                }
+                onLow = byte == bound;
+            }
+            if (onHigh) {
+                const uint8_t bound = KeyByte(high, depth + i);
+                if (byte > bound) {
+                    return;
+                }
+                onHigh = byte == bound;
+            }
+        }
+    }
+    depth += inner->prefixLength;
+
+    const uint8_t lowByte = onLow ? KeyByte(low, depth) : 0;
+    const uint8_t highByte = onHigh ? KeyByte(high, depth) : 255;
+    VisitChildren(inner, [&](uint8_t byte, const Node* child) {
+        if (byte >= lowByte && byte <= highByte) {
+            CollectRange(child, depth + 1, low, high, onLow && byte == lowByte, onHigh && byte == highByte, out);
+        }
+    });
+}
+
+const char* AdaptiveRadixTree::NodeTypeName(NodeType type) {
+    switch (type) {
+    case NodeType::Leaf: return "Leaf";
+    case NodeType::Node4: return "Node4";
+    case NodeType::Node16: return "Node16";
+    case NodeType::Node48: return "Node48";
+    case NodeType::Node256: return "Node256";
+    }
+    return "Unknown";
+}
+
+const char* AdaptiveRadixTree::SearchKernelName() {
+#if defined(ALGO1_ART_SSE2)
+    return "SSE2 Node16 search (16 key bytes per compare)";
+#else
+    return "Scalar Node16 search";
+#endif
+}
+
+} // namespace AlgorithmVisualizer
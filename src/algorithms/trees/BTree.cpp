@@ -0,0 +1,419 @@
+#include "algorithms/trees/BTree.h"
+#include <algorithm>
+#include <bit>
+#include <climits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define ALGO1_BTREE_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ALGO1_BTREE_SSE2 1
+#endif
+
+namespace AlgorithmVisualizer {
+
+namespace {
+
+// Window size below which the node search switches from binary narrowing to a
+// branch-free vector count over the remaining keys
+constexpr int LINEAR_WINDOW = 32;
+
+// Count keys in [keys, keys + count) that are < key (orEqual = false) or <= key (orEqual = true)
+int CountKeys(const int* keys, int count, int key, bool orEqual) {
+    int total = 0;
+    int i = 0;
+#if defined(ALGO1_BTREE_AVX2)
+    const __m256i needle = _mm256_set1_epi32(key);
+    for (; i + 8 <= count; i += 8) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+        __m256i greater = _mm256_cmpgt_epi32(block, needle);
+        __m256i mask = orEqual ? greater : _mm256_cmpgt_epi32(needle, block);
+        int bits = std::popcount(static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(mask))));
+        total += orEqual ? 8 - bits : bits;
+    }
+#elif defined(ALGO1_BTREE_SSE2)
+    const __m128i needle = _mm_set1_epi32(key);
+    for (; i + 4 <= count; i += 4) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+        __m128i mask = orEqual ? _mm_cmpgt_epi32(block, needle) : _mm_cmplt_epi32(block, needle);
+        int bits = std::popcount(static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(mask))));
+        total += orEqual ? 4 - bits : bits;
+    }
+#endif
+    for (; i < count; ++i) {
+        total += orEqual ? (keys[i] <= key) : (keys[i] < key);
+    }
+    return total;
+}
+
+} // namespace
+
+BTree::BTree(int order, Variant variant)
+    : m_root(std::make_unique<Node>()),
+      m_order(std::clamp(order, MIN_ORDER, MAX_ORDER)),
+      m_variant(variant) {
+    m_root->keys.reserve(m_order + 1);
+}
+
+int BTree::NodeLowerBound(const int* keys, int count, int key) {
+    int low = 0;
+    int high = count;
+    while (high - low > LINEAR_WINDOW) {
+        int mid = low + (high - low) / 2;
+        if (keys[mid] < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low + CountKeys(keys + low, high - low, key, false);
+}
+
+int BTree::NodeUpperBound(const int* keys, int count, int key) {
+    int low = 0;
+    int high = count;
+    while (high - low > LINEAR_WINDOW) {
+        int mid = low + (high - low) / 2;
+        if (keys[mid] <= key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low + CountKeys(keys + low, high - low, key, true);
+}
+
+const char* BTree::SearchKernelName() {
+#if defined(ALGO1_BTREE_AVX2)
+    return "AVX2 (8 keys per compare)";
+#elif defined(ALGO1_BTREE_SSE2)
+    return "SSE2 (4 keys per compare)";
+#else
+    return "Scalar";
+#endif
+}
+
+int BTree::ChildIndex(const Node* node, int key) const {
+    const int count = static_cast<int>(node->keys.size());
+    // B+tree separators are copies of the first key in the right subtree, so equal keys go right
+    return m_variant == Variant::BPlusTree ? NodeUpperBound(node->keys.data(), count, key)
+                                           : NodeLowerBound(node->keys.data(), count, key);
+}
+
+int BTree::Height() const {
+    int height = 1;
+    for (const Node* node = m_root.get(); !node->leaf; node = node->children.front().get()) {
+        height++;
+    }
+    return height;
+}
+
+void BTree::Clear() {
+    m_root = std::make_unique<Node>();
+    m_root->keys.reserve(m_order + 1);
+    m_size = 0;
+    m_nodeCount = 1;
+}
+
+bool BTree::Contains(int key) const {
+    const Node* node = m_root.get();
+    while (true) {
+        m_stats.nodesVisited++;
+        const int count = static_cast<int>(node->keys.size());
+        if (m_variant == Variant::BTree || node->leaf) {
+            int pos = NodeLowerBound(node->keys.data(), count, key);
+            if (pos < count && node->keys[pos] == key) {
+                return true;
+            }
+            if (node->leaf) {
+                return false;
+            }
+            node = node->children[pos].get();
+        } else {
+            node = node->children[NodeUpperBound(node->keys.data(), count, key)].get();
+        }
+    }
+}
+
+bool BTree::Insert(int key) {
+    int promotedKey = 0;
+    std::unique_ptr<Node> splitOff;
+    if (!InsertInto(m_root.get(), key, promotedKey, splitOff)) {
+        return false;
+    }
+
+    if (splitOff) {
+        auto newRoot = std::make_unique<Node>();
+        newRoot->leaf = false;
+        newRoot->keys.reserve(m_order + 1);
+        newRoot->keys.push_back(promotedKey);
+        newRoot->children.push_back(std::move(m_root));
+        newRoot->children.push_back(std::move(splitOff));
+        m_root = std::move(newRoot);
+        m_nodeCount++;
+        EmitStep("Root split: {} becomes the new root, height grows to {}", promotedKey, Height());
+    }
+
+    m_size++;
+    return true;
+}
+
+bool BTree::InsertInto(Node* node, int key, int& promotedKey, std::unique_ptr<Node>& splitOff) {
+    m_stats.nodesVisited++;
+    const int count = static_cast<int>(node->keys.size());
+
+    if (node->leaf) {
+        int pos = NodeLowerBound(node->keys.data(), count, key);
+        if (pos < count && node->keys[pos] == key) {
+            EmitStep("Key {} already present, nothing to insert", key);
+            return false;
+        }
+        node->keys.insert(node->keys.begin() + pos, key);
+        EmitStep("Inserted {} into leaf at slot {} ({}/{} keys)", key, pos, count + 1, m_order);
+    } else {
+        int index = ChildIndex(node, key);
+        if (m_variant == Variant::BTree && index < count && node->keys[index] == key) {
+            EmitStep("Key {} already present in internal node", key);
+            return false;
+        }
+        EmitStep("Node [{}..{}]: descending into child {} for key {}",
+                 node->keys.front(), node->keys.back(), index, key);
+
+        int childPromoted = 0;
+        std::unique_ptr<Node> childSplit;
+        if (!InsertInto(node->children[index].get(), key, childPromoted, childSplit)) {
+            return false;
+        }
+        if (childSplit) {
+            node->keys.insert(node->keys.begin() + index, childPromoted);
+            node->children.insert(node->children.begin() + index + 1, std::move(childSplit));
+        }
+    }
+
+    if (static_cast<int>(node->keys.size()) > m_order) {
+        SplitNode(node, promotedKey, splitOff);
+    }
+    return true;
+}
+
+void BTree::SplitNode(Node* node, int& promotedKey, std::unique_ptr<Node>& splitOff) {
+    const int total = static_cast<int>(node->keys.size());
+    const int mid = total / 2;
+
+    auto right = std::make_unique<Node>();
+    right->leaf = node->leaf;
+    right->keys.reserve(m_order + 1);
+
+    if (node->leaf && m_variant == Variant::BPlusTree) {
+        // Leaf split copies the separator up and keeps every key in the leaf level
+        right->keys.assign(node->keys.begin() + mid, node->keys.end());
+        node->keys.resize(mid);
+        promotedKey = right->keys.front();
+        right->next = node->next;
+        node->next = right.get();
+    } else {
+        promotedKey = node->keys[mid];
+        right->keys.assign(node->keys.begin() + mid + 1, node->keys.end());
+        node->keys.resize(mid);
+        if (!node->leaf) {
+            for (size_t i = mid + 1; i < node->children.size(); ++i) {
+                right->children.push_back(std::move(node->children[i]));
+            }
+            node->children.resize(mid + 1);
+        }
+    }
+
+    m_stats.splits++;
+    m_nodeCount++;
+    EmitStep("Overflow ({} keys > order {}): split into {} + {}, promoting {}",
+             total, m_order, node->keys.size(), right->keys.size(), promotedKey);
+    splitOff = std::move(right);
+}
+
+bool BTree::Erase(int key) {
+    if (!EraseFrom(m_root.get(), key)) {
+        return false;
+    }
+
+    if (!m_root->leaf && m_root->keys.empty()) {
+        std::unique_ptr<Node> onlyChild = std::move(m_root->children.front());
+        m_root = std::move(onlyChild);
+        m_nodeCount--;
+        EmitStep("Root emptied by merge, height shrinks to {}", Height());
+    }
+
+    m_size--;
+    return true;
+}
+
+bool BTree::EraseFrom(Node* node, int key) {
+    m_stats.nodesVisited++;
+    const int count = static_cast<int>(node->keys.size());
+
+    if (node->leaf) {
+        int pos = NodeLowerBound(node->keys.data(), count, key);
+        if (pos >= count || node->keys[pos] != key) {
+            EmitStep("Key {} not found", key);
+            return false;
+        }
+        node->keys.erase(node->keys.begin() + pos);
+        EmitStep("Removed {} from leaf ({} keys left)", key, count - 1);
+        return true;
+    }
+
+    int index = ChildIndex(node, key);
+    int target = key;
+    if (m_variant == Variant::BTree && index < count && node->keys[index] == key) {
+        // Internal key: replace with the in-order predecessor and delete that from the left subtree
+        const Node* cursor = node->children[index].get();
+        while (!cursor->leaf) {
+            cursor = cursor->children.back().get();
+        }
+        target = cursor->keys.back();
+        node->keys[index] = target;
+        EmitStep("{} found in internal node, replaced by predecessor {}", key, target);
+    }
+
+    if (!EraseFrom(node->children[index].get(), target)) {
+        return false;
+    }
+
+    if (static_cast<int>(node->children[index]->keys.size()) < MinKeys()) {
+        FixUnderflow(node, index);
+    }
+    return true;
+}
+
+void BTree::FixUnderflow(Node* parent, int childIndex) {
+    const int minKeys = MinKeys();
+    const int lastChild = static_cast<int>(parent->children.size()) - 1;
+
+    if (childIndex > 0 && static_cast<int>(parent->children[childIndex - 1]->keys.size()) > minKeys) {
+        BorrowFromLeft(parent, childIndex);
+    } else if (childIndex < lastChild &&
+               static_cast<int>(parent->children[childIndex + 1]->keys.size()) > minKeys) {
+        BorrowFromRight(parent, childIndex);
+    } else if (childIndex > 0) {
+        MergeChildren(parent, childIndex - 1);
+    } else {
+        MergeChildren(parent, childIndex);
+    }
+}
+
+void BTree::BorrowFromLeft(Node* parent, int childIndex) {
+    Node* child = parent->children[childIndex].get();
+    Node* left = parent->children[childIndex - 1].get();
+
+    if (child->leaf && m_variant == Variant::BPlusTree) {
+        child->keys.insert(child->keys.begin(), left->keys.back());
+        left->keys.pop_back();
+        parent->keys[childIndex - 1] = child->keys.front();
+    } else {
+        child->keys.insert(child->keys.begin(), parent->keys[childIndex - 1]);
+        parent->keys[childIndex - 1] = left->keys.back();
+        left->keys.pop_back();
+        if (!child->leaf) {
+            child->children.insert(child->children.begin(), std::move(left->children.back()));
+            left->children.pop_back();
+        }
+    }
+
+    m_stats.borrows++;
+    EmitStep("Underflow: borrowed {} from left sibling, separator is now {}",
+             child->keys.front(), parent->keys[childIndex - 1]);
+}
+
+void BTree::BorrowFromRight(Node* parent, int childIndex) {
+    Node* child = parent->children[childIndex].get();
+    Node* right = parent->children[childIndex + 1].get();
+
+    if (child->leaf && m_variant == Variant::BPlusTree) {
+        child->keys.push_back(right->keys.front());
+        right->keys.erase(right->keys.begin());
+        parent->keys[childIndex] = right->keys.front();
+    } else {
+        child->keys.push_back(parent->keys[childIndex]);
+        parent->keys[childIndex] = right->keys.front();
+        right->keys.erase(right->keys.begin());
+        if (!child->leaf) {
+            child->children.push_back(std::move(right->children.front()));
+            right->children.erase(right->children.begin());
+        }
+    }
+
+    m_stats.borrows++;
+    EmitStep("Underflow: borrowed {} from right sibling, separator is now {}",
+             child->keys.back(), parent->keys[childIndex]);
+}
+
+void BTree::MergeChildren(Node* parent, int leftIndex) {
+    Node* left = parent->children[leftIndex].get();
+    std::unique_ptr<Node> right = std::move(parent->children[leftIndex + 1]);
+    const int separator = parent->keys[leftIndex];
+
+    if (left->leaf && m_variant == Variant::BPlusTree) {
+        // Leaf separators are only routing copies, so they are dropped rather than pulled down
+        left->keys.insert(left->keys.end(), right->keys.begin(), right->keys.end());
+        left->next = right->next;
+    } else {
+        left->keys.push_back(separator);
+        left->keys.insert(left->keys.end(), right->keys.begin(), right->keys.end());
+        for (auto& child : right->children) {
+            left->children.push_back(std::move(child));
+        }
+    }
+
+    parent->keys.erase(parent->keys.begin() + leftIndex);
+    parent->children.erase(parent->children.begin() + leftIndex + 1);
+
+    m_stats.merges++;
+    m_nodeCount--;
+    EmitStep("Merged siblings around separator {} into a node of {} keys", separator, left->keys.size());
+}
+
+std::vector<int> BTree::RangeScan(int low, int high) const {
+    std::vector<int> result;
+    if (low > high) {
+        return result;
+    }
+
+    if (m_variant == Variant::BPlusTree) {
+        // Descend once to the first candidate leaf, then follow the leaf chain
+        const Node* node = m_root.get();
+        while (!node->leaf) {
+            node = node->children[ChildIndex(node, low)].get();
+        }
+        for (; node; node = node->next) {
+            const int count = static_cast<int>(node->keys.size());
+            for (int i = NodeLowerBound(node->keys.data(), count, low); i < count; ++i) {
+                if (node->keys[i] > high) {
+                    return result;
+                }
+                result.push_back(node->keys[i]);
+            }
+        }
+    } else {
+        CollectRange(m_root.get(), low, high, result);
+    }
+    return result;
+}
+
+std::vector<int> BTree::Keys() const {
+    return RangeScan(INT_MIN, INT_MAX);
+}
+
+void BTree::CollectRange(const Node* node, int low, int high, std::vector<int>& out) const {
+    const int count = static_cast<int>(node->keys.size());
+    for (int i = NodeLowerBound(node->keys.data(), count, low); i <= count; ++i) {
+        if (!node->leaf) {
+            CollectRange(node->children[i].get(), low, high, out);
+        }
+        if (i == count || node->keys[i] > high) {
+            return;
+        }
+        out.push_back(node->keys[i]);
+    }
+}
+
+} // namespace AlgorithmVisualizer
@@ -0,0 +1,70 @@
+#include "algorithms/trees/EpochManager.h"
+
+namespace AlgorithmVisualizer {
+
+EpochManager::~EpochManager() {
+    for (Slot& slot : m_slots) {
+        for (auto& list : slot.limbo) {
+            Free(list);
+        }
+    }
+}
+
+void EpochManager::Enter(int slot) {
+    uint64_t epoch = m_globalEpoch.load(std::memory_order_seq_cst);
+    m_slots[slot].state.store((epoch << 1) | ACTIVE, std::memory_order_seq_cst);
+    // Publish the slot before any load from the structure
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void EpochManager::Exit(int slot) {
+    m_slots[slot].state.store(0, std::memory_order_release);
+}
+
+void EpochManager::Retire(int slot, void* object, void (*deleter)(void*)) {
+    Slot& s = m_slots[slot];
+    uint64_t epoch = m_globalEpoch.load(std::memory_order_seq_cst);
+    size_t bucket = epoch % 3;
+
+    // The bucket last held objects from epoch - 3 or earlier, which nobody can still see
+    if (s.limboEpoch[bucket] != epoch) {
+        s.reclaimed += s.limbo[bucket].size();
+        Free(s.limbo[bucket]);
+        s.limboEpoch[bucket] = epoch;
+    }
+    s.limbo[bucket].push_back({object, deleter});
+
+    if (++s.retiresSinceAdvance >= ADVANCE_INTERVAL) {
+        s.retiresSinceAdvance = 0;
+        TryAdvance();
+    }
+}
+
+uint64_t EpochManager::ReclaimedCount() const {
+    uint64_t total = 0;
+    for (const Slot& slot : m_slots) {
+        total += slot.reclaimed;
+    }
+    return total;
+}
+
+// The epoch moves on only when every active thread has observed the current one
+void EpochManager::TryAdvance() {
+    uint64_t epoch = m_globalEpoch.load(std::memory_order_seq_cst);
+    for (const Slot& slot : m_slots) {
+        uint64_t state = slot.state.load(std::memory_order_seq_cst);
+        if ((state & ACTIVE) && (state >> 1) != epoch) {
+            return;
+        }
+    }
+    m_globalEpoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+}
+
+void EpochManager::Free(std::vector<Retired>& list) {
+    for (const Retired& retired : list) {
+        retired.deleter(retired.object);
+    }
+    list.clear();
+}
+
+} // namespace AlgorithmVisualizer
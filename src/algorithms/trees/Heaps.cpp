@@ -0,0 +1,316 @@
+#include "algorithms/trees/Heaps.h"
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace AlgorithmVisualizer {
+
+// ---------------------------------------------------------------------------
+// d-ary heap
+// ---------------------------------------------------------------------------
+
+DaryHeap::DaryHeap(int arity, size_t capacity)
+    : m_arity(std::max(2, arity)), m_position(capacity, -1) {
+    m_heap.reserve(capacity);
+}
+
+bool DaryHeap::Push(int item, uint32_t key) {
+    if (item < 0 || static_cast<size_t>(item) >= m_position.size() || m_position[item] >= 0) {
+        return false;
+    }
+    m_heap.push_back({item, key});
+    SiftUp(m_heap.size() - 1);
+    return true;
+}
+
+bool DaryHeap::DecreaseKey(int item, uint32_t key) {
+    if (!Contains(item) || key >= m_heap[m_position[item]].key) {
+        return false;
+    }
+    size_t index = static_cast<size_t>(m_position[item]);
+    m_heap[index].key = key;
+    SiftUp(index);
+    return true;
+}
+
+PriorityQueue::Entry DaryHeap::Pop() {
+    Entry top = m_heap.front();
+    m_position[top.item] = -1;
+
+    Entry last = m_heap.back();
+    m_heap.pop_back();
+    if (!m_heap.empty()) {
+        m_heap[0] = last;
+        SiftDown(0);
+    }
+    return top;
+}
+
+bool DaryHeap::Contains(int item) const {
+    return item >= 0 && static_cast<size_t>(item) < m_position.size() && m_position[item] >= 0;
+}
+
+uint32_t DaryHeap::KeyOf(int item) const {
+    return m_heap[m_position[item]].key;
+}
+
+void DaryHeap::Clear() {
+    for (const Entry& entry : m_heap) {
+        m_position[entry.item] = -1;
+    }
+    m_heap.clear();
+}
+
+const char* DaryHeap::Name() const {
+    switch (m_arity) {
+        case 2: return "Binary heap";
+        case 4: return "4-ary heap";
+        case 8: return "8-ary heap";
+        default: return "d-ary heap";
+    }
+}
+
+void DaryHeap::SiftUp(size_t index) {
+    const Entry moving = m_heap[index];
+    while (index > 0) {
+        size_t parent = (index - 1) / m_arity;
+        if (m_heap[parent].key <= moving.key) {
+            break;
+        }
+        m_heap[index] = m_heap[parent];
+        m_position[m_heap[index].item] = static_cast<int>(index);
+        index = parent;
+    }
+    m_heap[index] = moving;
+    m_position[moving.item] = static_cast<int>(index);
+}
+
+void DaryHeap::SiftDown(size_t index) {
+    const Entry moving = m_heap[index];
+    const size_t size = m_heap.size();
+    for (;;) {
+        size_t first = index * m_arity + 1;
+        if (first >= size) {
+            break;
+        }
+        size_t last = std::min(first + m_arity, size);
+        size_t best = first;
+        for (size_t child = first + 1; child < last; ++child) {
+            if (m_heap[child].key < m_heap[best].key) {
+                best = child;
+            }
+        }
+        if (m_heap[best].key >= moving.key) {
+            break;
+        }
+        m_heap[index] = m_heap[best];
+        m_position[m_heap[index].item] = static_cast<int>(index);
+        index = best;
+    }
+    m_heap[index] = moving;
+    m_position[moving.item] = static_cast<int>(index);
+}
+
+// ---------------------------------------------------------------------------
+// Pairing heap
+// ---------------------------------------------------------------------------
+
+PairingHeap::PairingHeap(size_t capacity)
+    : m_nodes(capacity) {
+}
+
+bool PairingHeap::Push(int item, uint32_t key) {
+    if (item < 0 || static_cast<size_t>(item) >= m_nodes.size() || m_nodes[item].queued) {
+        return false;
+    }
+    m_nodes[item] = Node{};
+    m_nodes[item].key = key;
+    m_nodes[item].queued = true;
+    m_root = m_root < 0 ? item : Meld(m_root, item);
+    m_size++;
+    return true;
+}
+
+bool PairingHeap::DecreaseKey(int item, uint32_t key) {
+    if (!Contains(item) || key >= m_nodes[item].key) {
+        return false;
+    }
+    Node& node = m_nodes[item];
+    node.key = key;
+    if (item == m_root) {
+        return true;
+    }
+
+    // Cut the subtree out of its sibling list and meld it back at the root
+    Node& prev = m_nodes[node.prev];
+    if (prev.child == item) {
+        prev.child = node.sibling;
+    } else {
+        prev.sibling = node.sibling;
+    }
+    if (node.sibling >= 0) {
+        m_nodes[node.sibling].prev = node.prev;
+    }
+    node.sibling = -1;
+    node.prev = -1;
+    m_root = Meld(m_root, item);
+    return true;
+}
+
+PriorityQueue::Entry PairingHeap::Pop() {
+    const int top = m_root;
+    Node& node = m_nodes[top];
+    Entry entry{top, node.key};
+
+    m_root = MergePairs(node.child);
+    node.child = -1;
+    node.queued = false;
+    m_size--;
+    return entry;
+}
+
+bool PairingHeap::Contains(int item) const {
+    return item >= 0 && static_cast<size_t>(item) < m_nodes.size() && m_nodes[item].queued;
+}
+
+uint32_t PairingHeap::KeyOf(int item) const {
+    return m_nodes[item].key;
+}
+
+void PairingHeap::Clear() {
+    std::fill(m_nodes.begin(), m_nodes.end(), Node{});
+    m_root = -1;
+    m_size = 0;
+}
+
+// Both arguments must be detached roots; the larger key becomes the leftmost child
+int PairingHeap::Meld(int a, int b) {
+    if (m_nodes[b].key < m_nodes[a].key) {
+        std::swap(a, b);
+    }
+    Node& parent = m_nodes[a];
+    Node& child = m_nodes[b];
+    child.sibling = parent.child;
+    if (parent.child >= 0) {
+        m_nodes[parent.child].prev = b;
+    }
+    child.prev = a;
+    parent.child = b;
+    parent.prev = -1;
+    parent.sibling = -1;
+    return a;
+}
+
+int PairingHeap::MergePairs(int first) {
+    if (first < 0) {
+        return -1;
+    }
+
+    // Left to right: meld adjacent pairs
+    m_pairs.clear();
+    int current = first;
+    while (current >= 0) {
+        int second = m_nodes[current].sibling;
+        m_nodes[current].prev = -1;
+        m_nodes[current].sibling = -1;
+        if (second < 0) {
+            m_pairs.push_back(current);
+            break;
+        }
+        int next = m_nodes[second].sibling;
+        m_nodes[second].prev = -1;
+        m_nodes[second].sibling = -1;
+        m_pairs.push_back(Meld(current, second));
+        current = next;
+    }
+
+    // Right to left: accumulate into one tree
+    int result = m_pairs.back();
+    for (size_t i = m_pairs.size() - 1; i-- > 0;) {
+        result = Meld(m_pairs[i], result);
+    }
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// Radix heap
+// ---------------------------------------------------------------------------
+
+RadixHeap::RadixHeap(size_t capacity)
+    : m_keys(capacity, 0), m_queued(capacity, 0) {
+}
+
+int RadixHeap::BucketIndex(uint32_t key, uint32_t last) {
+    return key == last ? 0 : 32 - std::countl_zero(key ^ last);
+}
+
+bool RadixHeap::Push(int item, uint32_t key) {
+    if (item < 0 || static_cast<size_t>(item) >= m_keys.size() || m_queued[item] || key < m_last) {
+        return false;
+    }
+    m_keys[item] = key;
+    m_queued[item] = 1;
+    m_buckets[BucketIndex(key, m_last)].push_back({item, key});
+    m_size++;
+    return true;
+}
+
+bool RadixHeap::DecreaseKey(int item, uint32_t key) {
+    if (!Contains(item) || key >= m_keys[item] || key < m_last) {
+        return false;
+    }
+    m_keys[item] = key;
+    m_buckets[BucketIndex(key, m_last)].push_back({item, key});
+    return true;
+}
+
+PriorityQueue::Entry RadixHeap::Pop() {
+    for (;;) {
+        if (m_buckets[0].empty()) {
+            int index = 1;
+            while (m_buckets[index].empty()) {
+                index++;
+            }
+
+            // Every entry in the bucket lands in a strictly lower one around the new minimum
+            m_redistribute.swap(m_buckets[index]);
+            m_last = std::min_element(m_redistribute.begin(), m_redistribute.end(),
+                                      [](const Entry& a, const Entry& b) { return a.key < b.key; })->key;
+            for (const Entry& entry : m_redistribute) {
+                m_buckets[BucketIndex(entry.key, m_last)].push_back(entry);
+            }
+            m_redistribute.clear();
+        }
+
+        Entry entry = m_buckets[0].back();
+        m_buckets[0].pop_back();
+        if (IsLive(entry)) {
+            m_queued[entry.item] = 0;
+            m_size--;
+            return entry;
+        }
+    }
+}
+
+bool RadixHeap::Contains(int item) const {
+    return item >= 0 && static_cast<size_t>(item) < m_keys.size() && m_queued[item];
+}
+
+uint32_t RadixHeap::KeyOf(int item) const {
+    return m_keys[item];
+}
+
+bool RadixHeap::IsLive(const Entry& entry) const {
+    return m_queued[entry.item] && m_keys[entry.item] == entry.key;
+}
+
+void RadixHeap::Clear() {
+    for (auto& bucket : m_buckets) {
+        bucket.clear();
+    }
+    std::fill(m_queued.begin(), m_queued.end(), 0);
+    m_last = 0;
+    m_size = 0;
+}
+
+} // namespace AlgorithmVisualizer
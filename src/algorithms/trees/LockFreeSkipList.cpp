@@ -0,0 +1,206 @@
+#include "algorithms/trees/LockFreeSkipList.h"
+#include <algorithm>
+#include <bit>
+#include <climits>
+
+namespace AlgorithmVisualizer {
+
+LockFreeSkipList::LockFreeSkipList()
+    : m_head(new Node(INT_MIN, MAX_LEVEL)), m_tail(new Node(INT_MAX, MAX_LEVEL)) {
+    for (int level = 0; level < MAX_LEVEL; ++level) {
+        m_head->next[level].store(Link(m_tail), std::memory_order_relaxed);
+        m_tail->next[level].store(0, std::memory_order_relaxed);
+    }
+}
+
+// Not thread-safe: all workers must have finished. Retired nodes belong to m_epochs.
+LockFreeSkipList::~LockFreeSkipList() {
+    Node* node = m_head;
+    while (node != m_tail) {
+        Node* next = Pointer(node->next[0].load(std::memory_order_relaxed));
+        delete node;
+        node = next;
+    }
+    delete m_tail;
+}
+
+int LockFreeSkipList::RandomLevel(int slot) {
+    // xorshift64* per slot; trailing zero bits give the geometric tower height
+    uint64_t& x = m_slotState[slot].rng;
+    if (x == 0) {
+        x = 0x9E3779B97F4A7C15ull * static_cast<uint64_t>(slot + 1);
+    }
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    uint64_t bits = x * 2685821657736338717ull;
+    return 1 + std::countr_zero(bits | (1ull << (MAX_LEVEL - 1)));
+}
+
+bool LockFreeSkipList::Find(int key, Node** preds, Node** succs) {
+    for (;;) {
+        bool interfered = false;
+        Node* pred = m_head;
+        for (int level = MAX_LEVEL - 1; level >= 0 && !interfered; --level) {
+            Node* curr = Pointer(pred->next[level].load(std::memory_order_acquire));
+            for (;;) {
+                uintptr_t succ = curr->next[level].load(std::memory_order_acquire);
+                while (IsMarked(succ)) {
+                    // curr is logically deleted: unlink it at this level
+                    uintptr_t expected = Link(curr);
+                    if (!pred->next[level].compare_exchange_strong(expected, Link(Pointer(succ)),
+                                                                  std::memory_order_acq_rel,
+                                                                  std::memory_order_acquire)) {
+                        interfered = true;
+                        break;
+                    }
+                    curr = Pointer(succ);
+                    succ = curr->next[level].load(std::memory_order_acquire);
+                }
+                if (interfered || curr->key >= key) {
+                    break;
+                }
+                pred = curr;
+                curr = Pointer(succ);
+            }
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+        if (!interfered) {
+            return succs[0]->key == key;
+        }
+    }
+}
+
+bool LockFreeSkipList::Insert(int key, int slot) {
+    if (key == INT_MIN || key == INT_MAX) {
+        return false;
+    }
+
+    EpochManager::Guard guard(m_epochs, slot);
+    Node* preds[MAX_LEVEL];
+    Node* succs[MAX_LEVEL];
+    const int height = RandomLevel(slot);
+    Node* node = nullptr;
+
+    // Linearization point: the level 0 CAS
+    for (;;) {
+        if (Find(key, preds, succs)) {
+            delete node; // Never published
+            return false;
+        }
+        if (!node) {
+            node = new Node(key, height);
+        }
+        for (int level = 0; level < height; ++level) {
+            node->next[level].store(Link(succs[level]), std::memory_order_relaxed);
+        }
+        uintptr_t expected = Link(succs[0]);
+        if (preds[0]->next[0].compare_exchange_strong(expected, Link(node), std::memory_order_acq_rel,
+                                                      std::memory_order_relaxed)) {
+            break;
+        }
+    }
+    m_size.fetch_add(1, std::memory_order_relaxed);
+
+    // Upper levels are only hints; stop as soon as a deleter has marked the node
+    bool abandoned = false;
+    for (int level = 1; level < height && !abandoned; ++level) {
+        for (;;) {
+            uintptr_t link = node->next[level].load(std::memory_order_acquire);
+            if (IsMarked(link)) {
+                abandoned = true;
+                break;
+            }
+            if (Pointer(link) != succs[level] &&
+                !node->next[level].compare_exchange_strong(link, Link(succs[level]), std::memory_order_acq_rel,
+                                                           std::memory_order_acquire)) {
+                continue;
+            }
+            uintptr_t expected = Link(succs[level]);
+            if (preds[level]->next[level].compare_exchange_strong(expected, Link(node), std::memory_order_acq_rel,
+                                                                  std::memory_order_relaxed)) {
+                break;
+            }
+            Find(key, preds, succs);
+            if (succs[0] != node) {
+                abandoned = true;
+                break;
+            }
+        }
+    }
+
+    Release(node, slot);
+    return true;
+}
+
+bool LockFreeSkipList::Erase(int key, int slot) {
+    EpochManager::Guard guard(m_epochs, slot);
+    Node* preds[MAX_LEVEL];
+    Node* succs[MAX_LEVEL];
+    if (!Find(key, preds, succs)) {
+        return false;
+    }
+
+    Node* victim = succs[0];
+    for (int level = victim->height - 1; level >= 1; --level) {
+        uintptr_t link = victim->next[level].load(std::memory_order_acquire);
+        while (!IsMarked(link)) {
+            victim->next[level].compare_exchange_weak(link, link | MARK, std::memory_order_acq_rel,
+                                                      std::memory_order_acquire);
+        }
+    }
+
+    // Linearization point: marking level 0. Losing the race means another Erase won.
+    uintptr_t link = victim->next[0].load(std::memory_order_acquire);
+    for (;;) {
+        if (IsMarked(link)) {
+            return false;
+        }
+        if (victim->next[0].compare_exchange_weak(link, link | MARK, std::memory_order_acq_rel,
+                                                  std::memory_order_acquire)) {
+            break;
+        }
+    }
+    m_size.fetch_sub(1, std::memory_order_relaxed);
+
+    Find(key, preds, succs);
+    Release(victim, slot);
+    return true;
+}
+
+bool LockFreeSkipList::Contains(int key, int slot) {
+    EpochManager::Guard guard(m_epochs, slot);
+    Node* pred = m_head;
+    Node* curr = nullptr;
+    for (int level = MAX_LEVEL - 1; level >= 0; --level) {
+        curr = Pointer(pred->next[level].load(std::memory_order_acquire));
+        for (;;) {
+            uintptr_t succ = curr->next[level].load(std::memory_order_acquire);
+            while (IsMarked(succ)) {
+                curr = Pointer(succ);
+                succ = curr->next[level].load(std::memory_order_acquire);
+            }
+            if (curr->key >= key) {
+                break;
+            }
+            pred = curr;
+            curr = Pointer(succ);
+        }
+    }
+    return curr->key == key;
+}
+
+// The inserter may still be linking upper levels when the deleter finishes (and
+// could re-link the node after the deleter's cleanup Find), so whichever side
+// finishes last runs one more Find to unlink every level before retiring
+void LockFreeSkipList::Release(Node* node, int slot) {
+    if (node->handoff.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        Node* preds[MAX_LEVEL];
+        Node* succs[MAX_LEVEL];
+        Find(node->key, preds, succs);
+        m_epochs.Retire(slot, node, &DeleteNode);
+    }
+}
+
+} // namespace AlgorithmVisualizer
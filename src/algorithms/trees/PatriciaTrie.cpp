@@ -0,0 +1,452 @@
+#include "algorithms/trees/PatriciaTrie.h"
+#include <algorithm>
+#include <cstring>
+
+namespace AlgorithmVisualizer {
+
+namespace {
+// Calls f on each child in byte order until it returns false
+template <typename F>
+bool VisitChildren(const PatriciaTrie::Node* node, F&& f) {
+    if (node->layout == PatriciaTrie::ChildLayout::SortedArray) {
+        for (const PatriciaTrie::Node* child : static_cast<const PatriciaTrie::ArrayNode*>(node)->children) {
+            if (!f(child)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (node->childCount == 0) {
+        return true;
+    }
+    for (const PatriciaTrie::Node* child : static_cast<const PatriciaTrie::TableNode*>(node)->children) {
+        if (child && !f(child)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool EdgeMatches(std::string_view key, size_t depth, const std::string& edge) {
+    return key.size() - depth >= edge.size() && std::memcmp(key.data() + depth, edge.data(), edge.size()) == 0;
+}
+}
+
+PatriciaTrie::PatriciaTrie(ChildLayout layout) : m_layout(layout) {
+    m_root = NewNode({});
+}
+
+PatriciaTrie::~PatriciaTrie() {
+    FreeSubtree(m_root);
+}
+
+void PatriciaTrie::Clear() {
+    FreeSubtree(m_root);
+    m_size = 0;
+    m_nodeCount = 0;
+    m_root = NewNode({});
+}
+
+PatriciaTrie::Node* PatriciaTrie::NewNode(std::string_view edge) {
+    Node* node = nullptr;
+    if (m_layout == ChildLayout::SortedArray) {
+        node = new ArrayNode();
+    } else {
+        node = new TableNode();
+    }
+    node->edge = edge;
+    m_nodeCount++;
+    return node;
+}
+
+void PatriciaTrie::DeleteNode(Node* node) {
+    if (node->layout == ChildLayout::SortedArray) {
+        delete static_cast<ArrayNode*>(node);
+    } else {
+        delete static_cast<TableNode*>(node);
+    }
+    m_nodeCount--;
+}
+
+void PatriciaTrie::FreeSubtree(Node* node) {
+    std::vector<Node*> stack = { node };
+    while (!stack.empty()) {
+        Node* current = stack.back();
+        stack.pop_back();
+        VisitChildren(current, [&](const Node* child) {
+            stack.push_back(const_cast<Node*>(child));
+            return true;
+        });
+        DeleteNode(current);
+    }
+}
+
+PatriciaTrie::Node** PatriciaTrie::FindChild(Node* node, uint8_t byte) {
+    if (node->layout == ChildLayout::Table256) {
+        Node** slot = &static_cast<TableNode*>(node)->children[byte];
+        return *slot ? slot : nullptr;
+    }
+    auto* array = static_cast<ArrayNode*>(node);
+    const void* match = std::memchr(array->bytes.data(), byte, array->bytes.size());
+    if (!match) {
+        return nullptr;
+    }
+    return &array->children[static_cast<const char*>(match) - array->bytes.data()];
+}
+
+const PatriciaTrie::Node* PatriciaTrie::FindChild(const Node* node, uint8_t byte) {
+    Node** slot = FindChild(const_cast<Node*>(node), byte);
+    return slot ? *slot : nullptr;
+}
+
+void PatriciaTrie::AddChild(Node* node, Node* child) {
+    const auto byte = static_cast<uint8_t>(child->edge[0]);
+    if (node->layout == ChildLayout::Table256) {
+        static_cast<TableNode*>(node)->children[byte] = child;
+    } else {
+        auto* array = static_cast<ArrayNode*>(node);
+        const auto position = std::lower_bound(array->bytes.begin(), array->bytes.end(), byte,
+                                               [](char a, uint8_t b) { return static_cast<uint8_t>(a) < b; }) -
+                              array->bytes.begin();
+        array->bytes.insert(array->bytes.begin() + position, static_cast<char>(byte));
+        array->children.insert(array->children.begin() + position, child);
+    }
+    node->childCount++;
+}
+
+void PatriciaTrie::RemoveChild(Node* node, uint8_t byte) {
+    if (node->layout == ChildLayout::Table256) {
+        static_cast<TableNode*>(node)->children[byte] = nullptr;
+    } else {
+        auto* array = static_cast<ArrayNode*>(node);
+        const auto position = array->bytes.find(static_cast<char>(byte));
+        array->bytes.erase(array->bytes.begin() + position);
+        array->children.erase(array->children.begin() + position);
+    }
+    node->childCount--;
+}
+
+PatriciaTrie::Node* PatriciaTrie::OnlyChild(Node* node) {
+    Node* only = nullptr;
+    VisitChildren(node, [&](const Node* child) {
+        only = const_cast<Node*>(child);
+        return false;
+    });
+    return only;
+}
+
+bool PatriciaTrie::Insert(std::string_view key) {
+    Node* node = m_root;
+    size_t depth = 0;
+    while (depth < key.size()) {
+        Node** slot = FindChild(node, static_cast<uint8_t>(key[depth]));
+        if (!slot) {
+            Node* leaf = NewNode(key.substr(depth));
+            leaf->terminal = true;
+            AddChild(node, leaf);
+            m_size++;
+            EmitStep("Added leaf edge \"{}\"", leaf->edge);
+            return true;
+        }
+
+        Node* child = *slot;
+        const std::string& edge = child->edge;
+        const size_t limit = std::min(edge.size(), key.size() - depth);
+        size_t common = 0;
+        while (common < limit && edge[common] == key[depth + common]) {
+            common++;
+        }
+        if (common == edge.size()) {
+            node = child;
+            depth += common;
+            continue;
+        }
+
+        // The key leaves the edge part-way: a new node takes the shared part and
+        // the old child keeps the rest of its label
+        Node* middle = NewNode(std::string_view(edge).substr(0, common));
+        EmitStep("Split edge \"{}\" after {} byte(s)", edge, common);
+        child->edge.erase(0, common);
+        AddChild(middle, child);
+        *slot = middle;
+        m_stats.edgeSplits++;
+        if (depth + common == key.size()) {
+            middle->terminal = true;
+        } else {
+            Node* leaf = NewNode(key.substr(depth + common));
+            leaf->terminal = true;
+            AddChild(middle, leaf);
+            EmitStep("Added leaf edge \"{}\"", leaf->edge);
+        }
+        m_size++;
+        return true;
+    }
+
+    if (node->terminal) {
+        return false;
+    }
+    node->terminal = true;
+    m_size++;
+    EmitStep("Marked existing node as a key");
+    return true;
+}
+
+bool PatriciaTrie::Erase(std::string_view key) {
+    std::vector<Node*> path = { m_root };
+    size_t depth = 0;
+    while (depth < key.size()) {
+        Node** slot = FindChild(path.back(), static_cast<uint8_t>(key[depth]));
+        if (!slot || !EdgeMatches(key, depth, (*slot)->edge)) {
+            return false;
+        }
+        depth += (*slot)->edge.size();
+        path.push_back(*slot);
+    }
+
+    Node* node = path.back();
+    if (!node->terminal) {
+        return false;
+    }
+    node->terminal = false;
+    m_size--;
+    if (node == m_root) {
+        return true;
+    }
+
+    if (node->childCount == 0) {
+        path.pop_back();
+        RemoveChild(path.back(), static_cast<uint8_t>(node->edge[0]));
+        EmitStep("Removed leaf edge \"{}\"", node->edge);
+        DeleteNode(node);
+        node = path.back();
+    }
+    // A non-key node with a single child is folded into that child, keeping the trie compressed
+    if (node != m_root && !node->terminal && node->childCount == 1) {
+        Node* child = OnlyChild(node);
+        child->edge.insert(0, node->edge);
+        path.pop_back();
+        *FindChild(path.back(), static_cast<uint8_t>(child->edge[0])) = child;
+        EmitStep("Merged into edge \"{}\"", child->edge);
+        DeleteNode(node);
+        m_stats.merges++;
+    }
+    return true;
+}
+
+bool PatriciaTrie::Contains(std::string_view key) const {
+    const Node* node = m_root;
+    size_t depth = 0;
+    uint64_t visited = 1;
+    while (depth < key.size()) {
+        node = FindChild(node, static_cast<uint8_t>(key[depth]));
+        if (!node) {
+            break;
+        }
+        visited++;
+        if (!EdgeMatches(key, depth, node->edge)) {
+            node = nullptr;
+            break;
+        }
+        depth += node->edge.size();
+    }
+    m_stats.nodesVisited += visited;
+    return node && node->terminal;
+}
+
+std::vector<const PatriciaTrie::Node*> PatriciaTrie::SearchPath(std::string_view key) const {
+    std::vector<const Node*> path = { m_root };
+    size_t depth = 0;
+    while (depth < key.size()) {
+        const Node* child = FindChild(path.back(), static_cast<uint8_t>(key[depth]));
+        if (!child) {
+            break;
+        }
+        path.push_back(child);
+        if (!EdgeMatches(key, depth, child->edge)) {
+            break;
+        }
+        depth += child->edge.size();
+    }
+    return path;
+}
+
+std::pair<const PatriciaTrie::Node*, size_t> PatriciaTrie::FindPrefixNode(std::string_view prefix) const {
+    const Node* node = m_root;
+    size_t depth = 0;
+    while (depth < prefix.size()) {
+        const Node* child = FindChild(node, static_cast<uint8_t>(prefix[depth]));
+        if (!child) {
+            return { nullptr, 0 };
+        }
+        // The prefix may end inside the edge; then the whole child subtree matches
+        const size_t length = std::min(child->edge.size(), prefix.size() - depth);
+        if (std::memcmp(child->edge.data(), prefix.data() + depth, length) != 0) {
+            return { nullptr, 0 };
+        }
+        if (depth + length == prefix.size()) {
+            return { child, depth };
+        }
+        node = child;
+        depth += length;
+    }
+    return { node, depth - node->edge.size() };
+}
+
+template <typename Visit>
+bool PatriciaTrie::Walk(const Node* node, std::string& key, Visit& visit) {
+    const size_t base = key.size();
+    key += node->edge;
+    bool going = !node->terminal || visit(std::string_view(key));
+    if (going) {
+        going = VisitChildren(node, [&](const Node* child) { return Walk(child, key, visit); });
+    }
+    key.resize(base);
+    return going;
+}
+
+// Every key below a node starts with the node's path, so comparing that path with
+// the same-length prefixes of the bounds prunes whole subtrees on either side
+template <typename Visit>
+bool PatriciaTrie::WalkRange(const Node* node, std::string& key, std::string_view low, std::string_view high,
+                             Visit& visit) {
+    const size_t base = key.size();
+    key += node->edge;
+    const std::string_view path(key);
+    bool going = true;
+    if (path > high.substr(0, path.size())) {
+        going = false;
+    } else if (path >= low.substr(0, path.size())) {
+        if (node->terminal && path >= low) {
+            going = visit(path);
+        }
+        if (going) {
+            going = VisitChildren(node, [&](const Node* child) { return WalkRange(child, key, low, high, visit); });
+        }
+    }
+    key.resize(base);
+    return going;
+}
+
+std::vector<std::string> PatriciaTrie::PrefixKeys(std::string_view prefix, size_t limit) const {
+    std::vector<std::string> keys;
+    const auto [node, depth] = FindPrefixNode(prefix);
+    if (!node || limit == 0) {
+        return keys;
+    }
+    std::string key(prefix.substr(0, depth));
+    auto collect = [&](std::string_view found) {
+        keys.emplace_back(found);
+        return keys.size() < limit;
+    };
+    Walk(node, key, collect);
+    return keys;
+}
+
+std::vector<std::string> PatriciaTrie::RangeKeys(std::string_view low, std::string_view high, size_t limit) const {
+    std::vector<std::string> keys;
+    if (low > high || limit == 0) {
+        return keys;
+    }
+    std::string key;
+    auto collect = [&](std::string_view found) {
+        keys.emplace_back(found);
+        return keys.size() < limit;
+    };
+    WalkRange(m_root, key, low, high, collect);
+    return keys;
+}
+
+void PatriciaTrie::ForEach(const KeyVisitor& visit) const {
+    std::string key;
+    auto each = [&](std::string_view found) {
+        visit(found);
+        return true;
+    };
+    Walk(m_root, key, each);
+}
+
+void PatriciaTrie::ForEachWithPrefix(std::string_view prefix, const KeyVisitor& visit) const {
+    const auto [node, depth] = FindPrefixNode(prefix);
+    if (!node) {
+        return;
+    }
+    std::string key(prefix.substr(0, depth));
+    auto each = [&](std::string_view found) {
+        visit(found);
+        return true;
+    };
+    Walk(node, key, each);
+}
+
+size_t PatriciaTrie::LoadWords(std::istream& input) {
+    size_t added = 0;
+    std::string line;
+    while (std::getline(input, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (!line.empty() && Insert(line)) {
+            added++;
+        }
+    }
+    return added;
+}
+
+int PatriciaTrie::Height() const {
+    int height = 0;
+    std::vector<std::pair<const Node*, int>> stack = { { m_root, 0 } };
+    while (!stack.empty()) {
+        const auto [node, depth] = stack.back();
+        stack.pop_back();
+        height = std::max(height, depth);
+        VisitChildren(node, [&](const Node* child) {
+            stack.push_back({ child, depth + 1 });
+            return true;
+        });
+    }
+    return height;
+}
+
+size_t PatriciaTrie::MemoryBytes() const {
+    const size_t inlineCapacity = std::string().capacity();
+    size_t bytes = 0;
+    std::vector<const Node*> stack = { m_root };
+    while (!stack.empty()) {
+        const Node* node = stack.back();
+        stack.pop_back();
+        if (node->layout == ChildLayout::SortedArray) {
+            const auto* array = static_cast<const ArrayNode*>(node);
+            bytes += sizeof(ArrayNode) + array->children.capacity() * sizeof(Node*);
+            if (array->bytes.capacity() > inlineCapacity) {
+                bytes += array->bytes.capacity() + 1;
+            }
+        } else {
+            bytes += sizeof(TableNode);
+        }
+        if (node->edge.capacity() > inlineCapacity) {
+            bytes += node->edge.capacity() + 1;
+        }
+        VisitChildren(node, [&](const Node* child) {
+            stack.push_back(child);
+            return true;
+        });
+    }
+    return bytes;
+}
+
+void PatriciaTrie::ForEachChild(const Node* node, const std::function<void(uint8_t, const Node*)>& visit) {
+    VisitChildren(node, [&](const Node* child) {
+        visit(static_cast<uint8_t>(child->edge[0]), child);
+        return true;
+    });
+}
+
+const char* PatriciaTrie::LayoutName(ChildLayout layout) {
+    switch (layout) {
+    case ChildLayout::SortedArray: return "Sorted arrays";
+    case ChildLayout::Table256: return "256-way tables";
+    }
+    return "Unknown";
+}
+
+} // namespace AlgorithmVisualizer
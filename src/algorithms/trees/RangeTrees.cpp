@@ -0,0 +1,254 @@
+#include "algorithms/trees/RangeTrees.h"
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <limits>
+
+namespace AlgorithmVisualizer {
+
+namespace {
+constexpr int64_t NO_MIN = std::numeric_limits<int64_t>::max(); // Padding leaves never win a min
+}
+
+// Fenwick tree
+FenwickTree::FenwickTree(const std::vector<int64_t>& values) {
+    Assign(values);
+}
+
+// Lays out the difference array, then folds every node into its parent once (linear build)
+void FenwickTree::Assign(const std::vector<int64_t>& values) {
+    m_size = static_cast<int>(values.size());
+    m_diff.assign(m_size + 1, 0);
+    m_weightedDiff.assign(m_size + 1, 0);
+
+    int64_t previous = 0;
+    for (int i = 1; i <= m_size; ++i) {
+        const int64_t diff = values[i - 1] - previous;
+        previous = values[i - 1];
+        m_diff[i] = diff;
+        m_weightedDiff[i] = diff * (i - 1);
+    }
+    for (int i = 1; i <= m_size; ++i) {
+        const int parent = i + (i & -i);
+        if (parent <= m_size) {
+            m_diff[parent] += m_diff[i];
+            m_weightedDiff[parent] += m_weightedDiff[i];
+        }
+    }
+}
+
+void FenwickTree::Update(int index, int64_t delta) {
+    const int64_t weighted = delta * (index - 1);
+    for (; index <= m_size; index += index & -index) {
+        m_diff[index] += delta;
+        m_weightedDiff[index] += weighted;
+        m_stats.nodesTouched++;
+    }
+}
+
+int64_t FenwickTree::Prefix(int count) const {
+    int64_t diffSum = 0;
+    int64_t weightedSum = 0;
+    for (int index = count; index > 0; index -= index & -index) {
+        diffSum += m_diff[index];
+        weightedSum += m_weightedDiff[index];
+        m_stats.nodesTouched++;
+    }
+    return diffSum * count - weightedSum;
+}
+
+void FenwickTree::RangeAdd(int left, int right, int64_t delta) {
+    Update(left + 1, delta);
+    Update(right + 2, -delta);
+}
+
+int64_t FenwickTree::RangeSum(int left, int right) const {
+    return Prefix(right + 1) - Prefix(left);
+}
+
+std::vector<int64_t> FenwickTree::SumBatch(const std::vector<RangeQuery>& queries) const {
+    std::vector<int64_t> results;
+    results.reserve(queries.size());
+    for (const RangeQuery& query : queries) {
+        results.push_back(Prefix(query.right + 1) - Prefix(query.left));
+    }
+    return results;
+}
+
+FenwickTree::Trace FenwickTree::TraceSum(int left, int right) const {
+    Trace trace;
+    for (int index = right + 1; index > 0; index -= index & -index) {
+        trace.added.push_back(index);
+    }
+    for (int index = left; index > 0; index -= index & -index) {
+        trace.subtracted.push_back(index);
+    }
+    return trace;
+}
+
+// Segment tree
+SegmentTree::SegmentTree(const std::vector<int64_t>& values) {
+    Assign(values);
+}
+
+void SegmentTree::Assign(const std::vector<int64_t>& values) {
+    m_size = static_cast<int>(values.size());
+    m_leaves = static_cast<int>(std::bit_ceil(static_cast<unsigned int>(std::max(m_size, 1))));
+    m_height = std::countr_zero(static_cast<unsigned int>(m_leaves));
+    m_sum.assign(2 * m_leaves, 0);
+    m_min.assign(2 * m_leaves, NO_MIN);
+    m_lazy.assign(2 * m_leaves, 0);
+
+    for (int i = 0; i < m_size; ++i) {
+        m_sum[m_leaves + i] = values[i];
+        m_min[m_leaves + i] = values[i];
+    }
+    for (int node = m_leaves - 1; node > 0; --node) {
+        m_sum[node] = m_sum[2 * node] + m_sum[2 * node + 1];
+        m_min[node] = std::min(m_min[2 * node], m_min[2 * node + 1]);
+    }
+}
+
+int64_t SegmentTree::NodeLength(int node) const {
+    return m_leaves >> (std::bit_width(static_cast<unsigned int>(node)) - 1);
+}
+
+// A node only receives an add when it lies inside [0, Size()), so padding stays untouched
+void SegmentTree::Apply(int node, int64_t delta) {
+    m_sum[node] += delta * NodeLength(node);
+    m_min[node] += delta;
+    if (node < m_leaves) {
+        m_lazy[node] += delta;
+    }
+}
+
+void SegmentTree::Pull(int node) {
+    while (node > 1) {
+        node >>= 1;
+        m_sum[node] = m_sum[2 * node] + m_sum[2 * node + 1] + m_lazy[node] * NodeLength(node);
+        m_min[node] = std::min(m_min[2 * node], m_min[2 * node + 1]) + m_lazy[node];
+    }
+}
+
+void SegmentTree::PushPath(int node) {
+    for (int shift = m_height; shift > 0; --shift) {
+        const int ancestor = node >> shift;
+        if (m_lazy[ancestor] != 0) {
+            Apply(2 * ancestor, m_lazy[ancestor]);
+            Apply(2 * ancestor + 1, m_lazy[ancestor]);
+            m_lazy[ancestor] = 0;
+            m_stats.pushes++;
+        }
+    }
+}
+
+// Parents come before their children in heap order, so one forward sweep clears every tag
+void SegmentTree::PushAll() {
+    for (int node = 1; node < m_leaves; ++node) {
+        if (m_lazy[node] != 0) {
+            Apply(2 * node, m_lazy[node]);
+            Apply(2 * node + 1, m_lazy[node]);
+            m_lazy[node] = 0;
+            m_stats.pushes++;
+        }
+    }
+}
+
+void SegmentTree::RangeAdd(int left, int right, int64_t delta) {
+    int low = left + m_leaves;
+    int high = right + m_leaves + 1;
+    const int first = low;
+    const int last = high - 1;
+    for (; low < high; low >>= 1, high >>= 1) {
+        if (low & 1) {
+            Apply(low++, delta);
+            m_stats.nodesTouched++;
+        }
+        if (high & 1) {
+            Apply(--high, delta);
+            m_stats.nodesTouched++;
+        }
+    }
+    Pull(first);
+    Pull(last);
+}
+
+template <typename Combine>
+int64_t SegmentTree::Query(int left, int right, const std::vector<int64_t>& values, int64_t identity,
+                           Combine combine, bool push) {
+    int low = left + m_leaves;
+    int high = right + m_leaves + 1;
+    if (push) {
+        PushPath(low);
+        PushPath(high - 1);
+    }
+
+    int64_t result = identity;
+    uint64_t touched = 0;
+    for (; low < high; low >>= 1, high >>= 1) {
+        if (low & 1) {
+            result = combine(result, values[low++]);
+            touched++;
+        }
+        if (high & 1) {
+            result = combine(result, values[--high]);
+            touched++;
+        }
+    }
+    m_stats.nodesTouched += touched;
+    return result;
+}
+
+int64_t SegmentTree::RangeSum(int left, int right) {
+    return Query(left, right, m_sum, 0, std::plus<int64_t>(), true);
+}
+
+int64_t SegmentTree::RangeMin(int left, int right) {
+    return Query(left, right, m_min, NO_MIN, [](int64_t a, int64_t b) { return std::min(a, b); }, true);
+}
+
+std::vector<int64_t> SegmentTree::SumBatch(const std::vector<RangeQuery>& queries) {
+    PushAll();
+    std::vector<int64_t> results;
+    results.reserve(queries.size());
+    for (const RangeQuery& query : queries) {
+        results.push_back(Query(query.left, query.right, m_sum, 0, std::plus<int64_t>(), false));
+    }
+    return results;
+}
+
+std::vector<int64_t> SegmentTree::MinBatch(const std::vector<RangeQuery>& queries) {
+    PushAll();
+    std::vector<int64_t> results;
+    results.reserve(queries.size());
+    auto minimum = [](int64_t a, int64_t b) { return std::min(a, b); };
+    for (const RangeQuery& query : queries) {
+        results.push_back(Query(query.left, query.right, m_min, NO_MIN, minimum, false));
+    }
+    return results;
+}
+
+SegmentTree::Trace SegmentTree::TraceQuery(int left, int right) const {
+    Trace trace;
+    int low = left + m_leaves;
+    int high = right + m_leaves + 1;
+    for (int shift = m_height; shift > 0; --shift) {
+        for (int ancestor : { low >> shift, (high - 1) >> shift }) {
+            if (m_lazy[ancestor] != 0 &&
+                std::find(trace.pushed.begin(), trace.pushed.end(), ancestor) == trace.pushed.end()) {
+                trace.pushed.push_back(ancestor);
+            }
+        }
+    }
+    for (; low < high; low >>= 1, high >>= 1) {
+        if (low & 1) {
+            trace.cover.push_back(low++);
+        }
+        if (high & 1) {
+            trace.cover.push_back(--high);
+        }
+    }
+    return trace;
+}
+
+} // namespace AlgorithmVisualizer
@@ -0,0 +1,687 @@
+#include "algorithms/trees/SearchTrees.h"
+#include <algorithm>
+#include <vector>
+
+namespace AlgorithmVisualizer {
+
+namespace {
+
+// In-order walk with an explicit stack, for the unique_ptr-linked trees
+template <typename Node>
+std::vector<int> InorderKeys(const Node* root, size_t size) {
+    std::vector<int> keys;
+    keys.reserve(size);
+    std::vector<const Node*> stack;
+    const Node* node = root;
+    while (node || !stack.empty()) {
+        while (node) {
+            stack.push_back(node);
+            node = node->left.get();
+        }
+        node = stack.back();
+        stack.pop_back();
+        keys.push_back(node->key);
+        node = node->right.get();
+    }
+    return keys;
+}
+
+template <typename Node>
+size_t SizeOf(const Node* node) {
+    return node ? node->size : 0;
+}
+
+// Descends by subtree sizes: the left subtree holds exactly the keys ranked below the node
+template <typename Node>
+std::optional<int> SelectKey(const Node* node, size_t rank, uint64_t& comparisons) {
+    while (node) {
+        comparisons++;
+        const size_t leftSize = SizeOf(node->left.get());
+        if (rank < leftSize) {
+            node = node->left.get();
+        } else if (rank == leftSize) {
+            return node->key;
+        } else {
+            rank -= leftSize + 1;
+            node = node->right.get();
+        }
+    }
+    return std::nullopt;
+}
+
+// Keys below key (or at most key when inclusive)
+template <typename Node>
+size_t CountBelow(const Node* node, int key, bool inclusive, uint64_t& comparisons) {
+    size_t count = 0;
+    while (node) {
+        comparisons++;
+        if (node->key < key || (inclusive && node->key == key)) {
+            count += SizeOf(node->left.get()) + 1;
+            node = node->right.get();
+        } else {
+            node = node->left.get();
+        }
+    }
+    return count;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// AVL tree
+// ---------------------------------------------------------------------------
+
+bool AVLTree::Insert(int key) {
+    bool inserted = false;
+    m_root = InsertAt(std::move(m_root), key, inserted);
+    if (inserted) {
+        m_size++;
+    }
+    return inserted;
+}
+
+bool AVLTree::Erase(int key) {
+    bool erased = false;
+    m_root = EraseAt(std::move(m_root), key, erased);
+    if (erased) {
+        m_size--;
+    }
+    return erased;
+}
+
+bool AVLTree::Contains(int key) const {
+    const Node* node = m_root.get();
+    while (node) {
+        m_stats.comparisons++;
+        if (key == node->key) {
+            return true;
+        }
+        node = key < node->key ? node->left.get() : node->right.get();
+    }
+    return false;
+}
+
+std::vector<int> AVLTree::Keys() const {
+    return InorderKeys(m_root.get(), m_size);
+}
+
+std::optional<int> AVLTree::Select(size_t rank) const {
+    return SelectKey(m_root.get(), rank, m_stats.comparisons);
+}
+
+size_t AVLTree::Rank(int key) const {
+    return CountBelow(m_root.get(), key, false, m_stats.comparisons);
+}
+
+size_t AVLTree::CountRange(int low, int high) const {
+    if (low > high) {
+        return 0;
+    }
+    return CountBelow(m_root.get(), high, true, m_stats.comparisons) -
+           CountBelow(m_root.get(), low, false, m_stats.comparisons);
+}
+
+void AVLTree::Clear() {
+    m_root.reset();
+    m_size = 0;
+}
+
+int AVLTree::Height() const {
+    return HeightOf(m_root.get());
+}
+
+void AVLTree::UpdateHeight(Node* node) {
+    node->height = 1 + std::max(HeightOf(node->left.get()), HeightOf(node->right.get()));
+    node->size = 1 + SizeOf(node->left.get()) + SizeOf(node->right.get());
+}
+
+AVLTree::NodePtr AVLTree::RotateLeft(NodePtr node) {
+    m_stats.rotations++;
+    NodePtr pivot = std::move(node->right);
+    node->right = std::move(pivot->left);
+    UpdateHeight(node.get());
+    pivot->left = std::move(node);
+    UpdateHeight(pivot.get());
+    return pivot;
+}
+
+AVLTree::NodePtr AVLTree::RotateRight(NodePtr node) {
+    m_stats.rotations++;
+    NodePtr pivot = std::move(node->left);
+    node->left = std::move(pivot->right);
+    UpdateHeight(node.get());
+    pivot->right = std::move(node);
+    UpdateHeight(pivot.get());
+    return pivot;
+}
+
+AVLTree::NodePtr AVLTree::Rebalance(NodePtr node) {
+    UpdateHeight(node.get());
+    int balance = HeightOf(node->left.get()) - HeightOf(node->right.get());
+
+    if (balance > 1) {
+        if (HeightOf(node->left->left.get()) < HeightOf(node->left->right.get())) {
+            node->left = RotateLeft(std::move(node->left));
+        }
+        return RotateRight(std::move(node));
+    }
+    if (balance < -1) {
+        if (HeightOf(node->right->right.get()) < HeightOf(node->right->left.get())) {
+            node->right = RotateRight(std::move(node->right));
+        }
+        return RotateLeft(std::move(node));
+    }
+    return node;
+}
+
+AVLTree::NodePtr AVLTree::InsertAt(NodePtr node, int key, bool& inserted) {
+    if (!node) {
+        inserted = true;
+        return std::make_unique<Node>(key);
+    }
+
+    m_stats.comparisons++;
+    if (key < node->key) {
+        node->left = InsertAt(std::move(node->left), key, inserted);
+    } else if (key > node->key) {
+        node->right = InsertAt(std::move(node->right), key, inserted);
+    } else {
+        return node;
+    }
+    return inserted ? Rebalance(std::move(node)) : std::move(node);
+}
+
+AVLTree::NodePtr AVLTree::EraseAt(NodePtr node, int key, bool& erased) {
+    if (!node) {
+        return node;
+    }
+
+    m_stats.comparisons++;
+    if (key < node->key) {
+        node->left = EraseAt(std::move(node->left), key, erased);
+    } else if (key > node->key) {
+        node->right = EraseAt(std::move(node->right), key, erased);
+    } else {
+        erased = true;
+        if (!node->left) {
+            return std::move(node->right);
+        }
+        if (!node->right) {
+            return std::move(node->left);
+        }
+        const Node* successor = node->right.get();
+        while (successor->left) {
+            successor = successor->left.get();
+        }
+        node->key = successor->key;
+        bool removedSuccessor = false;
+        node->right = EraseAt(std::move(node->right), node->key, removedSuccessor);
+    }
+    return erased ? Rebalance(std::move(node)) : std::move(node);
+}
+
+// ---------------------------------------------------------------------------
+// Left-leaning red-black tree
+// ---------------------------------------------------------------------------
+
+bool RedBlackTree::Insert(int key) {
+    bool inserted = false;
+    m_root = InsertAt(std::move(m_root), key, inserted);
+    m_root->red = false;
+    if (inserted) {
+        m_size++;
+    }
+    return inserted;
+}
+
+bool RedBlackTree::Erase(int key) {
+    if (!Contains(key)) {
+        return false;
+    }
+
+    if (!IsRed(m_root->left.get()) && !IsRed(m_root->right.get())) {
+        m_root->red = true;
+    }
+    m_root = EraseAt(std::move(m_root), key);
+    if (m_root) {
+        m_root->red = false;
+    }
+    m_size--;
+    return true;
+}
+
+bool RedBlackTree::Contains(int key) const {
+    const Node* node = m_root.get();
+    while (node) {
+        m_stats.comparisons++;
+        if (key == node->key) {
+            return true;
+        }
+        node = key < node->key ? node->left.get() : node->right.get();
+    }
+    return false;
+}
+
+std::vector<int> RedBlackTree::Keys() const {
+    return InorderKeys(m_root.get(), m_size);
+}
+
+std::optional<int> RedBlackTree::Select(size_t rank) const {
+    return SelectKey(m_root.get(), rank, m_stats.comparisons);
+}
+
+size_t RedBlackTree::Rank(int key) const {
+    return CountBelow(m_root.get(), key, false, m_stats.comparisons);
+}
+
+size_t RedBlackTree::CountRange(int low, int high) const {
+    if (low > high) {
+        return 0;
+    }
+    return CountBelow(m_root.get(), high, true, m_stats.comparisons) -
+           CountBelow(m_root.get(), low, false, m_stats.comparisons);
+}
+
+void RedBlackTree::Clear() {
+    m_root.reset();
+    m_size = 0;
+}
+
+int RedBlackTree::Height() const {
+    return HeightOf(m_root.get());
+}
+
+int RedBlackTree::HeightOf(const Node* node) {
+    return node ? 1 + std::max(HeightOf(node->left.get()), HeightOf(node->right.get())) : 0;
+}
+
+void RedBlackTree::UpdateSize(Node* node) {
+    node->size = 1 + SizeOf(node->left.get()) + SizeOf(node->right.get());
+}
+
+void RedBlackTree::FlipColors(Node* node) {
+    node->red = !node->red;
+    node->left->red = !node->left->red;
+    node->right->red = !node->right->red;
+}
+
+RedBlackTree::NodePtr RedBlackTree::RotateLeft(NodePtr node) {
+    m_stats.rotations++;
+    NodePtr pivot = std::move(node->right);
+    node->right = std::move(pivot->left);
+    pivot->red = node->red;
+    node->red = true;
+    UpdateSize(node.get());
+    pivot->left = std::move(node);
+    UpdateSize(pivot.get());
+    return pivot;
+}
+
+RedBlackTree::NodePtr RedBlackTree::RotateRight(NodePtr node) {
+    m_stats.rotations++;
+    NodePtr pivot = std::move(node->left);
+    node->left = std::move(pivot->right);
+    pivot->red = node->red;
+    node->red = true;
+    UpdateSize(node.get());
+    pivot->right = std::move(node);
+    UpdateSize(pivot.get());
+    return pivot;
+}
+
+RedBlackTree::NodePtr RedBlackTree::Balance(NodePtr node) {
+    if (IsRed(node->right.get()) && !IsRed(node->left.get())) {
+        node = RotateLeft(std::move(node));
+    }
+    if (IsRed(node->left.get()) && IsRed(node->left->left.get())) {
+        node = RotateRight(std::move(node));
+    }
+    if (IsRed(node->left.get()) && IsRed(node->right.get())) {
+        FlipColors(node.get());
+    }
+    UpdateSize(node.get());
+    return node;
+}
+
+RedBlackTree::NodePtr RedBlackTree::MoveRedLeft(NodePtr node) {
+    FlipColors(node.get());
+    if (IsRed(node->right->left.get())) {
+        node->right = RotateRight(std::move(node->right));
+        node = RotateLeft(std::move(node));
+        FlipColors(node.get());
+    }
+    return node;
+}
+
+RedBlackTree::NodePtr RedBlackTree::MoveRedRight(NodePtr node) {
+    FlipColors(node.get());
+    if (IsRed(node->left->left.get())) {
+        node = RotateRight(std::move(node));
+        FlipColors(node.get());
+    }
+    return node;
+}
+
+RedBlackTree::NodePtr RedBlackTree::InsertAt(NodePtr node, int key, bool& inserted) {
+    if (!node) {
+        inserted = true;
+        return std::make_unique<Node>(key);
+    }
+
+    m_stats.comparisons++;
+    if (key < node->key) {
+        node->left = InsertAt(std::move(node->left), key, inserted);
+    } else if (key > node->key) {
+        node->right = InsertAt(std::move(node->right), key, inserted);
+    }
+    return Balance(std::move(node));
+}
+
+RedBlackTree::NodePtr RedBlackTree::EraseMin(NodePtr node) {
+    if (!node->left) {
+        return nullptr;
+    }
+    if (!IsRed(node->left.get()) && !IsRed(node->left->left.get())) {
+        node = MoveRedLeft(std::move(node));
+    }
+    node->left = EraseMin(std::move(node->left));
+    return Balance(std::move(node));
+}
+
+// Assumes the key is present (checked by Erase)
+RedBlackTree::NodePtr RedBlackTree::EraseAt(NodePtr node, int key) {
+    m_stats.comparisons++;
+    if (key < node->key) {
+        if (!IsRed(node->left.get()) && !IsRed(node->left->left.get())) {
+            node = MoveRedLeft(std::move(node));
+        }
+        node->left = EraseAt(std::move(node->left), key);
+    } else {
+        if (IsRed(node->left.get())) {
+            node = RotateRight(std::move(node));
+        }
+        if (key == node->key && !node->right) {
+            return nullptr;
+        }
+        if (!IsRed(node->right.get()) && !IsRed(node->right->left.get())) {
+            node = MoveRedRight(std::move(node));
+        }
+        if (key == node->key) {
+            const Node* successor = node->right.get();
+            while (successor->left) {
+                successor = successor->left.get();
+            }
+            node->key = successor->key;
+            node->right = EraseMin(std::move(node->right));
+        } else {
+            node->right = EraseAt(std::move(node->right), key);
+        }
+    }
+    return Balance(std::move(node));
+}
+
+// ---------------------------------------------------------------------------
+// Splay tree
+// ---------------------------------------------------------------------------
+
+SplayTree::~SplayTree() {
+    Clear();
+}
+
+// Top-down splay: walks down from the root, hanging the nodes passed on the
+// left/right assembly trees and rotating on zig-zig steps
+SplayTree::Node* SplayTree::Splay(Node* root, int key) {
+    if (!root) {
+        return nullptr;
+    }
+
+    Node header;
+    Node* leftMax = &header;
+    Node* rightMin = &header;
+    Node* node = root;
+
+    for (;;) {
+        m_stats.comparisons++;
+        if (key < node->key) {
+            if (!node->left) {
+                break;
+            }
+            m_stats.comparisons++;
+            if (key < node->left->key) {
+                Node* pivot = node->left;
+                node->left = pivot->right;
+                pivot->right = node;
+                node = pivot;
+                m_stats.rotations++;
+                if (!node->left) {
+                    break;
+                }
+            }
+            rightMin->left = node;
+            rightMin = node;
+            node = node->left;
+        } else if (key > node->key) {
+            if (!node->right) {
+                break;
+            }
+            m_stats.comparisons++;
+            if (key > node->right->key) {
+                Node* pivot = node->right;
+                node->right = pivot->left;
+                pivot->left = node;
+                node = pivot;
+                m_stats.rotations++;
+                if (!node->right) {
+                    break;
+                }
+            }
+            leftMax->right = node;
+            leftMax = node;
+            node = node->right;
+        } else {
+            break;
+        }
+    }
+
+    leftMax->right = node->left;
+    rightMin->left = node->right;
+    node->left = header.right;
+    node->right = header.left;
+    return node;
+}
+
+bool SplayTree::Insert(int key) {
+    if (!m_root) {
+        m_root = new Node{key};
+        m_size++;
+        return true;
+    }
+
+    m_root = Splay(m_root, key);
+    if (m_root->key == key) {
+        return false;
+    }
+
+    Node* node = new Node{key};
+    if (key < m_root->key) {
+        node->left = m_root->left;
+        node->right = m_root;
+        m_root->left = nullptr;
+    } else {
+        node->right = m_root->right;
+        node->left = m_root;
+        m_root->right = nullptr;
+    }
+    m_root = node;
+    m_size++;
+    return true;
+}
+
+bool SplayTree::Erase(int key) {
+    m_root = Splay(m_root, key);
+    if (!m_root || m_root->key != key) {
+        return false;
+    }
+
+    Node* removed = m_root;
+    if (!removed->left) {
+        m_root = removed->right;
+    } else {
+        // key is larger than everything on the left, so this brings the maximum up with no right child
+        m_root = Splay(removed->left, key);
+        m_root->right = removed->right;
+    }
+    delete removed;
+    m_size--;
+    return true;
+}
+
+bool SplayTree::Contains(int key) {
+    m_root = Splay(m_root, key);
+    return m_root && m_root->key == key;
+}
+
+void SplayTree::Clear() {
+    std::vector<Node*> stack;
+    if (m_root) {
+        stack.push_back(m_root);
+    }
+    while (!stack.empty()) {
+        Node* node = stack.back();
+        stack.pop_back();
+        if (node->left) stack.push_back(node->left);
+        if (node->right) stack.push_back(node->right);
+        delete node;
+    }
+    m_root = nullptr;
+    m_size = 0;
+}
+
+int SplayTree::Height() const {
+    int height = 0;
+    std::vector<std::pair<const Node*, int>> stack;
+    if (m_root) {
+        stack.emplace_back(m_root, 1);
+    }
+    while (!stack.empty()) {
+        auto [node, depth] = stack.back();
+        stack.pop_back();
+        height = std::max(height, depth);
+        if (node->left) stack.emplace_back(node->left, depth + 1);
+        if (node->right) stack.emplace_back(node->right, depth + 1);
+    }
+    return height;
+}
+
+// ---------------------------------------------------------------------------
+// Treap
+// ---------------------------------------------------------------------------
+
+bool Treap::Insert(int key) {
+    bool inserted = false;
+    m_root = InsertAt(std::move(m_root), key, inserted);
+    if (inserted) {
+        m_size++;
+    }
+    return inserted;
+}
+
+bool Treap::Erase(int key) {
+    bool erased = false;
+    m_root = EraseAt(std::move(m_root), key, erased);
+    if (erased) {
+        m_size--;
+    }
+    return erased;
+}
+
+bool Treap::Contains(int key) const {
+    const Node* node = m_root.get();
+    while (node) {
+        m_stats.comparisons++;
+        if (key == node->key) {
+            return true;
+        }
+        node = key < node->key ? node->left.get() : node->right.get();
+    }
+    return false;
+}
+
+void Treap::Clear() {
+    m_root.reset();
+    m_size = 0;
+}
+
+int Treap::Height() const {
+    return HeightOf(m_root.get());
+}
+
+int Treap::HeightOf(const Node* node) {
+    return node ? 1 + std::max(HeightOf(node->left.get()), HeightOf(node->right.get())) : 0;
+}
+
+Treap::NodePtr Treap::RotateLeft(NodePtr node) {
+    m_stats.rotations++;
+    NodePtr pivot = std::move(node->right);
+    node->right = std::move(pivot->left);
+    pivot->left = std::move(node);
+    return pivot;
+}
+
+Treap::NodePtr Treap::RotateRight(NodePtr node) {
+    m_stats.rotations++;
+    NodePtr pivot = std::move(node->left);
+    node->left = std::move(pivot->right);
+    pivot->right = std::move(node);
+    return pivot;
+}
+
+Treap::NodePtr Treap::InsertAt(NodePtr node, int key, bool& inserted) {
+    if (!node) {
+        inserted = true;
+        return std::make_unique<Node>(key, static_cast<uint32_t>(m_rng()));
+    }
+
+    m_stats.comparisons++;
+    if (key < node->key) {
+        node->left = InsertAt(std::move(node->left), key, inserted);
+        if (node->left->priority > node->priority) {
+            node = RotateRight(std::move(node));
+        }
+    } else if (key > node->key) {
+        node->right = InsertAt(std::move(node->right), key, inserted);
+        if (node->right->priority > node->priority) {
+            node = RotateLeft(std::move(node));
+        }
+    }
+    return node;
+}
+
+// Rotates the doomed node down below its higher-priority child until it is a leaf or has one child
+Treap::NodePtr Treap::EraseAt(NodePtr node, int key, bool& erased) {
+    if (!node) {
+        return node;
+    }
+
+    m_stats.comparisons++;
+    if (key < node->key) {
+        node->left = EraseAt(std::move(node->left), key, erased);
+    } else if (key > node->key) {
+        node->right = EraseAt(std::move(node->right), key, erased);
+    } else {
+        if (!node->left || !node->right) {
+            erased = true;
+            return std::move(node->left ? node->left : node->right);
+        }
+        if (node->left->priority > node->right->priority) {
+            node = RotateRight(std::move(node));
+            node->right = EraseAt(std::move(node->right), key, erased);
+        } else {
+            node = RotateLeft(std::move(node));
+            node->left = EraseAt(std::move(node->left), key, erased);
+        }
+    }
+    return node;
+}
+
+} // namespace AlgorithmVisualizer
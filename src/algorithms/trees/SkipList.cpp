@@ -0,0 +1,138 @@
+#include "algorithms/trees/SkipList.h"
+#include <algorithm>
+
+namespace AlgorithmVisualizer {
+
+SkipList::SkipList(unsigned int seed)
+    : m_head(std::make_unique<Node>(0, MAX_LEVEL)), m_rng(seed) {
+}
+
+SkipList::~SkipList() {
+    Clear();
+}
+
+int SkipList::RandomLevel() {
+    uint32_t bits = m_rng();
+    int level = 1;
+    while (level < MAX_LEVEL && (bits & 1u)) {
+        level++;
+        bits >>= 1;
+    }
+    return level;
+}
+
+SkipList::Node* SkipList::FindPredecessors(int key, Node* (&update)[MAX_LEVEL]) {
+    Node* node = m_head.get();
+    for (int level = m_level - 1; level >= 0; --level) {
+        int advanced = 0;
+        while (node->next[level] && node->next[level]->key < key) {
+            node = node->next[level];
+            advanced++;
+            m_stats.nodesVisited++;
+        }
+        if (advanced > 0) {
+            EmitStep("Level {}: moved right past {} node(s) to {}", level, advanced, node->key);
+        }
+        update[level] = node;
+        m_stats.levelDrops++;
+    }
+    for (int level = m_level; level < MAX_LEVEL; ++level) {
+        update[level] = m_head.get();
+    }
+    return node->next[0];
+}
+
+bool SkipList::Insert(int key) {
+    Node* update[MAX_LEVEL];
+    Node* candidate = FindPredecessors(key, update);
+    if (candidate && candidate->key == key) {
+        EmitStep("Key {} already present", key);
+        return false;
+    }
+
+    int height = RandomLevel();
+    EmitStep("Coin flips give {} a tower of height {}", key, height);
+    m_level = std::max(m_level, height);
+
+    Node* node = new Node(key, height);
+    for (int level = 0; level < height; ++level) {
+        node->next[level] = update[level]->next[level];
+        update[level]->next[level] = node;
+    }
+    m_size++;
+    EmitStep("Linked {} into levels 0..{}", key, height - 1);
+    return true;
+}
+
+bool SkipList::Erase(int key) {
+    Node* update[MAX_LEVEL];
+    Node* node = FindPredecessors(key, update);
+    if (!node || node->key != key) {
+        EmitStep("Key {} not found", key);
+        return false;
+    }
+
+    int height = static_cast<int>(node->next.size());
+    for (int level = 0; level < height; ++level) {
+        update[level]->next[level] = node->next[level];
+    }
+    delete node;
+    m_size--;
+
+    while (m_level > 1 && !m_head->next[m_level - 1]) {
+        m_level--;
+    }
+    EmitStep("Unlinked {} from {} level(s)", key, height);
+    return true;
+}
+
+bool SkipList::Contains(int key) const {
+    const Node* node = m_head.get();
+    for (int level = m_level - 1; level >= 0; --level) {
+        while (node->next[level] && node->next[level]->key < key) {
+            node = node->next[level];
+            m_stats.nodesVisited++;
+        }
+        m_stats.levelDrops++;
+    }
+    node = node->next[0];
+    return node && node->key == key;
+}
+
+std::vector<const SkipList::Node*> SkipList::SearchPath(int key) const {
+    std::vector<const Node*> path;
+    const Node* node = m_head.get();
+    for (int level = m_level - 1; level >= 0; --level) {
+        while (node->next[level] && node->next[level]->key < key) {
+            node = node->next[level];
+            path.push_back(node);
+        }
+    }
+    if (node->next[0] && node->next[0]->key == key) {
+        path.push_back(node->next[0]);
+    }
+    return path;
+}
+
+std::vector<int> SkipList::Keys() const {
+    std::vector<int> keys;
+    keys.reserve(m_size);
+    for (const Node* node = m_head->next[0]; node; node = node->next[0]) {
+        keys.push_back(node->key);
+    }
+    return keys;
+}
+
+void SkipList::Clear() {
+    Node* node = m_head->next[0];
+    while (node) {
+        Node* next = node->next[0];
+        delete node;
+        node = next;
+    }
+    std::fill(m_head->next.begin(), m_head->next.end(), nullptr);
+    m_level = 1;
+    m_size = 0;
+}
+
+} // namespace AlgorithmVisualizer
@@ -0,0 +1,172 @@
+#include "algorithms/trees/StaticSearchTree.h"
+#include <algorithm>
+#include <bit>
+#include <climits>
+
+namespace AlgorithmVisualizer {
+
+StaticSearchTree::StaticSearchTree(const std::vector<int>& sortedKeys, Layout layout)
+    : m_layout(layout), m_size(sortedKeys.size()) {
+    m_height = std::bit_width(m_size);
+    const int nodeCount = (1 << m_height) - 1;
+    m_hasMaxKey = !sortedKeys.empty() && sortedKeys.back() == INT_MAX;
+
+    if (m_layout == Layout::VanEmdeBoas) {
+        m_topSize.assign(m_height + 1, 0);
+        m_bottomSize.assign(m_height + 1, 0);
+        m_topDepth.assign(m_height + 1, 0);
+        BuildVanEmdeBoasTables(0, m_height);
+    }
+
+    // In a perfect tree the in-order rank of a node follows from its breadth-first
+    // index: the subtree below depth d spans 2^(h-d) ranks and the node sits mid-way
+    m_slots.assign(nodeCount, INT_MAX);
+    m_rankOfSlot.assign(nodeCount, 0);
+    m_depthOfSlot.assign(nodeCount, 0);
+    for (int node = 1; node <= nodeCount; ++node) {
+        const int depth = std::bit_width(static_cast<unsigned int>(node)) - 1;
+        const int span = 1 << (m_height - depth);
+        const int rank = (node - (1 << depth)) * span + span / 2 - 1;
+        const int slot = SlotOfNode(node);
+        if (rank < static_cast<int>(m_size)) {
+            m_slots[slot] = sortedKeys[rank];
+        }
+        m_rankOfSlot[slot] = rank;
+        m_depthOfSlot[slot] = depth;
+    }
+}
+
+// Splits a subtree of the given height rooted at topDepth into a top half of
+// floor(h/2) levels and bottom subtrees of ceil(h/2) levels, then recurses into both
+void StaticSearchTree::BuildVanEmdeBoasTables(int topDepth, int height) {
+    if (height <= 1) {
+        return;
+    }
+    const int topHeight = height / 2;
+    const int bottomHeight = height - topHeight;
+    const int bottomDepth = topDepth + topHeight;
+    m_topSize[bottomDepth] = (1 << topHeight) - 1;
+    m_bottomSize[bottomDepth] = (1 << bottomHeight) - 1;
+    m_topDepth[bottomDepth] = topDepth;
+    BuildVanEmdeBoasTables(topDepth, topHeight);
+    BuildVanEmdeBoasTables(bottomDepth, bottomHeight);
+}
+
+// Only used while building; the search loops inline the same arithmetic
+int StaticSearchTree::SlotOfNode(int node) const {
+    const int depth = std::bit_width(static_cast<unsigned int>(node)) - 1;
+    switch (m_layout) {
+    case Layout::Sorted: {
+        const int span = 1 << (m_height - depth);
+        return (node - (1 << depth)) * span + span / 2 - 1;
+    }
+    case Layout::Breadth:
+        return node - 1;
+    case Layout::VanEmdeBoas: {
+        if (depth == 0) {
+            return 0;
+        }
+        // The top subtree's root is this node's ancestor at m_topDepth[depth]; the low
+        // bits of the index below it pick which bottom subtree the node roots
+        const int ancestor = node >> (depth - m_topDepth[depth]);
+        return SlotOfNode(ancestor) + m_topSize[depth] + (node & m_topSize[depth]) * m_bottomSize[depth];
+    }
+    }
+    return 0;
+}
+
+bool StaticSearchTree::Contains(int key) const {
+    if (m_slots.empty()) {
+        return false;
+    }
+    if (key == INT_MAX) {
+        return m_hasMaxKey;
+    }
+
+    const int* slots = m_slots.data();
+    uint64_t visited = 0;
+    bool found = false;
+    switch (m_layout) {
+    case Layout::Sorted: {
+        int low = 0;
+        int high = static_cast<int>(m_slots.size());
+        while (low < high) {
+            const int mid = (low + high) / 2;
+            visited++;
+            if (slots[mid] == key) {
+                found = true;
+                break;
+            }
+            if (slots[mid] < key) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        break;
+    }
+    case Layout::Breadth: {
+        const int count = static_cast<int>(m_slots.size());
+        for (int slot = 0; slot < count;) {
+            visited++;
+            if (slots[slot] == key) {
+                found = true;
+                break;
+            }
+            slot = 2 * slot + 1 + (slots[slot] < key);
+        }
+        break;
+    }
+    case Layout::VanEmdeBoas: {
+        // slotAt[d] is the slot of the path node at depth d
+        int slotAt[32];
+        slotAt[0] = 0;
+        int node = 1;
+        for (int depth = 0;;) {
+            const int slotKey = slots[slotAt[depth]];
+            visited++;
+            if (slotKey == key) {
+                found = true;
+                break;
+            }
+            node = 2 * node + (slotKey < key);
+            if (++depth == m_height) {
+                break;
+            }
+            const int top = m_topSize[depth];
+            slotAt[depth] = slotAt[m_topDepth[depth]] + top + (node & top) * m_bottomSize[depth];
+        }
+        break;
+    }
+    }
+    m_stats.nodesVisited += visited;
+    return found;
+}
+
+// Walks the implicit tree by breadth-first index and maps each node to its slot;
+// slower than Contains, but the same path for every layout
+std::vector<int> StaticSearchTree::SearchPath(int key) const {
+    std::vector<int> path;
+    int node = 1;
+    const int nodeCount = static_cast<int>(m_slots.size());
+    while (node <= nodeCount) {
+        const int slot = SlotOfNode(node);
+        path.push_back(slot);
+        if (m_slots[slot] == key && !IsPadding(slot)) {
+            break;
+        }
+        node = 2 * node + (m_slots[slot] < key);
+    }
+    return path;
+}
+
+const char* StaticSearchTree::LayoutName(Layout layout) {
+    switch (layout) {
+    case Layout::Sorted: return "Sorted (in-order)";
+    case Layout::Breadth: return "Breadth-first (Eytzinger)";
+    case Layout::VanEmdeBoas: return "van Emde Boas";
+    }
+    return "Unknown";
+}
+
+} // namespace AlgorithmVisualizer
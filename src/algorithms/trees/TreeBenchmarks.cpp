@@ -0,0 +1,1392 @@
+#include "algorithms/trees/TreeBenchmarks.h"
+#include "algorithms/trees/AdaptiveRadixTree.h"
+#include "algorithms/trees/BTree.h"
+#include "algorithms/trees/SearchTrees.h"
+#include "algorithms/trees/Heaps.h"
+#include "algorithms/trees/SkipList.h"
+#include "algorithms/trees/LockFreeSkipList.h"
+#include "algorithms/trees/PatriciaTrie.h"
+#include "algorithms/trees/RangeTrees.h"
+#include "algorithms/trees/StaticSearchTree.h"
+#include <fmt/format.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <set>
+#include <thread>
+#include <unordered_set>
+
+namespace AlgorithmVisualizer {
+
+namespace {
+
+using BenchmarkClock = std::chrono::steady_clock;
+
+template <typename Fn>
+double MeasureMilliseconds(Fn&& fn) {
+    auto start = BenchmarkClock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(BenchmarkClock::now() - start).count();
+}
+
+std::string NanosPerOp(double milliseconds, size_t operations) {
+    if (operations == 0) {
+        return "-";
+    }
+    return fmt::format("{:.1f}", milliseconds * 1.0e6 / static_cast<double>(operations));
+}
+
+std::string PerSecond(double milliseconds, size_t operations) {
+    if (milliseconds <= 0.0) {
+        return "-";
+    }
+    return fmt::format("{:.2f}M", static_cast<double>(operations) / (milliseconds * 1.0e3));
+}
+
+std::string FormatBytes(size_t bytes) {
+    if (bytes >= (size_t(1) << 20)) {
+        return fmt::format("{:.1f} MB", static_cast<double>(bytes) / (1 << 20));
+    }
+    return fmt::format("{:.1f} KB", static_cast<double>(bytes) / (1 << 10));
+}
+
+// Words built from a small syllable set, so that many share prefixes the way dictionary words do
+std::vector<std::string> MakeSyllableWords(int count, std::mt19937& rng) {
+    static constexpr const char* SYLLABLES[] = {
+        "an", "ar", "be", "ca", "con", "de", "di", "en", "er", "ex", "in", "ing", "io", "is", "la",
+        "ly", "ma", "ment", "na", "ne", "o", "per", "pre", "pro", "ra", "re", "ri", "sa", "se", "sion",
+        "st", "ta", "te", "ter", "ti", "tion", "to", "tra", "un", "ve"
+    };
+    std::uniform_int_distribution<int> syllable(0, static_cast<int>(std::size(SYLLABLES)) - 1);
+    std::uniform_int_distribution<int> length(1, 5);
+    std::unordered_set<std::string> unique;
+    // The syllable space is finite; give up on uniqueness after a fixed number of attempts
+    for (long long attempt = 0; static_cast<int>(unique.size()) < count && attempt < 20LL * count; ++attempt) {
+        std::string word;
+        for (int i = length(rng); i > 0; --i) {
+            word += SYLLABLES[syllable(rng)];
+        }
+        unique.insert(std::move(word));
+    }
+    return std::vector<std::string>(unique.begin(), unique.end());
+}
+
+// Heap bytes of a string beyond its inline (small string) buffer
+size_t StringHeapBytes(const std::string& value) {
+    static const size_t inlineCapacity = std::string().capacity();
+    return value.capacity() > inlineCapacity ? value.capacity() + 1 : 0;
+}
+
+struct KeyWorkload {
+    std::vector<int> inserts;
+    std::vector<int> lookups;
+    std::vector<int> erases;
+    std::vector<std::pair<int, int>> ranges;
+};
+
+// Distinct random keys; lookups are half hits and half misses, erases remove half the keys
+KeyWorkload MakeKeyWorkload(int keyCount, int lookupCount, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::vector<int> pool(static_cast<size_t>(keyCount) * 2);
+    std::iota(pool.begin(), pool.end(), 0);
+    std::shuffle(pool.begin(), pool.end(), rng);
+
+    KeyWorkload workload;
+    workload.inserts.assign(pool.begin(), pool.begin() + keyCount);
+
+    std::uniform_int_distribution<size_t> pick(0, static_cast<size_t>(keyCount) - 1);
+    workload.lookups.reserve(lookupCount);
+    for (int i = 0; i < lookupCount; ++i) {
+        size_t index = pick(rng);
+        workload.lookups.push_back(i % 2 == 0 ? pool[index] : pool[keyCount + index]);
+    }
+
+    workload.erases.assign(workload.inserts.begin(), workload.inserts.begin() + keyCount / 2);
+
+    // 200 scans, each covering about 1% of the key space
+    const int span = std::max(1, keyCount * 2 / 100);
+    std::uniform_int_distribution<int> start(0, std::max(0, keyCount * 2 - span));
+    for (int i = 0; i < 200; ++i) {
+        int low = start(rng);
+        workload.ranges.emplace_back(low, low + span);
+    }
+    return workload;
+}
+
+// The same workload stretched over the whole int range with per-key jitter. The mapping
+// is monotone, so every lookup and range selects the same keys, but neighbouring keys
+// no longer share their low bytes.
+KeyWorkload SpreadKeyWorkload(const KeyWorkload& dense, int keyCount) {
+    const double step = 4294967296.0 / (2.0 * keyCount);
+    const uint32_t jitter = std::max<uint32_t>(1, static_cast<uint32_t>(step));
+    auto spread = [&](int key) {
+        const int64_t base = static_cast<int64_t>(key * step) + (static_cast<uint32_t>(key) * 2654435761u) % jitter;
+        return static_cast<int>(base + std::numeric_limits<int>::min());
+    };
+
+    KeyWorkload workload;
+    for (auto [from, to] : {std::pair{&dense.inserts, &workload.inserts}, std::pair{&dense.lookups, &workload.lookups},
+                            std::pair{&dense.erases, &workload.erases}}) {
+        to->reserve(from->size());
+        for (int key : *from) {
+            to->push_back(spread(key));
+        }
+    }
+    for (const auto& [low, high] : dense.ranges) {
+        workload.ranges.emplace_back(spread(low), spread(high));
+    }
+    return workload;
+}
+
+// Directed graph in compressed sparse row form
+struct WeightedGraph {
+    std::vector<int> offsets;
+    std::vector<int> targets;
+    std::vector<uint32_t> weights;
+};
+
+// Each vertex gets an edge to its successor (so everything is reachable from 0)
+// plus degree - 1 random edges; weights are uniform in [1, 1000]
+WeightedGraph MakeRandomGraph(int vertexCount, int degree, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> vertex(0, vertexCount - 1);
+    std::uniform_int_distribution<uint32_t> weight(1, 1000);
+
+    WeightedGraph graph;
+    graph.offsets.reserve(vertexCount + 1);
+    graph.targets.reserve(static_cast<size_t>(vertexCount) * degree);
+    graph.weights.reserve(static_cast<size_t>(vertexCount) * degree);
+    for (int v = 0; v < vertexCount; ++v) {
+        graph.offsets.push_back(static_cast<int>(graph.targets.size()));
+        graph.targets.push_back((v + 1) % vertexCount);
+        graph.weights.push_back(weight(rng));
+        for (int e = 1; e < degree; ++e) {
+            graph.targets.push_back(vertex(rng));
+            graph.weights.push_back(weight(rng));
+        }
+    }
+    graph.offsets.push_back(static_cast<int>(graph.targets.size()));
+    return graph;
+}
+
+struct QueueCounts {
+    size_t pushes = 0;
+    size_t pops = 0;
+    size_t decreaseKeys = 0;
+    uint64_t checksum = 0;
+
+    size_t Operations() const { return pushes + pops + decreaseKeys; }
+};
+
+constexpr uint32_t UNREACHED = std::numeric_limits<uint32_t>::max();
+
+template <typename Queue>
+QueueCounts RunDijkstra(const WeightedGraph& graph, Queue& queue) {
+    QueueCounts counts;
+    std::vector<uint32_t> distance(graph.offsets.size() - 1, UNREACHED);
+    distance[0] = 0;
+    queue.Push(0, 0);
+    counts.pushes++;
+
+    while (!queue.Empty()) {
+        auto [vertex, dist] = queue.Pop();
+        counts.pops++;
+        counts.checksum += dist;
+        for (int e = graph.offsets[vertex]; e < graph.offsets[vertex + 1]; ++e) {
+            int target = graph.targets[e];
+            uint32_t candidate = dist + graph.weights[e];
+            if (candidate >= distance[target]) {
+                continue;
+            }
+            if (distance[target] == UNREACHED) {
+                queue.Push(target, candidate);
+                counts.pushes++;
+            } else {
+                queue.DecreaseKey(target, candidate);
+                counts.decreaseKeys++;
+            }
+            distance[target] = candidate;
+        }
+    }
+    return counts;
+}
+
+// Baseline without decrease-key: push duplicates and skip stale pops
+QueueCounts RunDijkstraLazy(const WeightedGraph& graph) {
+    using Item = std::pair<uint32_t, int>;
+    std::priority_queue<Item, std::vector<Item>, std::greater<>> queue;
+    QueueCounts counts;
+    std::vector<uint32_t> distance(graph.offsets.size() - 1, UNREACHED);
+    distance[0] = 0;
+    queue.push({0, 0});
+    counts.pushes++;
+
+    while (!queue.empty()) {
+        auto [dist, vertex] = queue.top();
+        queue.pop();
+        counts.pops++;
+        if (dist != distance[vertex]) {
+            continue;
+        }
+        counts.checksum += dist;
+        for (int e = graph.offsets[vertex]; e < graph.offsets[vertex + 1]; ++e) {
+            int target = graph.targets[e];
+            uint32_t candidate = dist + graph.weights[e];
+            if (candidate < distance[target]) {
+                distance[target] = candidate;
+                queue.push({candidate, target});
+                counts.pushes++;
+            }
+        }
+    }
+    return counts;
+}
+
+template <typename Queue>
+QueueCounts RunPushPopAll(const std::vector<uint32_t>& keys, Queue& queue) {
+    QueueCounts counts;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        queue.Push(static_cast<int>(i), keys[i]);
+    }
+    counts.pushes = keys.size();
+    while (!queue.Empty()) {
+        counts.checksum = counts.checksum * 31 + queue.Pop().key;
+        counts.pops++;
+    }
+    return counts;
+}
+
+struct AccessPattern {
+    std::string name;
+    std::vector<int> keys;
+};
+
+// Keys are 0..keyCount-1; popularity ranks are mapped through a permutation so hot keys are scattered
+std::vector<AccessPattern> MakeAccessPatterns(const AccessPatternBenchmarkConfig& config) {
+    std::mt19937 rng(config.seed);
+    const int n = config.keyCount;
+    std::vector<AccessPattern> patterns;
+
+    AccessPattern uniform{"Uniform", {}};
+    std::uniform_int_distribution<int> anyKey(0, n - 1);
+    for (int i = 0; i < config.accessCount; ++i) {
+        uniform.keys.push_back(anyKey(rng));
+    }
+    patterns.push_back(std::move(uniform));
+
+    std::vector<int> rankToKey(n);
+    std::iota(rankToKey.begin(), rankToKey.end(), 0);
+    std::shuffle(rankToKey.begin(), rankToKey.end(), rng);
+    std::vector<double> cdf(n);
+    double total = 0.0;
+    for (int rank = 0; rank < n; ++rank) {
+        total += 1.0 / std::pow(rank + 1.0, config.zipfExponent);
+        cdf[rank] = total;
+    }
+    AccessPattern zipf{fmt::format("Zipf s={:.2f}", config.zipfExponent), {}};
+    std::uniform_real_distribution<double> unit(0.0, total);
+    for (int i = 0; i < config.accessCount; ++i) {
+        size_t rank = std::lower_bound(cdf.begin(), cdf.end(), unit(rng)) - cdf.begin();
+        zipf.keys.push_back(rankToKey[std::min(rank, cdf.size() - 1)]);
+    }
+    patterns.push_back(std::move(zipf));
+
+    AccessPattern sequential{"Sequential", {}};
+    for (int i = 0; i < config.accessCount; ++i) {
+        sequential.keys.push_back(i % n);
+    }
+    patterns.push_back(std::move(sequential));
+
+    const int setSize = std::clamp(config.workingSetSize, 1, n);
+    AccessPattern workingSet{fmt::format("Working set ({})", setSize), {}};
+    std::uniform_int_distribution<int> member(0, setSize - 1);
+    std::vector<int> hot;
+    for (int i = 0; i < config.accessCount; ++i) {
+        if (i % std::max(1, config.workingSetPhase) == 0) {
+            std::shuffle(rankToKey.begin(), rankToKey.end(), rng);
+            hot.assign(rankToKey.begin(), rankToKey.begin() + setSize);
+        }
+        workingSet.keys.push_back(hot[member(rng)]);
+    }
+    patterns.push_back(std::move(workingSet));
+
+    return patterns;
+}
+
+enum class SetOperation : uint8_t {
+    Insert,
+    Erase,
+    Lookup
+};
+
+struct SetWorkloadItem {
+    SetOperation operation;
+    int key;
+};
+
+std::vector<SetWorkloadItem> MakeSetWorkload(const ConcurrentSetBenchmarkConfig& config, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> key(1, config.keyRange);
+    std::uniform_int_distribution<int> percent(0, 99);
+
+    std::vector<SetWorkloadItem> workload(config.operationsPerThread);
+    for (auto& item : workload) {
+        int roll = percent(rng);
+        item.operation = roll < config.insertPercent ? SetOperation::Insert
+                       : roll < config.insertPercent + config.erasePercent ? SetOperation::Erase
+                       : SetOperation::Lookup;
+        item.key = key(rng);
+    }
+    return workload;
+}
+
+// Runs worker(thread) on threadCount threads released together; returns wall time of the slowest
+template <typename Worker>
+double RunThreads(int threadCount, Worker&& worker) {
+    std::atomic<int> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&, t] {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            worker(t);
+        });
+    }
+    while (ready.load() < threadCount) {
+        std::this_thread::yield();
+    }
+    auto start = BenchmarkClock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return std::chrono::duration<double, std::milli>(BenchmarkClock::now() - start).count();
+}
+
+} // namespace
+
+BenchmarkReport RunBTreeBenchmark(const BTreeBenchmarkConfig& config) {
+    BenchmarkReport report;
+    report.title = fmt::format("B-Tree vs. balanced BST ({} keys, {} lookups)", config.keyCount, config.lookupCount);
+    report.columns = {"Structure", "Order", "Height", "Nodes/lookup", "Insert ns/op",
+                      "Lookup ns/op", "ns/node", "Range scan ms", "Erase ns/op"};
+
+    if (config.keyCount <= 0 || config.lookupCount <= 0) {
+        report.notes.push_back("Nothing to run: key and lookup counts must be positive");
+        return report;
+    }
+
+    const KeyWorkload workload = MakeKeyWorkload(config.keyCount, config.lookupCount, config.seed);
+    size_t hits = 0;
+    size_t scanned = 0;
+
+    auto addRow = [&](const std::string& name, const std::string& order, int height, uint64_t nodesVisited,
+                      double insertMs, double lookupMs, const std::string& scanMs, double eraseMs) {
+        const double nodesPerLookup = static_cast<double>(nodesVisited) / workload.lookups.size();
+        const double nsPerLookup = lookupMs * 1.0e6 / workload.lookups.size();
+        report.rows.push_back({
+            name, order, std::to_string(height), fmt::format("{:.2f}", nodesPerLookup),
+            NanosPerOp(insertMs, workload.inserts.size()), NanosPerOp(lookupMs, workload.lookups.size()),
+            fmt::format("{:.1f}", nodesPerLookup > 0.0 ? nsPerLookup / nodesPerLookup : 0.0),
+            scanMs, NanosPerOp(eraseMs, workload.erases.size())
+        });
+        report.totalMilliseconds += insertMs + lookupMs + eraseMs;
+    };
+
+    for (BTree::Variant variant : {BTree::Variant::BTree, BTree::Variant::BPlusTree}) {
+        for (int order : config.orders) {
+            BTree tree(order, variant);
+            double insertMs = MeasureMilliseconds([&] {
+                for (int key : workload.inserts) {
+                    tree.Insert(key);
+                }
+            });
+
+            tree.ResetStats();
+            double lookupMs = MeasureMilliseconds([&] {
+                for (int key : workload.lookups) {
+                    hits += tree.Contains(key);
+                }
+            });
+            const uint64_t nodesVisited = tree.GetStats().nodesVisited;
+            const int height = tree.Height();
+
+            double scanMs = MeasureMilliseconds([&] {
+                for (const auto& [low, high] : workload.ranges) {
+                    scanned += tree.RangeScan(low, high).size();
+                }
+            });
+
+            double eraseMs = MeasureMilliseconds([&] {
+                for (int key : workload.erases) {
+                    tree.Erase(key);
+                }
+            });
+
+            addRow(variant == BTree::Variant::BTree ? "B-Tree" : "B+Tree", std::to_string(tree.GetOrder()),
+                   height, nodesVisited, insertMs, lookupMs, fmt::format("{:.2f}", scanMs), eraseMs);
+        }
+    }
+
+    auto runBinaryTree = [&](auto& tree, const std::string& name) {
+        double insertMs = MeasureMilliseconds([&] {
+            for (int key : workload.inserts) {
+                tree.Insert(key);
+            }
+        });
+
+        tree.ResetStats();
+        double lookupMs = MeasureMilliseconds([&] {
+            for (int key : workload.lookups) {
+                hits += tree.Contains(key);
+            }
+        });
+        const uint64_t nodesVisited = tree.GetStats().comparisons;
+        const int height = tree.Height();
+
+        double eraseMs = MeasureMilliseconds([&] {
+            for (int key : workload.erases) {
+                tree.Erase(key);
+            }
+        });
+
+        addRow(name, "2", height, nodesVisited, insertMs, lookupMs, "-", eraseMs);
+    };
+
+    AVLTree avl;
+    runBinaryTree(avl, "AVL Tree");
+    RedBlackTree redBlack;
+    runBinaryTree(redBlack, "Red-Black Tree");
+
+    report.totalOperations = static_cast<long long>(report.rows.size()) *
+        static_cast<long long>(workload.inserts.size() + workload.lookups.size() + workload.erases.size());
+    report.notes.push_back(fmt::format("Intra-node search kernel: {}", BTree::SearchKernelName()));
+    report.notes.push_back("Nodes/lookup is the number of nodes touched (tree height for hits);");
+    report.notes.push_back("ns/node divides lookup time by it, i.e. the per-node search cost.");
+    report.notes.push_back(fmt::format("Lookups hit {} times, range scans returned {} keys", hits, scanned));
+    return report;
+}
+
+BenchmarkReport RunHeapBenchmark(const HeapBenchmarkConfig& config) {
+    BenchmarkReport report;
+    report.title = fmt::format("Priority queues ({} vertices)", config.vertexCount);
+    report.columns = {"Workload", "Queue", "Time ms", "Pushes", "Pops", "Decrease-keys", "ns/op", "Checksum"};
+
+    if (config.vertexCount <= 1) {
+        report.notes.push_back("Nothing to run: need at least two vertices");
+        return report;
+    }
+
+    const size_t capacity = static_cast<size_t>(config.vertexCount);
+    auto addRow = [&](const std::string& workload, const std::string& queue, double milliseconds,
+                      const QueueCounts& counts) {
+        report.rows.push_back({
+            workload, queue, fmt::format("{:.2f}", milliseconds), std::to_string(counts.pushes),
+            std::to_string(counts.pops), std::to_string(counts.decreaseKeys),
+            NanosPerOp(milliseconds, counts.Operations()), std::to_string(counts.checksum)
+        });
+        report.totalMilliseconds += milliseconds;
+        report.totalOperations += static_cast<long long>(counts.Operations());
+    };
+
+    auto runQueues = [&](const std::string& workload, auto&& run) {
+        for (int arity : {2, 4, 8}) {
+            DaryHeap heap(arity, capacity);
+            QueueCounts counts;
+            double ms = MeasureMilliseconds([&] { counts = run(heap); });
+            addRow(workload, heap.Name(), ms, counts);
+        }
+        PairingHeap pairing(capacity);
+        QueueCounts pairingCounts;
+        double pairingMs = MeasureMilliseconds([&] { pairingCounts = run(pairing); });
+        addRow(workload, pairing.Name(), pairingMs, pairingCounts);
+
+        RadixHeap radix(capacity);
+        QueueCounts radixCounts;
+        double radixMs = MeasureMilliseconds([&] { radixCounts = run(radix); });
+        addRow(workload, radix.Name(), radixMs, radixCounts);
+    };
+
+    for (int degree : {config.sparseDegree, config.denseDegree}) {
+        const WeightedGraph graph = MakeRandomGraph(config.vertexCount, std::max(1, degree), config.seed);
+        const std::string workload = fmt::format("Dijkstra, degree {}", degree);
+
+        runQueues(workload, [&](auto& queue) { return RunDijkstra(graph, queue); });
+
+        QueueCounts lazyCounts;
+        double lazyMs = MeasureMilliseconds([&] { lazyCounts = RunDijkstraLazy(graph); });
+        addRow(workload, "std::priority_queue (lazy)", lazyMs, lazyCounts);
+    }
+
+    // Push/pop-all is monotone too (pops come out sorted), so the radix heap applies
+    std::mt19937 rng(config.seed);
+    std::uniform_int_distribution<uint32_t> keyDist(0, 1u << 30);
+    std::vector<uint32_t> keys(capacity);
+    for (auto& key : keys) {
+        key = keyDist(rng);
+    }
+    runQueues("Push all, pop all", [&](auto& queue) { return RunPushPopAll(keys, queue); });
+
+    report.notes.push_back("Rows of one workload must share a checksum (sum of distances / pop order).");
+    report.notes.push_back("The lazy baseline has no decrease-key; its extra pushes and pops are stale entries.");
+    report.notes.push_back("Radix heap decrease-key re-pushes lazily, so it only suits monotone workloads like Dijkstra.");
+    return report;
+}
+
+BenchmarkReport RunAccessPatternBenchmark(const AccessPatternBenchmarkConfig& config) {
+    BenchmarkReport report;
+    report.title = fmt::format("Access patterns ({} keys, {} accesses)", config.keyCount, config.accessCount);
+    report.columns = {"Workload", "Structure", "Cmp/op", "Rot/op", "ns/op", "Height"};
+
+    if (config.keyCount <= 0 || config.accessCount <= 0) {
+        report.notes.push_back("Nothing to run: key and access counts must be positive");
+        return report;
+    }
+
+    std::vector<int> buildOrder(config.keyCount);
+    std::iota(buildOrder.begin(), buildOrder.end(), 0);
+    std::shuffle(buildOrder.begin(), buildOrder.end(), std::mt19937(config.seed + 1));
+    const int updateEvery = std::max(1, config.updateEvery);
+
+    auto run = [&](auto& tree, const std::string& structure, const AccessPattern& pattern) {
+        for (int key : buildOrder) {
+            tree.Insert(key);
+        }
+        tree.ResetStats();
+
+        size_t operations = 0;
+        size_t hits = 0;
+        double milliseconds = MeasureMilliseconds([&] {
+            for (size_t i = 0; i < pattern.keys.size(); ++i) {
+                int key = pattern.keys[i];
+                if (i % updateEvery == 0) {
+                    tree.Erase(key);
+                    tree.Insert(key);
+                    operations += 2;
+                } else {
+                    hits += tree.Contains(key);
+                    operations++;
+                }
+            }
+        });
+
+        const auto& stats = tree.GetStats();
+        report.rows.push_back({
+            pattern.name, structure,
+            fmt::format("{:.2f}", static_cast<double>(stats.comparisons) / operations),
+            fmt::format("{:.3f}", static_cast<double>(stats.rotations) / operations),
+            NanosPerOp(milliseconds, operations), std::to_string(tree.Height())
+        });
+        report.totalMilliseconds += milliseconds;
+        report.totalOperations += static_cast<long long>(operations);
+        return hits;
+    };
+
+    size_t hits = 0;
+    for (const AccessPattern& pattern : MakeAccessPatterns(config)) {
+        AVLTree avl;
+        hits += run(avl, "AVL Tree", pattern);
+        RedBlackTree redBlack;
+        hits += run(redBlack, "Red-Black Tree", pattern);
+        SplayTree splay;
+        hits += run(splay, "Splay Tree", pattern);
+        Treap treap(config.seed);
+        hits += run(treap, "Treap", pattern);
+    }
+
+    report.notes.push_back(fmt::format("Every {}th access erases and re-inserts its key; the rest are lookups.", updateEvery));
+    report.notes.push_back("Splay trees pay rotations on every access but keep hot keys near the root.");
+    report.notes.push_back(fmt::format("Lookups hit {} times", hits));
+    return report;
+}
+
+BenchmarkReport RunConcurrentSetBenchmark(const ConcurrentSetBenchmarkConfig& config) {
+    BenchmarkReport report;
+    report.title = fmt::format("Concurrent sets ({}% insert, {}% erase, {}% lookup, {} keys)", config.insertPercent,
+                               config.erasePercent, 100 - config.insertPercent - config.erasePercent, config.keyRange);
+    report.columns = {"Structure", "Threads", "Time ms", "Mops/s", "Scaling", "Final size"};
+
+    if (config.operationsPerThread <= 0 || config.keyRange <= 1) {
+        report.notes.push_back("Nothing to run: operation count and key range must be positive");
+        return report;
+    }
+
+    int maxThreads = 1;
+    for (int threads : config.threadCounts) {
+        maxThreads = std::max(maxThreads, std::min(threads, EpochManager::MAX_THREADS));
+    }
+    std::vector<std::vector<SetWorkloadItem>> workloads;
+    for (int t = 0; t < maxThreads; ++t) {
+        workloads.push_back(MakeSetWorkload(config, config.seed + t));
+    }
+
+    std::vector<int> prefill;
+    for (int key = 2; key <= config.keyRange; key += 2) {
+        prefill.push_back(key);
+    }
+    std::shuffle(prefill.begin(), prefill.end(), std::mt19937(config.seed));
+
+    auto addRow = [&](const std::string& name, int threads, double milliseconds, double baselineMops, size_t finalSize) {
+        const long long operations = static_cast<long long>(threads) * config.operationsPerThread;
+        const double mops = milliseconds > 0.0 ? operations / (milliseconds * 1000.0) : 0.0;
+        report.rows.push_back({
+            name, std::to_string(threads), fmt::format("{:.2f}", milliseconds), fmt::format("{:.2f}", mops),
+            baselineMops > 0.0 ? fmt::format("{:.2f}x", mops / baselineMops) : "1.00x", std::to_string(finalSize)
+        });
+        report.totalMilliseconds += milliseconds;
+        report.totalOperations += operations;
+        return mops;
+    };
+
+    {
+        SkipList list(config.seed);
+        for (int key : prefill) {
+            list.Insert(key);
+        }
+        double milliseconds = MeasureMilliseconds([&] {
+            for (const auto& item : workloads[0]) {
+                switch (item.operation) {
+                    case SetOperation::Insert: list.Insert(item.key); break;
+                    case SetOperation::Erase: list.Erase(item.key); break;
+                    case SetOperation::Lookup: list.Contains(item.key); break;
+                }
+            }
+        });
+        addRow("Skip list (sequential)", 1, milliseconds, 0.0, list.Size());
+    }
+
+    double lockFreeBaseline = 0.0;
+    double mutexBaseline = 0.0;
+    uint64_t reclaimed = 0;
+    for (int requested : config.threadCounts) {
+        const int threads = std::clamp(requested, 1, maxThreads);
+
+        {
+            LockFreeSkipList list;
+            for (int key : prefill) {
+                list.Insert(key, 0);
+            }
+            double milliseconds = RunThreads(threads, [&](int slot) {
+                for (const auto& item : workloads[slot]) {
+                    switch (item.operation) {
+                        case SetOperation::Insert: list.Insert(item.key, slot); break;
+                        case SetOperation::Erase: list.Erase(item.key, slot); break;
+                        case SetOperation::Lookup: list.Contains(item.key, slot); break;
+                    }
+                }
+            });
+            double mops = addRow("Lock-free skip list", threads, milliseconds, lockFreeBaseline, list.Size());
+            if (lockFreeBaseline == 0.0) {
+                lockFreeBaseline = mops;
+            }
+            reclaimed += list.Epochs().ReclaimedCount();
+        }
+
+        {
+            AVLTree tree;
+            std::mutex mutex;
+            for (int key : prefill) {
+                tree.Insert(key);
+            }
+            double milliseconds = RunThreads(threads, [&](int slot) {
+                for (const auto& item : workloads[slot]) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    switch (item.operation) {
+                        case SetOperation::Insert: tree.Insert(item.key); break;
+                        case SetOperation::Erase: tree.Erase(item.key); break;
+                        case SetOperation::Lookup: tree.Contains(item.key); break;
+                    }
+                }
+            });
+            double mops = addRow("AVL tree + mutex", threads, milliseconds, mutexBaseline, tree.Size());
+            if (mutexBaseline == 0.0) {
+                mutexBaseline = mops;
+            }
+        }
+    }
+
+    report.notes.push_back(fmt::format("Hardware threads: {}; thread counts are capped at {}",
+                                       std::thread::hardware_concurrency(), maxThreads));
+    report.notes.push_back("Scaling is relative to the same structure on the first thread count.");
+    report.notes.push_back(fmt::format("Epoch reclamation freed {} skip list nodes during the runs", reclaimed));
+    return report;
+}
+
+BenchmarkReport RunRadixTreeBenchmark(const RadixTreeBenchmarkConfig& config) {
+    BenchmarkReport report;
+    report.title = fmt::format("Adaptive radix tree vs. comparison trees ({} keys, {} lookups)",
+                               config.keyCount, config.lookupCount);
+    report.columns = {"Structure", "Keys", "Height", "Nodes/lookup", "Insert ns/op",
+                      "Lookup ns/op", "Range scan ms", "Full scan ns/key"};
+
+    if (config.keyCount <= 0 || config.lookupCount <= 0) {
+        report.notes.push_back("Nothing to run: key and lookup counts must be positive");
+        return report;
+    }
+
+    const KeyWorkload dense = MakeKeyWorkload(config.keyCount, config.lookupCount, config.seed);
+    const KeyWorkload sparse = SpreadKeyWorkload(dense, config.keyCount);
+    size_t hits = 0;
+    size_t scanned = 0;
+    long long checksum = 0;
+
+    auto runTree = [&](auto& tree, const std::string& name, const std::string& keys, const KeyWorkload& workload) {
+        double insertMs = MeasureMilliseconds([&] {
+            for (int key : workload.inserts) {
+                tree.Insert(key);
+            }
+        });
+
+        tree.ResetStats();
+        double lookupMs = MeasureMilliseconds([&] {
+            for (int key : workload.lookups) {
+                hits += tree.Contains(key);
+            }
+        });
+        uint64_t nodesVisited = 0;
+        if constexpr (requires { tree.GetStats().nodesVisited; }) {
+            nodesVisited = tree.GetStats().nodesVisited;
+        } else {
+            nodesVisited = tree.GetStats().comparisons;
+        }
+
+        std::string rangeMs = "-";
+        if constexpr (requires { tree.RangeScan(0, 0); }) {
+            double milliseconds = MeasureMilliseconds([&] {
+                for (const auto& [low, high] : workload.ranges) {
+                    scanned += tree.RangeScan(low, high).size();
+                }
+            });
+            rangeMs = fmt::format("{:.2f}", milliseconds);
+            report.totalMilliseconds += milliseconds;
+        }
+
+        double scanMs = MeasureMilliseconds([&] {
+            for (int key : tree.Keys()) {
+                checksum += key;
+            }
+        });
+
+        report.rows.push_back({
+            name, keys, std::to_string(tree.Height()),
+            fmt::format("{:.2f}", static_cast<double>(nodesVisited) / workload.lookups.size()),
+            NanosPerOp(insertMs, workload.inserts.size()), NanosPerOp(lookupMs, workload.lookups.size()),
+            rangeMs, NanosPerOp(scanMs, tree.Size())
+        });
+        report.totalMilliseconds += insertMs + lookupMs + scanMs;
+        report.totalOperations += static_cast<long long>(workload.inserts.size() + workload.lookups.size() + tree.Size());
+    };
+
+    auto describeNodes = [](const AdaptiveRadixTree& tree, const std::string& keys) {
+        using Type = AdaptiveRadixTree::NodeType;
+        return fmt::format("ART ({} keys): {} Node4, {} Node16, {} Node48, {} Node256; {:.1f} bytes/key", keys,
+                           tree.NodeCount(Type::Node4), tree.NodeCount(Type::Node16), tree.NodeCount(Type::Node48),
+                           tree.NodeCount(Type::Node256),
+                           static_cast<double>(tree.MemoryBytes()) / std::max<size_t>(1, tree.Size()));
+    };
+
+    for (const auto& [workload, keys] : {std::pair{&dense, "dense"}, std::pair{&sparse, "sparse"}}) {
+        AdaptiveRadixTree art;
+        runTree(art, "Adaptive Radix Tree", keys, *workload);
+        report.notes.push_back(describeNodes(art, keys));
+
+        BTree bplus(config.bplusOrder, BTree::Variant::BPlusTree);
+        runTree(bplus, fmt::format("B+Tree (order {})", bplus.GetOrder()), keys, *workload);
+
+        AVLTree avl;
+        runTree(avl, "AVL Tree", keys, *workload);
+
+        RedBlackTree redBlack;
+        runTree(redBlack, "Red-Black Tree", keys, *workload);
+    }
+
+    // String keys: zero-padded hex of the sparse keys, so all of them share a long prefix
+    std::vector<std::string> words;
+    std::vector<std::string> probes;
+    words.reserve(sparse.inserts.size());
+    for (int key : sparse.inserts) {
+        words.push_back(fmt::format("user/{:08x}", static_cast<uint32_t>(key)));
+    }
+    probes.reserve(sparse.lookups.size());
+    for (int key : sparse.lookups) {
+        probes.push_back(fmt::format("user/{:08x}", static_cast<uint32_t>(key)));
+    }
+
+    auto runStrings = [&](const std::string& name, auto&& insert, auto&& contains, auto&& scan) {
+        double insertMs = MeasureMilliseconds([&] {
+            for (const std::string& word : words) {
+                insert(word);
+            }
+        });
+        double lookupMs = MeasureMilliseconds([&] {
+            for (const std::string& probe : probes) {
+                hits += contains(probe);
+            }
+        });
+        double scanMs = MeasureMilliseconds([&] { checksum += static_cast<long long>(scan()); });
+        report.rows.push_back({
+            name, "string", "-", "-",
+            NanosPerOp(insertMs, words.size()), NanosPerOp(lookupMs, probes.size()), "-",
+            NanosPerOp(scanMs, words.size())
+        });
+        report.totalMilliseconds += insertMs + lookupMs + scanMs;
+        report.totalOperations += static_cast<long long>(2 * words.size() + probes.size());
+    };
+
+    {
+        AdaptiveRadixTree art;
+        runStrings("Adaptive Radix Tree", [&](const std::string& word) { art.InsertString(word); },
+                   [&](const std::string& probe) { return art.ContainsString(probe); },
+                   [&] {
+                       size_t bytes = 0;
+                       art.ForEach([&](std::string_view key) { bytes += key.size(); });
+                       return bytes;
+                   });
+        report.rows.back()[2] = std::to_string(art.Height());
+        report.notes.push_back(describeNodes(art, "string"));
+    }
+    {
+        std::set<std::string> set;
+        runStrings("std::set", [&](const std::string& word) { set.insert(word); },
+                   [&](const std::string& probe) { return set.count(probe) > 0; },
+                   [&] {
+                       size_t bytes = 0;
+                       for (const std::string& word : set) {
+                           bytes += word.size();
+                       }
+                       return bytes;
+                   });
+    }
+
+    report.notes.push_back(fmt::format("Node16 search kernel: {}", AdaptiveRadixTree::SearchKernelName()));
+    report.notes.push_back("Nodes/lookup counts inner nodes and leaves for ART and B+tree, key comparisons for AVL/RB.");
+    report.notes.push_back("Dense keys come from [0, 2n); sparse keys are the same keys spread over the whole int range.");
+    report.notes.push_back(fmt::format("Lookups hit {} times, range scans returned {} keys (checksum {})",
+                                       hits, scanned, checksum));
+    return report;
+}
+
+BenchmarkReport RunRangeQueryBenchmark(const RangeQueryBenchmarkConfig& config) {
+    BenchmarkReport report;
+    report.title = fmt::format("Range queries ({} elements, {} range adds, {} queries)",
+                               config.elementCount, config.updateCount, config.queryCount);
+    report.columns = {"Structure", "Build ms", "Range add ns/op", "Sum queries/s", "Batch sum queries/s",
+                      "Batch min queries/s", "Nodes/query"};
+
+    if (config.elementCount <= 0 || config.queryCount <= 0) {
+        report.notes.push_back("Nothing to run: element and query counts must be positive");
+        return report;
+    }
+
+    std::mt19937 rng(config.seed);
+    std::uniform_int_distribution<int> valueDist(-1000, 1000);
+    std::uniform_int_distribution<int> indexDist(0, config.elementCount - 1);
+    auto randomRange = [&] {
+        int left = indexDist(rng);
+        int right = indexDist(rng);
+        return RangeQuery{ std::min(left, right), std::max(left, right) };
+    };
+
+    std::vector<int64_t> values(config.elementCount);
+    for (int64_t& value : values) {
+        value = valueDist(rng);
+    }
+    struct Update {
+        RangeQuery range;
+        int64_t delta;
+    };
+    std::vector<Update> updates(config.updateCount);
+    for (Update& update : updates) {
+        update = { randomRange(), valueDist(rng) };
+    }
+    std::vector<RangeQuery> queries(config.queryCount);
+    for (RangeQuery& query : queries) {
+        query = randomRange();
+    }
+
+    // The scan costs O(length) per query, so it only answers a prefix of the batch
+    const size_t naiveQueries = std::min<size_t>(queries.size(), std::max(config.naiveQueryCount, 1));
+    std::vector<RangeQuery> naiveBatch(queries.begin(), queries.begin() + naiveQueries);
+    std::vector<int64_t> expectedSums;
+    std::vector<int64_t> expectedMins;
+    {
+        std::vector<int64_t> array;
+        double buildMs = MeasureMilliseconds([&] { array = values; });
+        double updateMs = MeasureMilliseconds([&] {
+            for (const Update& update : updates) {
+                for (int i = update.range.left; i <= update.range.right; ++i) {
+                    array[i] += update.delta;
+                }
+            }
+        });
+        double sumMs = MeasureMilliseconds([&] {
+            for (const RangeQuery& query : naiveBatch) {
+                expectedSums.push_back(std::accumulate(array.begin() + query.left, array.begin() + query.right + 1,
+                                                       int64_t{0}));
+            }
+        });
+        double minMs = MeasureMilliseconds([&] {
+            for (const RangeQuery& query : naiveBatch) {
+                expectedMins.push_back(*std::min_element(array.begin() + query.left, array.begin() + query.right + 1));
+            }
+        });
+        report.rows.push_back({
+            "Naive prefix scan", fmt::format("{:.2f}", buildMs), NanosPerOp(updateMs, updates.size()),
+            PerSecond(sumMs, naiveQueries), PerSecond(sumMs, naiveQueries), PerSecond(minMs, naiveQueries),
+            fmt::format("{:.0f}", static_cast<double>(config.elementCount) / 3)
+        });
+        report.totalMilliseconds += buildMs + updateMs + sumMs + minMs;
+        report.totalOperations += static_cast<long long>(updates.size() + 2 * naiveQueries);
+    }
+
+    bool agree = true;
+    auto check = [&](const std::vector<int64_t>& results, const std::vector<int64_t>& expected) {
+        agree = agree && std::equal(expected.begin(), expected.end(), results.begin());
+    };
+
+    {
+        FenwickTree fenwick;
+        double buildMs = MeasureMilliseconds([&] { fenwick.Assign(values); });
+        double updateMs = MeasureMilliseconds([&] {
+            for (const Update& update : updates) {
+                fenwick.RangeAdd(update.range.left, update.range.right, update.delta);
+            }
+        });
+        fenwick.ResetStats();
+        int64_t checksum = 0;
+        double sumMs = MeasureMilliseconds([&] {
+            for (const RangeQuery& query : queries) {
+                checksum += fenwick.RangeSum(query.left, query.right);
+            }
+        });
+        const uint64_t touched = fenwick.GetStats().nodesTouched;
+        std::vector<int64_t> sums;
+        double batchMs = MeasureMilliseconds([&] { sums = fenwick.SumBatch(queries); });
+        check(sums, expectedSums);
+        agree = agree && checksum == std::accumulate(sums.begin(), sums.end(), int64_t{0});
+        report.rows.push_back({
+            "Fenwick tree", fmt::format("{:.2f}", buildMs), NanosPerOp(updateMs, updates.size()),
+            PerSecond(sumMs, queries.size()), PerSecond(batchMs, queries.size()), "-",
+            fmt::format("{:.1f}", static_cast<double>(touched) / queries.size())
+        });
+        report.totalMilliseconds += buildMs + updateMs + sumMs + batchMs;
+        report.totalOperations += static_cast<long long>(updates.size() + 2 * queries.size());
+    }
+
+    {
+        SegmentTree segment;
+        double buildMs = MeasureMilliseconds([&] { segment.Assign(values); });
+        double updateMs = MeasureMilliseconds([&] {
+            for (const Update& update : updates) {
+                segment.RangeAdd(update.range.left, update.range.right, update.delta);
+            }
+        });
+        segment.ResetStats();
+        int64_t checksum = 0;
+        double sumMs = MeasureMilliseconds([&] {
+            for (const RangeQuery& query : queries) {
+                checksum += segment.RangeSum(query.left, query.right);
+            }
+        });
+        const SegmentTree::Stats stats = segment.GetStats();
+        std::vector<int64_t> sums;
+        std::vector<int64_t> mins;
+        double batchMs = MeasureMilliseconds([&] { sums = segment.SumBatch(queries); });
+        double minMs = MeasureMilliseconds([&] { mins = segment.MinBatch(queries); });
+        check(sums, expectedSums);
+        agree = agree && checksum == std::accumulate(sums.begin(), sums.end(), int64_t{0});
+        check(mins, expectedMins);
+        report.rows.push_back({
+            "Segment tree (lazy)", fmt::format("{:.2f}", buildMs), NanosPerOp(updateMs, updates.size()),
+            PerSecond(sumMs, queries.size()), PerSecond(batchMs, queries.size()), PerSecond(minMs, queries.size()),
+            fmt::format("{:.1f}", static_cast<double>(stats.nodesTouched) / queries.size())
+        });
+        report.notes.push_back(fmt::format("Segment tree: {} leaves, height {}, {} lazy pushes during single queries",
+                                           segment.Leaves(), segment.Height(), stats.pushes));
+        report.totalMilliseconds += buildMs + updateMs + sumMs + batchMs + minMs;
+        report.totalOperations += static_cast<long long>(updates.size() + 3 * queries.size());
+    }
+
+    report.notes.push_back(fmt::format("Naive scan answered the first {} queries only; its nodes/query is the mean range length",
+                                       naiveQueries));
+    report.notes.push_back("Batches push every pending add once up front, so the query loop never checks lazy tags.");
+    report.notes.push_back(agree ? "Single and batched results agree with each other and with the naive scan"
+                                 : "MISMATCH between single, batched or naive results");
+    return report;
+}
+
+BenchmarkReport RunOrderStatisticBenchmark(const OrderStatisticBenchmarkConfig& config) {
+    BenchmarkReport report;
+    report.title = fmt::format("Order statistics ({} keys, {} queries of each kind)", config.keyCount,
+                               config.queryCount);
+    report.columns = {"Structure", "Method", "Select ns/op", "Rank ns/op", "Count ns/op", "Comparisons/query"};
+
+    if (config.keyCount <= 0 || config.queryCount <= 0) {
+        report.notes.push_back("Nothing to run: key and query counts must be positive");
+        return report;
+    }
+
+    const KeyWorkload workload = MakeKeyWorkload(config.keyCount, config.queryCount, config.seed);
+    std::mt19937 rng(config.seed + 1);
+    std::uniform_int_distribution<size_t> rankDist(0, static_cast<size_t>(config.keyCount) - 1);
+    std::vector<size_t> ranks(config.queryCount);
+    for (size_t& rank : ranks) {
+        rank = rankDist(rng);
+    }
+    std::vector<std::pair<int, int>> ranges;
+    for (int i = 0; i < config.queryCount; ++i) {
+        ranges.push_back(workload.ranges[i % workload.ranges.size()]);
+    }
+
+    // The traversal answers a query by materializing the sorted keys, so it gets a sample only
+    const size_t naiveQueries = std::min<size_t>(ranks.size(), std::max(config.naiveQueryCount, 1));
+    bool agree = true;
+    long long checksum = 0;
+
+    auto runTree = [&](auto& tree, const std::string& name) {
+        for (int key : workload.inserts) {
+            tree.Insert(key);
+        }
+
+        tree.ResetStats();
+        double selectMs = MeasureMilliseconds([&] {
+            for (size_t rank : ranks) {
+                checksum += tree.Select(rank).value_or(0);
+            }
+        });
+        double rankMs = MeasureMilliseconds([&] {
+            for (int key : workload.lookups) {
+                checksum += static_cast<long long>(tree.Rank(key));
+            }
+        });
+        double countMs = MeasureMilliseconds([&] {
+            for (const auto& [low, high] : ranges) {
+                checksum += static_cast<long long>(tree.CountRange(low, high));
+            }
+        });
+        const size_t queries = ranks.size() + workload.lookups.size() + ranges.size();
+        report.rows.push_back({
+            name, "Subtree sizes", NanosPerOp(selectMs, ranks.size()), NanosPerOp(rankMs, workload.lookups.size()),
+            NanosPerOp(countMs, ranges.size()),
+            fmt::format("{:.1f}", static_cast<double>(tree.GetStats().comparisons) / queries)
+        });
+
+        double naiveSelectMs = MeasureMilliseconds([&] {
+            for (size_t i = 0; i < naiveQueries; ++i) {
+                std::vector<int> keys = tree.Keys();
+                agree = agree && tree.Select(ranks[i]) == keys[ranks[i]];
+            }
+        });
+        double naiveRankMs = MeasureMilliseconds([&] {
+            for (size_t i = 0; i < naiveQueries; ++i) {
+                std::vector<int> keys = tree.Keys();
+                const size_t rank = std::lower_bound(keys.begin(), keys.end(), workload.lookups[i]) - keys.begin();
+                agree = agree && rank == tree.Rank(workload.lookups[i]);
+            }
+        });
+        double naiveCountMs = MeasureMilliseconds([&] {
+            for (size_t i = 0; i < naiveQueries; ++i) {
+                std::vector<int> keys = tree.Keys();
+                const auto [low, high] = ranges[i];
+                const size_t count = std::upper_bound(keys.begin(), keys.end(), high) -
+                                     std::lower_bound(keys.begin(), keys.end(), low);
+                agree = agree && count == tree.CountRange(low, high);
+            }
+        });
+        report.rows.push_back({
+            name, "In-order traversal", NanosPerOp(naiveSelectMs, naiveQueries), NanosPerOp(naiveRankMs, naiveQueries),
+            NanosPerOp(naiveCountMs, naiveQueries), std::to_string(tree.Size())
+        });
+
+        report.totalMilliseconds += selectMs + rankMs + countMs + naiveSelectMs + naiveRankMs + naiveCountMs;
+        report.totalOperations += static_cast<long long>(queries + 3 * naiveQueries);
+    };
+
+    AVLTree avl;
+    runTree(avl, "AVL Tree");
+    RedBlackTree redBlack;
+    runTree(redBlack, "Red-Black Tree");
+
+    report.notes.push_back(fmt::format("The in-order traversal rows ran {} queries each (one full walk per query); "
+                                       "its last column is keys visited", naiveQueries));
+    report.notes.push_back(agree ? "Subtree-size answers match the traversal"
+                                 : "MISMATCH between subtree-size answers and the traversal");
+    report.notes.push_back(fmt::format("Checksum {}", checksum));
+    return report;
+}
+
+BenchmarkReport RunStaticLayoutBenchmark(const StaticLayoutBenchmarkConfig& config) {
+    BenchmarkReport report;
+    report.title = fmt::format("Static search layouts ({} lookups per size)", config.lookupCount);
+    report.columns = {"Keys", "Key array", "AVL ns/lookup", "Sorted ns/lookup", "BFS ns/lookup", "vEB ns/lookup",
+                      "vEB vs sorted"};
+
+    if (config.maxKeyCount < config.minKeyCount || config.minKeyCount <= 0 || config.lookupCount <= 0) {
+        report.notes.push_back("Nothing to run: need 0 < minKeyCount <= maxKeyCount and a positive lookup count");
+        return report;
+    }
+
+    // Each size is 8x the previous, so consecutive rows straddle L1, L2, L3 and main memory; the
+    // default maximum is 64 MB of keys, padded to 128 MB, well beyond any last-level cache
+    std::vector<int> sizes;
+    for (long long size = config.minKeyCount; size <= config.maxKeyCount; size *= 8) {
+        sizes.push_back(static_cast<int>(size));
+    }
+    if (sizes.back() != config.maxKeyCount) {
+        sizes.push_back(config.maxKeyCount);
+    }
+
+    std::mt19937 rng(config.seed);
+    bool agree = true;
+    size_t largestLayoutBytes = 0;
+    for (int size : sizes) {
+        // Even keys; lookups over [0, 2n) so about half of them hit
+        std::vector<int> keys(size);
+        for (int i = 0; i < size; ++i) {
+            keys[i] = 2 * i;
+        }
+        std::uniform_int_distribution<int> lookupDist(0, 2 * size - 1);
+        std::vector<int> lookups(config.lookupCount);
+        for (int& key : lookups) {
+            key = lookupDist(rng);
+        }
+
+        // Keys are the even numbers below 2n, so exactly the even lookups hit
+        const auto expectedHits = static_cast<size_t>(
+            std::count_if(lookups.begin(), lookups.end(), [](int key) { return key % 2 == 0; }));
+        
+        double avlMs = 0.0;
+        const bool runAvl = size <= config.maxAvlKeyCount;
+        if (runAvl) {
+            AVLTree avl;
+            std::vector<int> shuffled = keys;
+            std::shuffle(shuffled.begin(), shuffled.end(), rng);
+            for (int key : shuffled) {
+                avl.Insert(key);
+            }
+            size_t hits = 0;
+            avlMs = MeasureMilliseconds([&] {
+                for (int key : lookups) {
+                    hits += avl.Contains(key);
+                }
+            });
+            agree = agree && hits == expectedHits;
+        }
+
+        std::vector<std::string> row = { std::to_string(size), FormatBytes(keys.size() * sizeof(int)),
+                                         runAvl ? NanosPerOp(avlMs, lookups.size()) : "-" };
+        using Layout = StaticSearchTree::Layout;
+        constexpr std::array<Layout, 3> layouts = { Layout::Sorted, Layout::Breadth, Layout::VanEmdeBoas };
+        std::array<double, layouts.size()> layoutMs{}; // Indexed by layout
+        for (Layout layout : layouts) {
+            StaticSearchTree tree(keys, layout);
+            largestLayoutBytes = std::max(largestLayoutBytes, tree.MemoryBytes());
+            size_t hits = 0;
+            double milliseconds = MeasureMilliseconds([&] {
+                for (int key : lookups) {
+                    hits += tree.Contains(key);
+                }
+            });
+            agree = agree && hits == expectedHits;
+            row.push_back(NanosPerOp(milliseconds, lookups.size()));
+            layoutMs[static_cast<size_t>(layout)] = milliseconds;
+            report.totalMilliseconds += milliseconds;
+        }
+        const double sortedMs = layoutMs[static_cast<size_t>(Layout::Sorted)];
+        const double vebMs = layoutMs[static_cast<size_t>(Layout::VanEmdeBoas)];
+        row.push_back(vebMs > 0.0 ? fmt::format("{:.2f}x", sortedMs / vebMs) : "-");
+        report.rows.push_back(std::move(row));
+        report.totalMilliseconds += avlMs;
+        report.totalOperations += static_cast<long long>(layouts.size() + (runAvl ? 1 : 0)) * config.lookupCount;
+    }
+
+    report.notes.push_back("Sorted, BFS and vEB hold the same implicit perfect tree, padded to 2^h - 1 slots.");
+    report.notes.push_back("The sorted array is bisected; BFS and vEB walk from the root, vEB keeping each "
+                           "subtree of about sqrt(n) nodes contiguous.");
+    report.notes.push_back(fmt::format("Largest working set: {} of keys, {} per padded layout.",
+                                       FormatBytes(static_cast<size_t>(sizes.back()) * sizeof(int)),
+                                       FormatBytes(largestLayoutBytes)));
+    if (sizes.back() > config.maxAvlKeyCount) {
+        report.notes.push_back(fmt::format("AVL is skipped above {} keys to bound its memory.", config.maxAvlKeyCount));
+    }
+    report.notes.push_back(agree ? "Every structure found exactly the keys present on every lookup"
+                                 : "MISMATCH between a structure and the keys present");
+    return report;
+}
+
+BenchmarkReport RunStringTrieBenchmark(const StringTrieBenchmarkConfig& config) {
+    BenchmarkReport report;
+    report.columns = {"Structure", "Bytes/key", "Build ms", "Lookups/sec", "Prefix scans/sec", "Prefix keys/sec",
+                      "Hits"};
+
+    std::mt19937 rng(config.seed);
+    std::vector<std::string> words;
+    std::string source = fmt::format("{} synthetic words", config.keyCount);
+    if (!config.dictionaryPath.empty()) {
+        std::ifstream input(config.dictionaryPath);
+        std::string line;
+        while (std::getline(input, line)) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            if (!line.empty()) {
+                words.push_back(std::move(line));
+            }
+        }
+        std::sort(words.begin(), words.end());
+        words.erase(std::unique(words.begin(), words.end()), words.end());
+        if (words.empty()) {
+            report.notes.push_back(fmt::format("Could not read any words from {}; using synthetic words",
+                                               config.dictionaryPath));
+        } else {
+            source = fmt::format("{} words from {}", words.size(), config.dictionaryPath);
+        }
+    }
+    if (words.empty()) {
+        words = MakeSyllableWords(config.keyCount, rng);
+    }
+    std::shuffle(words.begin(), words.end(), rng);
+    report.title = fmt::format("String keys ({}, {} lookups)", source, config.lookupCount);
+    if (words.empty() || config.lookupCount <= 0) {
+        report.notes.push_back("Nothing to run: no keys or no lookups");
+        return report;
+    }
+
+    // Half the lookups hit; the misses extend a stored word, so they share its whole path
+    std::uniform_int_distribution<size_t> pick(0, words.size() - 1);
+    std::vector<std::string> lookups;
+    lookups.reserve(config.lookupCount);
+    for (int i = 0; i < config.lookupCount; ++i) {
+        const std::string& word = words[pick(rng)];
+        lookups.push_back(i % 2 == 0 ? word : word + "~");
+    }
+    std::vector<std::string> prefixes;
+    prefixes.reserve(config.prefixQueryCount);
+    for (int i = 0; i < config.prefixQueryCount; ++i) {
+        const std::string& word = words[pick(rng)];
+        prefixes.push_back(word.substr(0, std::min<size_t>(3, word.size())));
+    }
+
+    size_t keyBytes = 0;
+    for (const std::string& word : words) {
+        keyBytes += word.size();
+    }
+    const double keyCount = static_cast<double>(words.size());
+    // A negative prefixMs marks a structure without ordered prefix scans
+    auto addRow = [&](const std::string& name, size_t bytes, double buildMs, double lookupMs, double prefixMs,
+                      size_t matches, size_t hits) {
+        const bool scanned = prefixMs >= 0.0;
+        report.rows.push_back({
+            name, fmt::format("{:.1f}", bytes / keyCount), fmt::format("{:.2f}", buildMs),
+            PerSecond(lookupMs, lookups.size()), scanned ? fmt::format("{:.0f}", prefixes.size() * 1.0e3 / prefixMs) : "-",
+            scanned ? PerSecond(prefixMs, matches) : "-", std::to_string(hits)
+        });
+        report.totalMilliseconds += buildMs + lookupMs + std::max(prefixMs, 0.0);
+        report.totalOperations += static_cast<long long>(words.size() + lookups.size() +
+                                                         (prefixMs < 0.0 ? 0 : prefixes.size()));
+    };
+
+    size_t expectedMatches = 0;
+    bool agree = true;
+    for (auto layout : { PatriciaTrie::ChildLayout::SortedArray, PatriciaTrie::ChildLayout::Table256 }) {
+        PatriciaTrie trie(layout);
+        double buildMs = MeasureMilliseconds([&] {
+            for (const std::string& word : words) {
+                trie.Insert(word);
+            }
+        });
+        size_t hits = 0;
+        double lookupMs = MeasureMilliseconds([&] {
+            for (const std::string& key : lookups) {
+                hits += trie.Contains(key);
+            }
+        });
+        size_t matches = 0;
+        double prefixMs = MeasureMilliseconds([&] {
+            for (const std::string& prefix : prefixes) {
+                trie.ForEachWithPrefix(prefix, [&](std::string_view) { matches++; });
+            }
+        });
+        agree = agree && (expectedMatches == 0 || matches == expectedMatches);
+        expectedMatches = matches;
+        addRow(fmt::format("Patricia trie, {}", PatriciaTrie::LayoutName(layout)), trie.MemoryBytes(), buildMs,
+               lookupMs, prefixMs, matches, hits);
+        if (layout == PatriciaTrie::ChildLayout::SortedArray) {
+            report.notes.push_back(fmt::format("Trie: {} nodes for {} keys, height {}, {:.1f} nodes visited per lookup",
+                                               trie.NodeCount(), trie.Size(), trie.Height(),
+                                               static_cast<double>(trie.GetStats().nodesVisited) / lookups.size()));
+        }
+    }
+
+    {
+        std::vector<std::string> sorted;
+        double buildMs = MeasureMilliseconds([&] {
+            sorted = words;
+            std::sort(sorted.begin(), sorted.end());
+        });
+        size_t bytes = sorted.capacity() * sizeof(std::string);
+        for (const std::string& word : sorted) {
+            bytes += StringHeapBytes(word);
+        }
+        size_t hits = 0;
+        double lookupMs = MeasureMilliseconds([&] {
+            for (const std::string& key : lookups) {
+                hits += std::binary_search(sorted.begin(), sorted.end(), key);
+            }
+        });
+        size_t matches = 0;
+        double prefixMs = MeasureMilliseconds([&] {
+            for (const std::string& prefix : prefixes) {
+                for (auto it = std::lower_bound(sorted.begin(), sorted.end(), prefix);
+                     it != sorted.end() && it->compare(0, prefix.size(), prefix) == 0; ++it) {
+                    matches++;
+                }
+            }
+        });
+        agree = agree && matches == expectedMatches;
+        addRow("Sorted vector<string>", bytes, buildMs, lookupMs, prefixMs, matches, hits);
+    }
+
+    {
+        std::unordered_set<std::string> hashed;
+        double buildMs = MeasureMilliseconds([&] {
+            for (const std::string& word : words) {
+                hashed.insert(word);
+            }
+        });
+        // libstdc++ nodes hold a next pointer, the string and its cached hash
+        size_t bytes = hashed.bucket_count() * sizeof(void*) +
+                       hashed.size() * (sizeof(void*) + sizeof(std::string) + sizeof(size_t));
+        for (const std::string& word : hashed) {
+            bytes += StringHeapBytes(word);
+        }
+        size_t hits = 0;
+        double lookupMs = MeasureMilliseconds([&] {
+            for (const std::string& key : lookups) {
+                hits += hashed.count(key);
+            }
+        });
+        addRow("unordered_set<string>", bytes, buildMs, lookupMs, -1.0, 0, hits);
+    }
+
+    report.notes.push_back(fmt::format("Raw key bytes: {:.1f} per key", keyBytes / keyCount));
+    report.notes.push_back("Prefix scans count the keys under the first 3 bytes of a stored word; "
+                           "a hash set cannot answer them without a full scan.");
+    report.notes.push_back("Bytes/key excludes allocator headers; the hash set figure assumes the libstdc++ node layout.");
+    report.notes.push_back(agree ? "Prefix scan counts agree across structures" : "MISMATCH in prefix scan counts");
+    return report;
+}
+
+} // namespace AlgorithmVisualizer
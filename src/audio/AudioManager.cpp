@@ -1,4 +1,8 @@
 #include "audio/AudioManager.h"
+#include "audio/OfflineBackends.h"
+#include "audio/OpenALBackend.h"
+#include "audio/Synth.h"
+#include "utils/Profiler.h"
 #include <fmt/core.h>
 #include <cmath>
 #include <algorithm>
@@ -12,505 +16,363 @@ AudioManager::~AudioManager() {
     Shutdown();
 }
 
-bool AudioManager::Initialize() {
+bool AudioManager::Initialize(BackendType backend, const std::string& outputPath) {
     if (m_initialized) {
         return true;
     }
     
-    // Open the default device
-    m_device = alcOpenDevice(nullptr);
-    if (!m_device) {
-        fmt::print("Failed to open OpenAL device\n");
-        return false;
-    }
-    
-    // Create context
-    m_context = alcCreateContext(m_device, nullptr);
-    if (!m_context) {
-        fmt::print("Failed to create OpenAL context\n");
-        alcCloseDevice(m_device);
-        m_device = nullptr;
-        return false;
-    }
-    
-    // Make context current
-    if (!alcMakeContextCurrent(m_context)) {
-        fmt::print("Failed to make OpenAL context current\n");
-        alcDestroyContext(m_context);
-        alcCloseDevice(m_device);
-        m_context = nullptr;
-        m_device = nullptr;
-        return false;
+    m_backend = CreateBackend(backend, outputPath);
+    if (!m_backend->Open(SAMPLE_RATE)) {
+        if (backend != BackendType::OpenAL) {
+            m_backend.reset();
+            return false;
+        }
+        // No sound device: keep the audio path running, silently
+        fmt::print("No OpenAL device, continuing without sound output\n");
+        backend = BackendType::Null;
+        m_backend = CreateBackend(backend, outputPath);
+        m_backend->Open(SAMPLE_RATE);
     }
+    m_backendType = backend;
     
-    // Generate sound buffers
-    alGenBuffers(1, &m_comparisonBuffer);
-    alGenBuffers(1, &m_swapBuffer);
-    alGenBuffers(1, &m_completionBuffer);
-    alGenBuffers(1, &m_errorBuffer);
-    
-    if (!CheckALError("Generate buffers")) {
-        Shutdown();
+    // Pre-generate sounds
+    LoadClips();
+    if (!m_backend->Start()) {
+        m_backend->Close();
+        m_backend.reset();
         return false;
     }
     
-    // Generate sound sources
-    m_sources.resize(MAX_SOURCES);
-    alGenSources(static_cast<ALsizei>(MAX_SOURCES), m_sources.data());
+    m_coalescer.SetMaxEventsPerSecond(m_maxEventsPerSecond);
+    m_initialized = true;
+    m_lastFlush = std::chrono::steady_clock::now();
     
-    if (!CheckALError("Generate sources")) {
-        Shutdown();
-        return false;
+    // A live device gets its own thread; offline backends are pumped by the caller
+    if (m_backendType == BackendType::OpenAL) {
+        m_workerRunning.store(true, std::memory_order_release);
+        m_worker = std::thread(&AudioManager::WorkerLoop, this);
     }
-    
-    // Pre-generate sounds
-    GenerateBeepBuffer(m_comparisonBuffer, 800.0f, 0.1f);
-    GenerateClickBuffer(m_swapBuffer);
-    GenerateSuccessBuffer(m_completionBuffer);
-    GenerateBeepBuffer(m_errorBuffer, 200.0f, 0.3f);
-    
-    // Set listener properties
-    alListener3f(AL_POSITION, 0.0f, 0.0f, 1.0f);
-    alListener3f(AL_VELOCITY, 0.0f, 0.0f, 0.0f);
-    ALfloat listenerOri[] = { 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f };
-    alListenerfv(AL_ORIENTATION, listenerOri);
-    
-    m_initialized = true;
-    fmt::print("AudioManager initialized successfully\n");
+    fmt::print("AudioManager initialized successfully ({} backend)\n", m_backend->GetName());
     return true;
 }
 
-void AudioManager::Shutdown() {
+bool AudioManager::Shutdown() {
     if (!m_initialized) {
-        return;
+        return true;
     }
     
-    CleanupSources();
-    CleanupBuffers();
-    
-    if (m_context) {
-        alcMakeContextCurrent(nullptr);
-        alcDestroyContext(m_context);
-        m_context = nullptr;
+    m_workerRunning.store(false, std::memory_order_release);
+    if (m_worker.joinable()) {
+        m_worker.join();
     }
     
-    if (m_device) {
-        alcCloseDevice(m_device);
-        m_device = nullptr;
+    const bool closed = m_backend->Close();
+    m_backend.reset();
+    m_coalescer.Clear();
+    Command stale;
+    while (m_commands.TryPop(stale)) {
     }
     
     m_initialized = false;
     fmt::print("AudioManager shut down\n");
+    return closed;
 }
 
 void AudioManager::PlayComparisonSound(float pitch) {
-    if (!m_enabled || !m_initialized) return;
-    
-    ALuint source = GetAvailableSource();
-    if (source == 0) return;
-    
-    alSourcef(source, AL_PITCH, pitch);
-    alSourcef(source, AL_GAIN, m_masterVolume * 0.3f);
-    alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
-    alSource3f(source, AL_VELOCITY, 0.0f, 0.0f, 0.0f);
-    alSourcei(source, AL_LOOPING, AL_FALSE);
-    alSourcei(source, AL_BUFFER, m_comparisonBuffer);
-    
-    alSourcePlay(source);
-    CheckALError("Play comparison sound");
+    Play(CLIP_COMPARISON, pitch, 0.3f);
 }
 
 void AudioManager::PlaySwapSound() {
-    if (!m_enabled || !m_initialized) return;
-    
-    ALuint source = GetAvailableSource();
-    if (source == 0) return;
-    
-    alSourcef(source, AL_PITCH, 1.0f);
-    alSourcef(source, AL_GAIN, m_masterVolume * 0.5f);
-    alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
-    alSource3f(source, AL_VELOCITY, 0.0f, 0.0f, 0.0f);
-    alSourcei(source, AL_LOOPING, AL_FALSE);
-    alSourcei(source, AL_BUFFER, m_swapBuffer);
-    
-    alSourcePlay(source);
-    CheckALError("Play swap sound");
+    Play(CLIP_SWAP, 1.0f, 0.5f);
 }
 
 void AudioManager::PlayCompletionSound() {
-    if (!m_enabled || !m_initialized) return;
-    
-    ALuint source = GetAvailableSource();
-    if (source == 0) return;
-    
-    alSourcef(source, AL_PITCH, 1.0f);
-    alSourcef(source, AL_GAIN, m_masterVolume * 0.7f);
-    alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
-    alSource3f(source, AL_VELOCITY, 0.0f, 0.0f, 0.0f);
-    alSourcei(source, AL_LOOPING, AL_FALSE);
-    alSourcei(source, AL_BUFFER, m_completionBuffer);
-    
-    alSourcePlay(source);
-    CheckALError("Play completion sound");
+    Play(CLIP_COMPLETION, 1.0f, 0.7f);
 }
 
 void AudioManager::PlayErrorSound() {
-    if (!m_enabled || !m_initialized) return;
-    
-    ALuint source = GetAvailableSource();
-    if (source == 0) return;
-    
-    alSourcef(source, AL_PITCH, 1.0f);
-    alSourcef(source, AL_GAIN, m_masterVolume * 0.4f);
-    alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
-    alSource3f(source, AL_VELOCITY, 0.0f, 0.0f, 0.0f);
-    alSourcei(source, AL_LOOPING, AL_FALSE);
-    alSourcei(source, AL_BUFFER, m_errorBuffer);
-    
-    alSourcePlay(source);
-    CheckALError("Play error sound");
+    Play(CLIP_ERROR, 1.0f, 0.4f);
 }
 
-void AudioManager::PlayValueTone(int value, int maxValue, float duration) {
-    if (!m_enabled || !m_initialized) return;
-    
-    // Map value to frequency range (200Hz to 1000Hz)
-    float normalizedValue = static_cast<float>(value) / static_cast<float>(maxValue);
-    float frequency = 200.0f + (normalizedValue * 800.0f);
-    
-    // Create a temporary buffer for this tone
-    ALuint tempBuffer;
-    alGenBuffers(1, &tempBuffer);
-    GenerateToneBuffer(tempBuffer, frequency, duration, 0.2f);
-    
-    ALuint source = GetAvailableSource();
-    if (source == 0) {
-        alDeleteBuffers(1, &tempBuffer);
-        return;
-    }
-    
-    alSourcef(source, AL_PITCH, 1.0f);
-    alSourcef(source, AL_GAIN, m_masterVolume * 0.3f);
-    alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
-    alSource3f(source, AL_VELOCITY, 0.0f, 0.0f, 0.0f);
-    alSourcei(source, AL_LOOPING, AL_FALSE);
-    alSourcei(source, AL_BUFFER, tempBuffer);
+void AudioManager::PlayValueTone(int value, int maxValue) {
+    // Map value linearly onto the bank's frequency range
+    float normalizedValue = maxValue > 0 ? static_cast<float>(value) / static_cast<float>(maxValue) : 0.0f;
+    normalizedValue = std::clamp(normalizedValue, 0.0f, 1.0f);
+    int tone = static_cast<int>(std::lround(normalizedValue * (TONE_BANK_SIZE - 1)));
     
-    alSourcePlay(source);
-    
-    // Note: In a production app, you'd want to track and clean up temp buffers
-    // For simplicity, we'll let them accumulate and clean up on shutdown
-    CheckALError("Play value tone");
+    Play(static_cast<SoftwareMixer::ClipId>(FIRST_TONE_CLIP + tone), 1.0f, 0.3f);
 }
 
 void AudioManager::SetMasterVolume(float volume) {
     m_masterVolume = std::clamp(volume, 0.0f, 1.0f);
 }
 
+// Every style's clips are already loaded, so switching only changes which ids Play
+// submits; the backend, its device and any WAV being written keep running
+void AudioManager::SetSoundStyle(SoundStyle style) {
+    m_soundStyle = style;
+}
+
 void AudioManager::SetEnabled(bool enabled) {
     m_enabled = enabled;
     
-    if (!enabled) {
+    if (!enabled && m_initialized) {
         // Stop all currently playing sounds
-        for (ALuint source : m_sources) {
-            alSourceStop(source);
-        }
+        Submit({Command::Kind::StopAll, {}});
+    }
+}
+
+void AudioManager::SetMaxEventsPerSecond(float rate) {
+    m_maxEventsPerSecond = std::max(rate, 0.0f);
+    if (m_initialized) {
+        Submit({Command::Kind::SetRate, {0, 1.0f, m_maxEventsPerSecond}});
     }
 }
 
+AudioManager::QueueStats AudioManager::GetQueueStats() const {
+    QueueStats stats;
+    stats.depth = m_commands.SizeApprox();
+    stats.capacity = COMMAND_QUEUE_SIZE;
+    stats.dropped = m_droppedCommands.load(std::memory_order_relaxed);
+    stats.processed = m_processedCommands.load(std::memory_order_relaxed);
+    return stats;
+}
+
+EventCoalescer::Stats AudioManager::GetCoalescerStats() const {
+    EventCoalescer::Stats stats;
+    stats.received = m_statsReceived.load(std::memory_order_relaxed);
+    stats.played = m_statsPlayed.load(std::memory_order_relaxed);
+    stats.merged = m_statsMerged.load(std::memory_order_relaxed);
+    stats.rateLimited = m_statsRateLimited.load(std::memory_order_relaxed);
+    return stats;
+}
+
+AudioManager::DeviceStats AudioManager::GetDeviceStats() const {
+    DeviceStats stats;
+    stats.streaming = m_statsStreaming.load(std::memory_order_relaxed);
+    stats.streamUnderruns = m_statsUnderruns.load(std::memory_order_relaxed);
+    stats.sourcesExhausted = m_statsSourcesExhausted.load(std::memory_order_relaxed);
+    return stats;
+}
+
 void AudioManager::Update() {
-    if (!m_initialized) return;
+    if (!m_initialized || m_workerRunning.load(std::memory_order_relaxed)) return;
     
-    // Clean up finished sources (optional optimization)
-    for (ALuint source : m_sources) {
-        ALint sourceState;
-        alGetSourcei(source, AL_SOURCE_STATE, &sourceState);
-        if (sourceState == AL_STOPPED) {
-            alSourcei(source, AL_BUFFER, 0); // Unbind buffer
+    const auto now = std::chrono::steady_clock::now();
+    const double elapsed = std::chrono::duration<double>(now - m_lastFlush).count();
+    m_lastFlush = now;
+    Pump(elapsed);
+}
+
+void AudioManager::Advance(double seconds) {
+    if (!m_initialized || m_workerRunning.load(std::memory_order_relaxed)) return;
+    Pump(seconds);
+}
+
+void AudioManager::Submit(const Command& command) {
+    if (!m_commands.TryPush(command)) {
+        m_droppedCommands.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void AudioManager::Pump(double seconds) {
+    PROFILE_SCOPE("AudioManager::Pump");
+    Command command;
+    uint64_t processed = 0;
+    while (m_commands.TryPop(command)) {
+        processed++;
+        switch (command.kind) {
+        case Command::Kind::Play: {
+            // Tones differ by clip rather than pitch, so the clip id orders them
+            const SoftwareMixer::Event& event = command.event;
+            size_t family = FAMILY_TONE;
+            float key = static_cast<float>(event.clip);
+            switch (event.clip % CLIPS_PER_STYLE) {
+            case CLIP_COMPARISON: family = FAMILY_COMPARISON; key = event.pitch; break;
+            case CLIP_SWAP: family = FAMILY_SWAP; key = event.pitch; break;
+            case CLIP_COMPLETION: family = FAMILY_COMPLETION; key = event.pitch; break;
+            case CLIP_ERROR: family = FAMILY_ERROR; key = event.pitch; break;
+            default: break;
+            }
+            m_coalescer.Add(family, event, key);
+            break;
+        }
+        case Command::Kind::StopAll:
+            m_coalescer.Clear();
+            m_backend->StopAll();
+            break;
+        case Command::Kind::SetRate:
+            m_coalescer.SetMaxEventsPerSecond(command.event.gain);
+            break;
         }
     }
+    m_processedCommands.fetch_add(processed, std::memory_order_relaxed);
+    
+    for (const SoftwareMixer::Event& event : m_coalescer.Flush(seconds)) {
+        m_backend->Play(event);
+    }
+    m_backend->Advance(seconds);
+    
+    const EventCoalescer::Stats& stats = m_coalescer.GetStats();
+    m_statsReceived.store(stats.received, std::memory_order_relaxed);
+    m_statsPlayed.store(stats.played, std::memory_order_relaxed);
+    m_statsMerged.store(stats.merged, std::memory_order_relaxed);
+    m_statsRateLimited.store(stats.rateLimited, std::memory_order_relaxed);
+    
+    if (m_backendType == BackendType::OpenAL) {
+        const auto& device = static_cast<const OpenALBackend&>(*m_backend);
+        m_statsStreaming.store(device.GetPlaybackPath() == OpenALBackend::PlaybackPath::Mixer, std::memory_order_relaxed);
+        m_statsUnderruns.store(device.GetStreamStats().underruns, std::memory_order_relaxed);
+        m_statsSourcesExhausted.store(device.GetSourcePoolStats().exhausted, std::memory_order_relaxed);
+    }
 }
 
-ALuint AudioManager::GetAvailableSource() {
-    for (ALuint source : m_sources) {
-        ALint sourceState;
-        alGetSourcei(source, AL_SOURCE_STATE, &sourceState);
-        if (sourceState != AL_PLAYING) {
-            return source;
+// Runs on m_worker: one window per WORKER_PERIOD, on a fixed schedule. After a
+// stall (e.g. the machine slept) the schedule restarts instead of catching up
+void AudioManager::WorkerLoop() {
+    Profiler::SetThreadName("Audio");
+    auto last = std::chrono::steady_clock::now();
+    auto next = last + WORKER_PERIOD;
+    while (m_workerRunning.load(std::memory_order_acquire)) {
+        std::this_thread::sleep_until(next);
+        const auto now = std::chrono::steady_clock::now();
+        next += WORKER_PERIOD;
+        if (next < now) {
+            next = now + WORKER_PERIOD;
         }
+        Pump(std::chrono::duration<double>(now - last).count());
+        last = now;
     }
-    return 0; // No available source
 }
 
-void AudioManager::GenerateToneBuffer(ALuint buffer, float frequency, float duration, float amplitude) {
-    const int sampleRate = 44100;
-    const int samples = static_cast<int>(sampleRate * duration);
-    
-    std::vector<short> data(samples);
+// Only queues the event; it is merged and played when the queue is next drained
+void AudioManager::Play(SoftwareMixer::ClipId clip, float pitch, float gain) {
+    if (!m_enabled || !m_initialized) return;
+    Submit({Command::Kind::Play, {StyleClip(m_soundStyle, clip), pitch, m_masterVolume * gain}});
+}
+
+SoftwareMixer::ClipId AudioManager::StyleClip(SoundStyle style, int clip) {
+    return static_cast<SoftwareMixer::ClipId>(static_cast<int>(style) * CLIPS_PER_STYLE + clip);
+}
+
+std::vector<short> AudioManager::GenerateTone(SoundStyle style, float frequency, float duration, float amplitude) {
+    std::vector<float> data(static_cast<size_t>(SAMPLE_RATE * duration), 0.0f);
     
-    for (int i = 0; i < samples; ++i) {
-        float time = static_cast<float>(i) / static_cast<float>(sampleRate);
-        float sample = amplitude * std::sin(2.0f * M_PI * frequency * time);
-        
-        // Apply envelope to avoid clicks
-        float envelope = 1.0f;
-        if (i < samples * 0.1f) {
-            envelope = static_cast<float>(i) / (samples * 0.1f);
-        } else if (i > samples * 0.9f) {
-            envelope = static_cast<float>(samples - i) / (samples * 0.1f);
-        }
-        
-        sample *= envelope;
-        data[i] = static_cast<short>(sample * 32767.0f);
+    if (style == SoundStyle::Retro) {
+        // Square waves are about twice as loud as a sine of the same amplitude
+        Synth::AddOscillator(data, Synth::Waveform::Square, frequency, amplitude * 0.5f, SAMPLE_RATE);
+    } else {
+        Synth::AddOscillator(data, Synth::Waveform::Sine, frequency, amplitude, SAMPLE_RATE);
     }
     
-    alBufferData(buffer, AL_FORMAT_MONO16, data.data(), 
-                static_cast<ALsizei>(data.size() * sizeof(short)), sampleRate);
+    // Apply envelope to avoid clicks
+    Synth::ApplyFades(data, 0.1f);
+    return Synth::ToPcm16(data);
 }
 
-void AudioManager::GenerateBeepBuffer(ALuint buffer, float frequency, float duration) {
-    GenerateToneBuffer(buffer, frequency, duration, 0.3f);
+std::vector<short> AudioManager::GenerateBeep(SoundStyle style, float frequency, float duration) {
+    return GenerateTone(style, frequency, duration, 0.3f);
 }
 
-void AudioManager::GenerateClickBuffer(ALuint buffer) {
-    const int sampleRate = 44100;
+std::vector<short> AudioManager::GenerateClick(SoundStyle style) {
     const float duration = 0.05f; // 50ms
-    const int samples = static_cast<int>(sampleRate * duration);
-    
-    std::vector<short> data(samples);
+    std::vector<float> data(static_cast<size_t>(SAMPLE_RATE * duration), 0.0f);
     
-    for (int i = 0; i < samples; ++i) {
-        float time = static_cast<float>(i) / static_cast<float>(sampleRate);
-        
+    if (style == SoundStyle::Retro) {
+        // A saw blip with a square an octave up
+        Synth::AddOscillator(data, Synth::Waveform::Saw, 1000.0f, 0.25f, SAMPLE_RATE);
+        Synth::AddOscillator(data, Synth::Waveform::Square, 2000.0f, 0.1f, SAMPLE_RATE);
+    } else {
         // Create a click sound with multiple frequency components
-        float sample = 0.0f;
-        sample += 0.3f * std::sin(2.0f * M_PI * 1000.0f * time);
-        sample += 0.2f * std::sin(2.0f * M_PI * 1500.0f * time);
-        sample += 0.1f * std::sin(2.0f * M_PI * 2000.0f * time);
-        
-        // Sharp envelope for click effect
-        float envelope = std::exp(-time * 20.0f);
-        sample *= envelope;
-        
-        data[i] = static_cast<short>(sample * 32767.0f);
+        Synth::AddOscillator(data, Synth::Waveform::Sine, 1000.0f, 0.3f, SAMPLE_RATE);
+        Synth::AddOscillator(data, Synth::Waveform::Sine, 1500.0f, 0.2f, SAMPLE_RATE);
+        Synth::AddOscillator(data, Synth::Waveform::Sine, 2000.0f, 0.1f, SAMPLE_RATE);
     }
     
-    alBufferData(buffer, AL_FORMAT_MONO16, data.data(), 
-                static_cast<ALsizei>(data.size() * sizeof(short)), sampleRate);
+    // Sharp envelope for click effect
+    Synth::ApplyDecay(data, 20.0f, SAMPLE_RATE);
+    return Synth::ToPcm16(data);
 }
 
-void AudioManager::GenerateSuccessBuffer(ALuint buffer) {
-    const int sampleRate = 44100;
+std::vector<short> AudioManager::GenerateSuccess(SoundStyle style) {
     const float duration = 0.8f;
-    const int samples = static_cast<int>(sampleRate * duration);
-    
-    std::vector<short> data(samples);
+    std::vector<float> data(static_cast<size_t>(SAMPLE_RATE * duration), 0.0f);
     
     // Create a pleasant ascending chord
     float frequencies[] = { 523.25f, 659.25f, 783.99f }; // C5, E5, G5
     
-    for (int i = 0; i < samples; ++i) {
-        float time = static_cast<float>(i) / static_cast<float>(sampleRate);
-        
-        float sample = 0.0f;
-        for (float freq : frequencies) {
-            sample += 0.2f * std::sin(2.0f * M_PI * freq * time);
+    for (float freq : frequencies) {
+        if (style == SoundStyle::Retro) {
+            // Bell-like FM, the classic chip-synth chime
+            Synth::AddFM(data, freq, 3.5f, 1.5f, 0.2f, SAMPLE_RATE);
+        } else {
+            Synth::AddOscillator(data, Synth::Waveform::Sine, freq, 0.2f, SAMPLE_RATE);
         }
-        
-        // Gentle envelope
-        float envelope = std::exp(-time * 2.0f);
-        sample *= envelope;
-        
-        data[i] = static_cast<short>(sample * 32767.0f);
     }
     
-    alBufferData(buffer, AL_FORMAT_MONO16, data.data(), 
-                static_cast<ALsizei>(data.size() * sizeof(short)), sampleRate);
-}
-
-void AudioManager::CleanupBuffers() {
-    if (m_comparisonBuffer) {
-        alDeleteBuffers(1, &m_comparisonBuffer);
-        m_comparisonBuffer = 0;
-    }
-    if (m_swapBuffer) {
-        alDeleteBuffers(1, &m_swapBuffer);
-        m_swapBuffer = 0;
-    }
-    if (m_completionBuffer) {
-        alDeleteBuffers(1, &m_completionBuffer);
-        m_completionBuffer = 0;
-    }
-    if (m_errorBuffer) {
-        alDeleteBuffers(1, &m_errorBuffer);
-        m_errorBuffer = 0;
-    }
+    // Gentle envelope
+    Synth::ApplyDecay(data, 2.0f, SAMPLE_RATE);
+    return Synth::ToPcm16(data);
 }
 
-void AudioManager::CleanupSources() {
-    if (!m_sources.empty()) {
-        // Stop all sources
-        for (ALuint source : m_sources) {
-            alSourceStop(source);
-        }
+// The tone bank holds one clip per pitch step, evenly spaced in frequency like the old per-call tones.
+// Both styles are loaded side by side, so SetSoundStyle never has to reload anything
+void AudioManager::LoadClips() {
+    PROFILE_SCOPE("AudioManager::LoadClips");
+    for (SoundStyle style : { SoundStyle::Classic, SoundStyle::Retro }) {
+        m_backend->LoadClip(StyleClip(style, CLIP_COMPARISON), GenerateBeep(style, 800.0f, 0.1f));
+        m_backend->LoadClip(StyleClip(style, CLIP_SWAP), GenerateClick(style));
+        m_backend->LoadClip(StyleClip(style, CLIP_COMPLETION), GenerateSuccess(style));
+        m_backend->LoadClip(StyleClip(style, CLIP_ERROR), GenerateBeep(style, 200.0f, 0.3f));
         
-        alDeleteSources(static_cast<ALsizei>(m_sources.size()), m_sources.data());
-        m_sources.clear();
-    }
-}
-
-bool AudioManager::CheckALError(const char* operation) {
-    ALenum error = alGetError();
-    if (error != AL_NO_ERROR) {
-        fmt::print("OpenAL error in {}: {}\n", operation, error);
-        return false;
+        for (int tone = 0; tone < TONE_BANK_SIZE; ++tone) {
+            float frequency = TONE_MIN_FREQUENCY +
+                (TONE_MAX_FREQUENCY - TONE_MIN_FREQUENCY) * static_cast<float>(tone) / (TONE_BANK_SIZE - 1);
+            m_backend->LoadClip(StyleClip(style, FIRST_TONE_CLIP + tone),
+                                GenerateTone(style, frequency, TONE_DURATION, 0.2f));
+        }
     }
-    return true;
 }
 
-bool AudioManager::CheckALCError(const char* operation) {
-    ALCenum error = alcGetError(m_device);
-    if (error != ALC_NO_ERROR) {
-        fmt::print("OpenAL context error in {}: {}\n", operation, error);
-        return false;
+std::unique_ptr<AudioBackend> AudioManager::CreateBackend(BackendType type, const std::string& outputPath) {
+    switch (type) {
+    case BackendType::OpenAL: return std::make_unique<OpenALBackend>();
+    case BackendType::Null: return std::make_unique<NullBackend>();
+    case BackendType::WavFile: return std::make_unique<WavFileBackend>(outputPath);
     }
-    return true;
+    return std::make_unique<NullBackend>();
 }
 
 void AudioManager::PlayExploreSound(float pitch) {
-    if (!m_enabled || !m_initialized) return;
-    
-    ALuint source = GetAvailableSource();
-    if (source == 0) return;
-    
-    alSourcef(source, AL_PITCH, pitch * 0.8f);  // Lower pitch for exploration
-    alSourcef(source, AL_GAIN, m_masterVolume * 0.4f);
-    alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
-    alSource3f(source, AL_VELOCITY, 0.0f, 0.0f, 0.0f);
-    alSourcei(source, AL_LOOPING, AL_FALSE);
-    alSourcei(source, AL_BUFFER, m_comparisonBuffer);
-    
-    alSourcePlay(source);
-    CheckALError("Play explore sound");
+    Play(CLIP_COMPARISON, pitch * 0.8f, 0.4f); // Lower pitch for exploration
 }
 
 void AudioManager::PlayFrontierSound(float pitch) {
-    if (!m_enabled || !m_initialized) return;
-    
-    ALuint source = GetAvailableSource();
-    if (source == 0) return;
-    
-    alSourcef(source, AL_PITCH, pitch * 1.2f);  // Higher pitch for frontier
-    alSourcef(source, AL_GAIN, m_masterVolume * 0.3f);
-    alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
-    alSource3f(source, AL_VELOCITY, 0.0f, 0.0f, 0.0f);
-    alSourcei(source, AL_LOOPING, AL_FALSE);
-    alSourcei(source, AL_BUFFER, m_swapBuffer);
-    
-    alSourcePlay(source);
-    CheckALError("Play frontier sound");
+    Play(CLIP_SWAP, pitch * 1.2f, 0.3f); // Higher pitch for frontier
 }
 
 void AudioManager::PlayVisitedSound(float pitch) {
-    if (!m_enabled || !m_initialized) return;
-    
-    ALuint source = GetAvailableSource();
-    if (source == 0) return;
-    
-    alSourcef(source, AL_PITCH, pitch * 0.6f);  // Lower pitch for visited
-    alSourcef(source, AL_GAIN, m_masterVolume * 0.25f);
-    alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
-    alSource3f(source, AL_VELOCITY, 0.0f, 0.0f, 0.0f);
-    alSourcei(source, AL_LOOPING, AL_FALSE);
-    alSourcei(source, AL_BUFFER, m_comparisonBuffer);
-    
-    alSourcePlay(source);
-    CheckALError("Play visited sound");
+    Play(CLIP_COMPARISON, pitch * 0.6f, 0.25f); // Lower pitch for visited
 }
 
 void AudioManager::PlayPathFoundSound() {
-    if (!m_enabled || !m_initialized) return;
-    
-    ALuint source = GetAvailableSource();
-    if (source == 0) return;
-    
-    alSourcef(source, AL_PITCH, 1.2f);
-    alSourcef(source, AL_GAIN, m_masterVolume);
-    alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
-    alSource3f(source, AL_VELOCITY, 0.0f, 0.0f, 0.0f);
-    alSourcei(source, AL_LOOPING, AL_FALSE);
-    alSourcei(source, AL_BUFFER, m_completionBuffer);
-    
-    alSourcePlay(source);
-    CheckALError("Play path found sound");
+    Play(CLIP_COMPLETION, 1.2f, 1.0f);
 }
 
 void AudioManager::PlayNoPathSound() {
-    if (!m_enabled || !m_initialized) return;
-    
-    ALuint source = GetAvailableSource();
-    if (source == 0) return;
-    
-    alSourcef(source, AL_PITCH, 0.5f);
-    alSourcef(source, AL_GAIN, m_masterVolume);
-    alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
-    alSource3f(source, AL_VELOCITY, 0.0f, 0.0f, 0.0f);
-    alSourcei(source, AL_LOOPING, AL_FALSE);
-    alSourcei(source, AL_BUFFER, m_errorBuffer);
-    
-    alSourcePlay(source);
-    CheckALError("Play no path sound");
+    Play(CLIP_ERROR, 0.5f, 1.0f);
 }
 
 void AudioManager::PlayNodeSelectSound() {
-    if (!m_enabled || !m_initialized) return;
-    
-    ALuint source = GetAvailableSource();
-    if (source == 0) return;
-    
-    alSourcef(source, AL_PITCH, 1.5f);
-    alSourcef(source, AL_GAIN, m_masterVolume * 0.7f);
-    alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
-    alSource3f(source, AL_VELOCITY, 0.0f, 0.0f, 0.0f);
-    alSourcei(source, AL_LOOPING, AL_FALSE);
-    alSourcei(source, AL_BUFFER, m_comparisonBuffer);
-    
-    alSourcePlay(source);
-    CheckALError("Play node select sound");
+    Play(CLIP_COMPARISON, 1.5f, 0.7f);
 }
 
 void AudioManager::PlayEdgeAddSound() {
-    if (!m_enabled || !m_initialized) return;
-    
-    ALuint source = GetAvailableSource();
-    if (source == 0) return;
-    
-    alSourcef(source, AL_PITCH, 1.8f);
-    alSourcef(source, AL_GAIN, m_masterVolume * 0.8f);
-    alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
-    alSource3f(source, AL_VELOCITY, 0.0f, 0.0f, 0.0f);
-    alSourcei(source, AL_LOOPING, AL_FALSE);
-    alSourcei(source, AL_BUFFER, m_swapBuffer);
-    
-    alSourcePlay(source);
-    CheckALError("Play edge add sound");
+    Play(CLIP_SWAP, 1.8f, 0.8f);
 }
 
 void AudioManager::PlayMSTCompleteSound() {
-    if (!m_enabled || !m_initialized) return;
-    
-    ALuint source = GetAvailableSource();
-    if (source == 0) return;
-    
-    alSourcef(source, AL_PITCH, 1.0f);
-    alSourcef(source, AL_GAIN, m_masterVolume);
-    alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
-    alSource3f(source, AL_VELOCITY, 0.0f, 0.0f, 0.0f);
-    alSourcei(source, AL_LOOPING, AL_FALSE);
-    alSourcei(source, AL_BUFFER, m_completionBuffer);
-    
-    alSourcePlay(source);
-    CheckALError("Play MST complete sound");
+    Play(CLIP_COMPLETION, 1.0f, 1.0f);
 }
 
 void AudioManager::PlayPathfindingExplore() {
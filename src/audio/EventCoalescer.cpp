@@ -0,0 +1,91 @@
+#include "audio/EventCoalescer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace AlgorithmVisualizer {
+
+namespace {
+constexpr double BURST_SECONDS = 0.1;   // The bucket holds this much of the rate
+constexpr float MAX_DENSITY_GAIN = 2.0f;
+}
+
+EventCoalescer::EventCoalescer(size_t familyCount) : m_windows(familyCount) {
+    m_output.reserve(familyCount * CHORD_SIZE);
+    m_tokens = std::max<double>(m_maxEventsPerSecond * BURST_SECONDS, CHORD_SIZE);
+}
+
+void EventCoalescer::Add(size_t family, const Event& event, float key) {
+    Window& window = m_windows[family];
+    if (window.count == 0 || key < window.lowestKey) {
+        window.lowest = event;
+        window.lowestKey = key;
+    }
+    if (window.count == 0 || key > window.highestKey) {
+        window.highest = event;
+        window.highestKey = key;
+    }
+    window.latest = event;
+    window.count++;
+    m_stats.received++;
+}
+
+const std::vector<EventCoalescer::Event>& EventCoalescer::Flush(double elapsedSeconds) {
+    m_output.clear();
+    const bool limited = m_maxEventsPerSecond > 0.0f;
+    if (limited) {
+        const double burst = std::max<double>(m_maxEventsPerSecond * BURST_SECONDS, CHORD_SIZE);
+        m_tokens = std::min(burst, m_tokens + m_maxEventsPerSecond * elapsedSeconds);
+    }
+
+    for (Window& window : m_windows) {
+        if (window.count == 0) {
+            continue;
+        }
+
+        // Latest first, so it survives when the budget only covers part of the chord
+        Event voices[CHORD_SIZE] = { window.latest, window.lowest, window.highest };
+        size_t voiceCount = 1;
+        for (size_t i = 1; i < CHORD_SIZE; ++i) {
+            const bool duplicate = std::any_of(voices, voices + voiceCount, [&](const Event& e) {
+                return e.clip == voices[i].clip && e.pitch == voices[i].pitch;
+            });
+            if (!duplicate) {
+                voices[voiceCount++] = voices[i];
+            }
+        }
+        voiceCount = std::min<size_t>(voiceCount, window.count);
+
+        size_t allowed = voiceCount;
+        if (limited) {
+            allowed = std::min(voiceCount, static_cast<size_t>(std::max(m_tokens, 0.0)));
+            m_tokens -= static_cast<double>(allowed);
+        }
+
+        // Log-scaled density, shared across the chord so its total stays level
+        const float density = std::min(MAX_DENSITY_GAIN, 1.0f + 0.25f * std::log2(static_cast<float>(window.count)));
+        const float gainScale = density / std::sqrt(static_cast<float>(std::max<size_t>(allowed, 1)));
+        for (size_t i = 0; i < allowed; ++i) {
+            Event voice = voices[i];
+            voice.gain *= gainScale;
+            m_output.push_back(voice);
+        }
+
+        m_stats.played += allowed;
+        m_stats.rateLimited += voiceCount - allowed;
+        m_stats.merged += window.count - voiceCount;
+        window.count = 0;
+    }
+    return m_output;
+}
+
+void EventCoalescer::Clear() {
+    for (Window& window : m_windows) {
+        window.count = 0;
+    }
+}
+
+void EventCoalescer::SetMaxEventsPerSecond(float rate) {
+    m_maxEventsPerSecond = std::max(rate, 0.0f);
+}
+
+} // namespace AlgorithmVisualizer
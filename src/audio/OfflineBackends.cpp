@@ -0,0 +1,133 @@
+#include "audio/OfflineBackends.h"
+#include "utils/Profiler.h"
+#include <fmt/core.h>
+#include <algorithm>
+
+namespace AlgorithmVisualizer {
+
+// Mixer backend
+bool MixerBackend::Open(int sampleRate) {
+    m_mixer = std::make_unique<SoftwareMixer>(sampleRate);
+    m_pendingFrames = 0.0;
+    m_framesRendered = 0;
+    return true;
+}
+
+bool MixerBackend::Close() {
+    m_mixer.reset();
+    return true;
+}
+
+void MixerBackend::LoadClip(SoftwareMixer::ClipId clip, const std::vector<short>& samples) {
+    m_mixer->SetClip(clip, samples);
+}
+
+void MixerBackend::Play(const SoftwareMixer::Event& event) {
+    m_mixer->Post(event);
+}
+
+void MixerBackend::StopAll() {
+    m_mixer->Post({SoftwareMixer::STOP_ALL, 1.0f, 0.0f});
+}
+
+void MixerBackend::Advance(double elapsedSeconds) {
+    PROFILE_SCOPE("MixerBackend::Advance");
+    if (!m_mixer) {
+        return;
+    }
+    m_pendingFrames += elapsedSeconds * m_mixer->SampleRate();
+    auto frames = static_cast<size_t>(m_pendingFrames);
+    m_pendingFrames -= static_cast<double>(frames);
+
+    while (frames > 0) {
+        const size_t count = std::min(frames, BLOCK_FRAMES);
+        m_mixer->Render(m_block.data(), count);
+        WriteBlock(m_block.data(), count);
+        m_framesRendered += count;
+        frames -= count;
+    }
+}
+
+SoftwareMixer::Stats MixerBackend::GetMixerStats() const {
+    return m_mixer ? m_mixer->GetStats() : SoftwareMixer::Stats{};
+}
+
+// WAV file backend
+WavFileBackend::~WavFileBackend() {
+    Close();
+}
+
+bool WavFileBackend::Open(int sampleRate) {
+    m_file.open(m_path, std::ios::binary | std::ios::trunc);
+    if (!m_file) {
+        fmt::print("Failed to open WAV output {}\n", m_path);
+        return false;
+    }
+    m_sampleRate = sampleRate;
+    m_dataBytes = 0;
+    WriteHeader(0); // Placeholder until the length is known
+    return MixerBackend::Open(sampleRate);
+}
+
+bool WavFileBackend::Close() {
+    bool written = true;
+    if (m_file.is_open()) {
+        // RIFF sizes are 32-bit; past 4 GB the header is capped and players read to the end
+        m_file.seekp(0);
+        WriteHeader(static_cast<uint32_t>(std::min<uint64_t>(m_dataBytes, UINT32_MAX - 36)));
+        m_file.close();
+        // The stream stays failed after any lost block, so this covers the data, the header and the flush
+        written = !m_file.fail();
+        if (written) {
+            fmt::print("Wrote {:.1f} s of audio to {}\n",
+                       static_cast<double>(m_dataBytes / sizeof(short)) / m_sampleRate, m_path);
+        } else {
+            fmt::print("Failed to finish WAV output {}\n", m_path);
+        }
+    }
+    MixerBackend::Close();
+    return written;
+}
+
+void WavFileBackend::WriteBlock(const short* samples, size_t frames) {
+    if (m_file.fail()) {
+        return; // Already reported; Close fails the export
+    }
+    // WAV is little-endian; so are the platforms this builds for
+    m_file.write(reinterpret_cast<const char*>(samples), static_cast<std::streamsize>(frames * sizeof(short)));
+    if (m_file.fail()) {
+        fmt::print("Failed to write WAV output {} after {} bytes\n", m_path, m_dataBytes);
+        return;
+    }
+    m_dataBytes += frames * sizeof(short);
+}
+
+void WavFileBackend::WriteHeader(uint32_t dataBytes) {
+    auto put32 = [this](uint32_t value) {
+        const char bytes[4] = { static_cast<char>(value), static_cast<char>(value >> 8),
+                                static_cast<char>(value >> 16), static_cast<char>(value >> 24) };
+        m_file.write(bytes, 4);
+    };
+    auto put16 = [this](uint16_t value) {
+        const char bytes[2] = { static_cast<char>(value), static_cast<char>(value >> 8) };
+        m_file.write(bytes, 2);
+    };
+
+    const uint16_t channels = 1;
+    const uint16_t bitsPerSample = 16;
+    const uint16_t blockAlign = channels * bitsPerSample / 8;
+    m_file.write("RIFF", 4);
+    put32(36 + dataBytes);
+    m_file.write("WAVEfmt ", 8);
+    put32(16); // PCM format chunk size
+    put16(1);  // PCM
+    put16(channels);
+    put32(static_cast<uint32_t>(m_sampleRate));
+    put32(static_cast<uint32_t>(m_sampleRate) * blockAlign);
+    put16(blockAlign);
+    put16(bitsPerSample);
+    m_file.write("data", 4);
+    put32(dataBytes);
+}
+
+} // namespace AlgorithmVisualizer
@@ -0,0 +1,301 @@
+#include "audio/OpenALBackend.h"
+#include "utils/Profiler.h"
+#include <fmt/core.h>
+#include <chrono>
+
+namespace AlgorithmVisualizer {
+
+namespace {
+// A stream block lasts about 11.6 ms, so polling at this rate refills each one well before it is needed
+constexpr std::chrono::milliseconds STREAM_POLL_INTERVAL{3};
+}
+
+OpenALBackend::~OpenALBackend() {
+    Close();
+}
+
+bool OpenALBackend::Open(int sampleRate) {
+    m_sampleRate = sampleRate;
+    
+    // Open the default device
+    m_device = alcOpenDevice(nullptr);
+    if (!m_device) {
+        fmt::print("Failed to open OpenAL device\n");
+        return false;
+    }
+    
+    // Create context
+    m_context = alcCreateContext(m_device, nullptr);
+    if (!m_context) {
+        fmt::print("Failed to create OpenAL context\n");
+        Close();
+        return false;
+    }
+    
+    // Make context current
+    if (!alcMakeContextCurrent(m_context)) {
+        fmt::print("Failed to make OpenAL context current\n");
+        Close();
+        return false;
+    }
+    
+    // Generate sound sources
+    m_sources.resize(MAX_SOURCES);
+    alGenSources(static_cast<ALsizei>(MAX_SOURCES), m_sources.data());
+    
+    if (!CheckALError("Generate sources")) {
+        m_sources.clear();
+        Close();
+        return false;
+    }
+    m_sourcePool.Reset(m_sources);
+    m_mixer = std::make_unique<SoftwareMixer>(sampleRate);
+    
+    // Set listener properties
+    alListener3f(AL_POSITION, 0.0f, 0.0f, 1.0f);
+    alListener3f(AL_VELOCITY, 0.0f, 0.0f, 0.0f);
+    ALfloat listenerOri[] = { 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f };
+    alListenerfv(AL_ORIENTATION, listenerOri);
+    
+    // Mixer stream; without it every sound goes straight to its own source
+    alGenSources(1, &m_streamSource);
+    alGenBuffers(STREAM_BUFFER_COUNT, m_streamBuffers.data());
+    if (CheckALError("Generate mixer stream")) {
+        alSourcei(m_streamSource, AL_LOOPING, AL_FALSE);
+        alSourcef(m_streamSource, AL_GAIN, 1.0f); // Master volume is applied per event
+    } else {
+        CleanupStream();
+    }
+    return true;
+}
+
+bool OpenALBackend::Close() {
+    StopStream();
+    CleanupStream();
+    CleanupSources();
+    CleanupBuffers();
+    m_mixer.reset();
+    m_playbackPath = PlaybackPath::Sources;
+    
+    if (m_context) {
+        alcMakeContextCurrent(nullptr);
+        alcDestroyContext(m_context);
+        m_context = nullptr;
+    }
+    
+    if (m_device) {
+        alcCloseDevice(m_device);
+        m_device = nullptr;
+    }
+    return true;
+}
+
+// Uploads the PCM to the clip's AL buffer and hands it to the mixer
+void OpenALBackend::LoadClip(SoftwareMixer::ClipId clip, const std::vector<short>& samples) {
+    if (clip >= m_buffers.size()) {
+        m_buffers.resize(clip + 1, 0);
+        m_clipSeconds.resize(clip + 1, 0.0f);
+    }
+    if (!m_buffers[clip]) {
+        alGenBuffers(1, &m_buffers[clip]);
+    }
+    alBufferData(m_buffers[clip], AL_FORMAT_MONO16, samples.data(),
+                static_cast<ALsizei>(samples.size() * sizeof(short)), m_sampleRate);
+    m_mixer->SetClip(clip, samples);
+    m_clipSeconds[clip] = static_cast<float>(samples.size()) / static_cast<float>(m_sampleRate);
+}
+
+bool OpenALBackend::Start() {
+    if (!CheckALError("Load clips")) {
+        return false;
+    }
+    SetPlaybackPath(PlaybackPath::Mixer);
+    fmt::print("OpenAL playback on the {} path\n", m_playbackPath == PlaybackPath::Mixer ? "mixer" : "per-source");
+    return true;
+}
+
+void OpenALBackend::Play(const SoftwareMixer::Event& event) {
+    if (m_playbackPath == PlaybackPath::Mixer) {
+        m_mixer->Post(event);
+        return;
+    }
+    
+    const auto duration = std::chrono::duration<float>(m_clipSeconds[event.clip] / event.pitch);
+    ALuint source = m_sourcePool.Acquire(SourcePool::Clock::now(),
+                                         std::chrono::duration_cast<SourcePool::Clock::duration>(duration));
+    if (source == 0) return;
+    
+    alSourcef(source, AL_PITCH, event.pitch);
+    alSourcef(source, AL_GAIN, event.gain);
+    alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
+    alSource3f(source, AL_VELOCITY, 0.0f, 0.0f, 0.0f);
+    alSourcei(source, AL_LOOPING, AL_FALSE);
+    alSourcei(source, AL_BUFFER, static_cast<ALint>(m_buffers[event.clip]));
+    
+    alSourcePlay(source);
+    CheckALError("Play sound");
+}
+
+void OpenALBackend::StopAll() {
+    for (ALuint source : m_sources) {
+        alSourceStop(source);
+    }
+    m_sourcePool.ReleaseAll();
+    if (m_mixer) {
+        m_mixer->Post({SoftwareMixer::STOP_ALL, 1.0f, 0.0f});
+    }
+}
+
+void OpenALBackend::Advance(double) {
+    // The mixer stream looks after itself on its own thread
+    if (m_playbackPath == PlaybackPath::Mixer) return;
+    
+    // Return sources whose sounds have ended to the pool; nothing to do most frames
+    m_sourcePool.ReclaimExpired(SourcePool::Clock::now());
+}
+
+OpenALBackend::PlaybackPath OpenALBackend::SetPlaybackPath(PlaybackPath path) {
+    if (!m_context || path == m_playbackPath) {
+        return m_playbackPath;
+    }
+    
+    if (path == PlaybackPath::Mixer) {
+        if (!StartStream()) {
+            fmt::print("Mixer stream unavailable, playing sounds on separate sources\n");
+            return m_playbackPath;
+        }
+    } else {
+        StopStream();
+    }
+    m_playbackPath = path;
+    return m_playbackPath;
+}
+
+OpenALBackend::StreamStats OpenALBackend::GetStreamStats() const {
+    StreamStats stats;
+    if (m_mixer) {
+        stats.mixer = m_mixer->GetStats();
+        stats.pendingEvents = m_mixer->PendingEvents();
+    }
+    stats.underruns = m_streamUnderruns.load(std::memory_order_relaxed);
+    return stats;
+}
+
+// Queues every stream buffer with a fresh block and starts the source, then hands
+// the refills to the stream thread
+bool OpenALBackend::StartStream() {
+    if (m_streamRunning.load(std::memory_order_acquire)) {
+        return true;
+    }
+    if (!m_streamSource) {
+        return false;
+    }
+    
+    std::array<short, STREAM_BLOCK_FRAMES> block{};
+    for (ALuint buffer : m_streamBuffers) {
+        FillStreamBuffer(buffer, block);
+    }
+    alSourceQueueBuffers(m_streamSource, STREAM_BUFFER_COUNT, m_streamBuffers.data());
+    alSourcePlay(m_streamSource);
+    if (!CheckALError("Start mixer stream")) {
+        alSourceStop(m_streamSource);
+        alSourcei(m_streamSource, AL_BUFFER, 0);
+        return false;
+    }
+    
+    m_streamRunning.store(true, std::memory_order_release);
+    m_streamThread = std::thread(&OpenALBackend::StreamLoop, this);
+    return true;
+}
+
+void OpenALBackend::StopStream() {
+    if (!m_streamRunning.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    if (m_streamThread.joinable()) {
+        m_streamThread.join();
+    }
+    
+    alSourceStop(m_streamSource);
+    alSourcei(m_streamSource, AL_BUFFER, 0); // Detaches every queued buffer
+    // Voices still sounding would resume mid-clip on the next StartStream
+    m_mixer->Post({SoftwareMixer::STOP_ALL, 1.0f, 0.0f});
+}
+
+// Runs on m_streamThread. Every finished buffer is unqueued, refilled from the
+// mixer and queued again; the OpenAL context is process-wide, so no setup is needed
+void OpenALBackend::StreamLoop() {
+    Profiler::SetThreadName("Audio stream");
+    std::array<short, STREAM_BLOCK_FRAMES> block{};
+    
+    while (m_streamRunning.load(std::memory_order_acquire)) {
+        ALint processed = 0;
+        alGetSourcei(m_streamSource, AL_BUFFERS_PROCESSED, &processed);
+        for (; processed > 0; --processed) {
+            ALuint buffer = 0;
+            alSourceUnqueueBuffers(m_streamSource, 1, &buffer);
+            FillStreamBuffer(buffer, block);
+            alSourceQueueBuffers(m_streamSource, 1, &buffer);
+        }
+        
+        // A source that runs out of queued data stops by itself; restart it on the refills
+        ALint state = AL_PLAYING;
+        alGetSourcei(m_streamSource, AL_SOURCE_STATE, &state);
+        if (state != AL_PLAYING) {
+            alSourcePlay(m_streamSource);
+            m_streamUnderruns.fetch_add(1, std::memory_order_relaxed);
+        }
+        
+        std::this_thread::sleep_for(STREAM_POLL_INTERVAL);
+    }
+}
+
+void OpenALBackend::FillStreamBuffer(ALuint buffer, std::array<short, STREAM_BLOCK_FRAMES>& block) {
+    PROFILE_SCOPE("OpenALBackend::FillStreamBuffer");
+    m_mixer->Render(block.data(), block.size());
+    alBufferData(buffer, AL_FORMAT_MONO16, block.data(),
+                static_cast<ALsizei>(block.size() * sizeof(short)), m_sampleRate);
+}
+
+void OpenALBackend::CleanupBuffers() {
+    if (!m_buffers.empty()) {
+        alDeleteBuffers(static_cast<ALsizei>(m_buffers.size()), m_buffers.data());
+        m_buffers.clear();
+        m_clipSeconds.clear();
+    }
+}
+
+void OpenALBackend::CleanupStream() {
+    if (m_streamSource) {
+        alDeleteSources(1, &m_streamSource);
+        m_streamSource = 0;
+    }
+    if (m_streamBuffers[0]) {
+        alDeleteBuffers(STREAM_BUFFER_COUNT, m_streamBuffers.data());
+        m_streamBuffers.fill(0);
+    }
+}
+
+void OpenALBackend::CleanupSources() {
+    if (!m_sources.empty()) {
+        // Stop all sources
+        for (ALuint source : m_sources) {
+            alSourceStop(source);
+        }
+        
+        alDeleteSources(static_cast<ALsizei>(m_sources.size()), m_sources.data());
+        m_sources.clear();
+        m_sourcePool.Clear();
+    }
+}
+
+bool OpenALBackend::CheckALError(const char* operation) {
+    ALenum error = alGetError();
+    if (error != AL_NO_ERROR) {
+        fmt::print("OpenAL error in {}: {}\n", operation, error);
+        return false;
+    }
+    return true;
+}
+
+} // namespace AlgorithmVisualizer
@@ -0,0 +1,132 @@
+#include "audio/SoftwareMixer.h"
+#include <algorithm>
+
+namespace AlgorithmVisualizer {
+
+namespace {
+constexpr size_t MIX_CHUNK_FRAMES = 4096; // Render splits longer requests so m_mix never grows
+}
+
+SoftwareMixer::SoftwareMixer(int sampleRate) : m_sampleRate(sampleRate) {
+    m_voices.reserve(MAX_VOICES);
+    m_mix.resize(MIX_CHUNK_FRAMES);
+}
+
+void SoftwareMixer::SetClip(ClipId clip, const std::vector<short>& samples) {
+    if (clip >= m_clips.size()) {
+        m_clips.resize(clip + 1);
+    }
+    std::vector<float>& data = m_clips[clip];
+    data.resize(samples.size());
+    std::transform(samples.begin(), samples.end(), data.begin(),
+                   [](short sample) { return static_cast<float>(sample) * (1.0f / 32768.0f); });
+}
+
+bool SoftwareMixer::Post(const Event& event) {
+    if (!m_events.TryPush(event)) {
+        m_eventsDropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+void SoftwareMixer::Start(const Event& event) {
+    if (event.clip == STOP_ALL) {
+        m_voices.clear();
+        return;
+    }
+    if (event.clip >= m_clips.size() || m_clips[event.clip].empty() || event.pitch <= 0.0f) {
+        return;
+    }
+
+    Voice voice{&m_clips[event.clip], 0.0, static_cast<double>(event.pitch), event.gain};
+    if (m_voices.size() < MAX_VOICES) {
+        m_voices.push_back(voice);
+    } else {
+        // Full: replace the voice with the least left to play, which is the least audible loss
+        auto remaining = [](const Voice& v) { return static_cast<double>(v.samples->size()) - v.position; };
+        auto victim = std::min_element(m_voices.begin(), m_voices.end(),
+                                       [&](const Voice& a, const Voice& b) { return remaining(a) < remaining(b); });
+        *victim = voice;
+        m_voicesStolen.fetch_add(1, std::memory_order_relaxed);
+    }
+    m_eventsPlayed.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool SoftwareMixer::MixVoice(Voice& voice, size_t frames) {
+    const float* data = voice.samples->data();
+    const size_t length = voice.samples->size();
+    const float gain = voice.gain;
+    float* mix = m_mix.data();
+
+    if (voice.step == 1.0) {
+        // Unpitched: position stays integral, so this is a straight scaled add
+        const size_t start = static_cast<size_t>(voice.position);
+        const size_t count = std::min(frames, length - start);
+        for (size_t n = 0; n < count; ++n) {
+            mix[n] += gain * data[start + n];
+        }
+        voice.position += static_cast<double>(count);
+        return start + count < length;
+    }
+
+    double position = voice.position;
+    for (size_t n = 0; n < frames; ++n) {
+        const size_t index = static_cast<size_t>(position);
+        if (index + 1 >= length) {
+            return false;
+        }
+        const float fraction = static_cast<float>(position - static_cast<double>(index));
+        mix[n] += gain * (data[index] + (data[index + 1] - data[index]) * fraction);
+        position += voice.step;
+    }
+    voice.position = position;
+    return true;
+}
+
+void SoftwareMixer::Render(short* output, size_t frames) {
+    Event event;
+    while (m_events.TryPop(event)) {
+        Start(event);
+    }
+
+    while (frames > 0) {
+        const size_t chunk = std::min(frames, MIX_CHUNK_FRAMES);
+        std::fill_n(m_mix.begin(), chunk, 0.0f);
+
+        for (size_t i = 0; i < m_voices.size();) {
+            if (MixVoice(m_voices[i], chunk)) {
+                ++i;
+            } else {
+                m_voices[i] = m_voices.back();
+                m_voices.pop_back();
+            }
+        }
+
+        for (size_t n = 0; n < chunk; ++n) {
+            output[n] = static_cast<short>(std::clamp(m_mix[n], -1.0f, 1.0f) * 32767.0f);
+        }
+        output += chunk;
+        frames -= chunk;
+    }
+
+    const auto active = static_cast<uint32_t>(m_voices.size());
+    m_activeVoices.store(active, std::memory_order_relaxed);
+    if (active > m_peakVoices.load(std::memory_order_relaxed)) {
+        m_peakVoices.store(active, std::memory_order_relaxed);
+    }
+    m_blocksRendered.fetch_add(1, std::memory_order_relaxed);
+}
+
+SoftwareMixer::Stats SoftwareMixer::GetStats() const {
+    Stats stats;
+    stats.eventsPlayed = m_eventsPlayed.load(std::memory_order_relaxed);
+    stats.eventsDropped = m_eventsDropped.load(std::memory_order_relaxed);
+    stats.voicesStolen = m_voicesStolen.load(std::memory_order_relaxed);
+    stats.blocksRendered = m_blocksRendered.load(std::memory_order_relaxed);
+    stats.activeVoices = m_activeVoices.load(std::memory_order_relaxed);
+    stats.peakVoices = m_peakVoices.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace AlgorithmVisualizer
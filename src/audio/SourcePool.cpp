@@ -0,0 +1,68 @@
+#include "audio/SourcePool.h"
+#include <algorithm>
+#include <functional>
+
+namespace AlgorithmVisualizer {
+
+namespace {
+// Playback starts a little after alSourcePlay returns; rebinding a source that is
+// still playing its last few milliseconds would fail, so bookings run this much longer
+constexpr std::chrono::milliseconds LATENCY_MARGIN{50};
+}
+
+void SourcePool::Reset(const std::vector<ALuint>& sources) {
+    m_free = sources;
+    m_busy.clear();
+    m_busy.reserve(sources.size());
+}
+
+void SourcePool::Clear() {
+    m_free.clear();
+    m_busy.clear();
+}
+
+void SourcePool::PopEarliest() {
+    std::pop_heap(m_busy.begin(), m_busy.end(), std::greater<>());
+    m_free.push_back(m_busy.back().source);
+    m_busy.pop_back();
+}
+
+void SourcePool::ReclaimExpired(Clock::time_point now) {
+    while (!m_busy.empty() && m_busy.front().end <= now) {
+        PopEarliest();
+        m_stats.reclaimedByTime++;
+    }
+}
+
+ALuint SourcePool::Acquire(Clock::time_point now, Clock::duration duration) {
+    ReclaimExpired(now);
+    if (m_free.empty()) {
+        if (m_busy.empty()) {
+            return 0;
+        }
+        ALint state = AL_PLAYING;
+        alGetSourcei(m_busy.front().source, AL_SOURCE_STATE, &state);
+        if (state == AL_PLAYING) {
+            m_stats.exhausted++;
+            return 0;
+        }
+        PopEarliest();
+        m_stats.reclaimedByQuery++;
+    }
+
+    const ALuint source = m_free.back();
+    m_free.pop_back();
+    m_busy.push_back({now + duration + LATENCY_MARGIN, source});
+    std::push_heap(m_busy.begin(), m_busy.end(), std::greater<>());
+    m_stats.acquired++;
+    return source;
+}
+
+void SourcePool::ReleaseAll() {
+    for (const Booking& booking : m_busy) {
+        m_free.push_back(booking.source);
+    }
+    m_busy.clear();
+}
+
+} // namespace AlgorithmVisualizer
@@ -0,0 +1,167 @@
+#include "audio/Synth.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace AlgorithmVisualizer {
+
+namespace {
+constexpr size_t PHASE_BLOCK = 1024; // Accumulated phase is re-wrapped this often
+
+// sin(2 pi phase) for phase in [0, 1): parabola plus one correction term, on the
+// shifted range [-0.5, 0.5) where the parabola fits
+inline float PolySin(float phase) {
+    const float x = 0.5f - phase;
+    const float y = 8.0f * x - 16.0f * x * std::fabs(x);
+    return 0.225f * (y * std::fabs(y) - y) + y;
+}
+
+// Fractional part of a non-negative value; truncation keeps it vectorizable without SSE4.1
+inline float Wrap(float cycles) {
+    return cycles - static_cast<float>(static_cast<int>(cycles));
+}
+}
+
+void Synth::AddOscillator(std::span<float> out, Waveform waveform, float frequency, float amplitude,
+                          int sampleRate) {
+    const size_t count = out.size();
+    float* data = out.data();
+
+    if (waveform == Waveform::Sine) {
+        // Lane l holds the phasor for sample n + l; each block turns all lanes by LANES steps
+        const double step = 2.0 * std::numbers::pi * frequency / sampleRate;
+        float sine[LANES];
+        float cosine[LANES];
+        for (size_t l = 0; l < LANES; ++l) {
+            sine[l] = static_cast<float>(std::sin(step * static_cast<double>(l)));
+            cosine[l] = static_cast<float>(std::cos(step * static_cast<double>(l)));
+        }
+        const auto turnSin = static_cast<float>(std::sin(step * LANES));
+        const auto turnCos = static_cast<float>(std::cos(step * LANES));
+
+        size_t n = 0;
+        for (; n + LANES <= count; n += LANES) {
+            for (size_t l = 0; l < LANES; ++l) {
+                data[n + l] += amplitude * sine[l];
+                const float s = sine[l] * turnCos + cosine[l] * turnSin;
+                const float c = cosine[l] * turnCos - sine[l] * turnSin;
+                // First-order pull back onto the unit circle, so rounding never builds up
+                const float correction = 1.5f - 0.5f * (s * s + c * c);
+                sine[l] = s * correction;
+                cosine[l] = c * correction;
+            }
+        }
+        for (size_t l = 0; n < count; ++n, ++l) {
+            data[n] += amplitude * sine[l];
+        }
+        return;
+    }
+
+    const float increment = frequency / static_cast<float>(sampleRate);
+    float base = 0.0f;
+    for (size_t start = 0; start < count; start += PHASE_BLOCK) {
+        // int offsets: there is no vector conversion from 64-bit integers to float before AVX-512
+        const int length = static_cast<int>(std::min(count - start, PHASE_BLOCK));
+        float* block = data + start;
+        switch (waveform) {
+        case Waveform::Square:
+            for (int i = 0; i < length; ++i) {
+                const float phase = Wrap(base + static_cast<float>(i) * increment);
+                block[i] += phase < 0.5f ? amplitude : -amplitude;
+            }
+            break;
+        case Waveform::Saw:
+            for (int i = 0; i < length; ++i) {
+                const float phase = Wrap(base + static_cast<float>(i) * increment);
+                block[i] += amplitude * (2.0f * phase - 1.0f);
+            }
+            break;
+        case Waveform::Triangle:
+            for (int i = 0; i < length; ++i) {
+                const float phase = Wrap(base + static_cast<float>(i) * increment);
+                block[i] += amplitude * (1.0f - 4.0f * std::fabs(phase - 0.5f));
+            }
+            break;
+        case Waveform::Sine:
+            break;
+        }
+        base = Wrap(base + static_cast<float>(length) * increment);
+    }
+}
+
+void Synth::AddFM(std::span<float> out, float frequency, float ratio, float index, float amplitude,
+                  int sampleRate) {
+    const size_t count = out.size();
+    float* data = out.data();
+    const float carrierIncrement = frequency / static_cast<float>(sampleRate);
+    const float modulatorIncrement = carrierIncrement * ratio;
+    // index is in radians of carrier phase; PolySin works in cycles. Adding whole
+    // cycles (lift) keeps the modulated phase non-negative for Wrap
+    const float depth = index / (2.0f * std::numbers::pi_v<float>);
+    const float lift = std::ceil(depth);
+
+    float carrierBase = 0.0f;
+    float modulatorBase = 0.0f;
+    for (size_t start = 0; start < count; start += PHASE_BLOCK) {
+        const int length = static_cast<int>(std::min(count - start, PHASE_BLOCK));
+        float* block = data + start;
+        for (int i = 0; i < length; ++i) {
+            const auto offset = static_cast<float>(i);
+            const float modulator = PolySin(Wrap(modulatorBase + offset * modulatorIncrement));
+            const float carrier = Wrap(carrierBase + offset * carrierIncrement + depth * modulator + lift);
+            block[i] += amplitude * PolySin(carrier);
+        }
+        carrierBase = Wrap(carrierBase + static_cast<float>(length) * carrierIncrement);
+        modulatorBase = Wrap(modulatorBase + static_cast<float>(length) * modulatorIncrement);
+    }
+}
+
+void Synth::ApplyFades(std::span<float> out, float fadeFraction) {
+    const size_t count = out.size();
+    const auto fade = std::min(static_cast<size_t>(static_cast<float>(count) * fadeFraction), count / 2);
+    if (fade == 0) {
+        return;
+    }
+    float* data = out.data();
+    const float slope = 1.0f / static_cast<float>(fade);
+    const int ramp = static_cast<int>(fade);
+    float* tail = data + (count - fade);
+    for (int i = 0; i < ramp; ++i) {
+        data[i] *= static_cast<float>(i) * slope;
+    }
+    for (int i = 0; i < ramp; ++i) {
+        tail[i] *= static_cast<float>(ramp - i) * slope;
+    }
+}
+
+void Synth::ApplyDecay(std::span<float> out, float rate, int sampleRate) {
+    const size_t count = out.size();
+    float* data = out.data();
+    const double perSample = -static_cast<double>(rate) / sampleRate;
+    float gain[LANES];
+    for (size_t l = 0; l < LANES; ++l) {
+        gain[l] = static_cast<float>(std::exp(perSample * static_cast<double>(l)));
+    }
+    const auto turn = static_cast<float>(std::exp(perSample * LANES));
+
+    size_t n = 0;
+    for (; n + LANES <= count; n += LANES) {
+        for (size_t l = 0; l < LANES; ++l) {
+            data[n + l] *= gain[l];
+            gain[l] *= turn;
+        }
+    }
+    for (size_t l = 0; n < count; ++n, ++l) {
+        data[n] *= gain[l];
+    }
+}
+
+std::vector<short> Synth::ToPcm16(std::span<const float> samples) {
+    std::vector<short> pcm(samples.size());
+    for (size_t n = 0; n < samples.size(); ++n) {
+        pcm[n] = static_cast<short>(std::clamp(samples[n], -1.0f, 1.0f) * 32767.0f);
+    }
+    return pcm;
+}
+
+} // namespace AlgorithmVisualizer
@@ -1,17 +1,578 @@
 #include "renderer/Renderer.h"
+#include "utils/Profiler.h"
+#include <fmt/format.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+// The renderer declares the slice of the GL 3.3 core API it uses itself and loads
+// every entry point through GLFW, so it needs neither a loader library nor the
+// Khronos headers, which MSVC and the macOS SDK do not ship in the same form
+#if defined(_WIN32)
+#define RENDERER_GL_APIENTRY __stdcall
+#else
+#define RENDERER_GL_APIENTRY
+#endif
 
 namespace AlgorithmVisualizer {
 
-void Renderer::Initialize() {
-    // TODO: Initialize rendering resources
+namespace {
+
+using GLenum = unsigned int;
+using GLuint = unsigned int;
+using GLint = int;
+using GLsizei = int;
+using GLboolean = unsigned char;
+using GLbitfield = unsigned int;
+using GLfloat = float;
+using GLchar = char;
+using GLsizeiptr = std::ptrdiff_t;
+using GLintptr = std::ptrdiff_t;
+using GLuint64 = std::uint64_t;
+struct GlSyncObject;
+using GLsync = GlSyncObject*;
+
+constexpr GLboolean GL_FALSE = 0;
+constexpr GLboolean GL_TRUE = 1;
+
+constexpr GLenum GL_TRIANGLE_STRIP = 0x0005;
+constexpr GLenum GL_DEPTH_TEST = 0x0B71;
+constexpr GLenum GL_VIEWPORT = 0x0BA2;
+constexpr GLenum GL_BLEND = 0x0BE2;
+constexpr GLenum GL_SCISSOR_TEST = 0x0C11;
+constexpr GLenum GL_TEXTURE_2D = 0x0DE1;
+constexpr GLenum GL_UNSIGNED_BYTE = 0x1401;
+constexpr GLenum GL_UNSIGNED_INT = 0x1405;
+constexpr GLenum GL_FLOAT = 0x1406;
+constexpr GLenum GL_RGBA = 0x1908;
+constexpr GLenum GL_NEAREST = 0x2600;
+constexpr GLenum GL_TEXTURE_MAG_FILTER = 0x2800;
+constexpr GLenum GL_TEXTURE_MIN_FILTER = 0x2801;
+constexpr GLenum GL_TEXTURE_WRAP_S = 0x2802;
+constexpr GLenum GL_TEXTURE_WRAP_T = 0x2803;
+constexpr GLenum GL_RGBA8 = 0x8058;
+constexpr GLenum GL_TEXTURE_BINDING_2D = 0x8069;
+constexpr GLenum GL_CLAMP_TO_EDGE = 0x812F;
+constexpr GLenum GL_VERTEX_ARRAY_BINDING = 0x85B5;
+constexpr GLenum GL_ARRAY_BUFFER = 0x8892;
+constexpr GLenum GL_ARRAY_BUFFER_BINDING = 0x8894;
+constexpr GLenum GL_STREAM_DRAW = 0x88E0;
+constexpr GLenum GL_FRAGMENT_SHADER = 0x8B30;
+constexpr GLenum GL_VERTEX_SHADER = 0x8B31;
+constexpr GLenum GL_COMPILE_STATUS = 0x8B81;
+constexpr GLenum GL_LINK_STATUS = 0x8B82;
+constexpr GLenum GL_CURRENT_PROGRAM = 0x8B8D;
+constexpr GLenum GL_FRAMEBUFFER_BINDING = 0x8CA6;
+constexpr GLenum GL_FRAMEBUFFER_COMPLETE = 0x8CD5;
+constexpr GLenum GL_COLOR_ATTACHMENT0 = 0x8CE0;
+constexpr GLenum GL_FRAMEBUFFER = 0x8D40;
+constexpr GLenum GL_SYNC_GPU_COMMANDS_COMPLETE = 0x9117;
+constexpr GLenum GL_TIMEOUT_EXPIRED = 0x911B;
+
+constexpr GLbitfield GL_COLOR_BUFFER_BIT = 0x00004000;
+constexpr GLbitfield GL_SYNC_FLUSH_COMMANDS_BIT = 0x00000001;
+constexpr GLbitfield GL_MAP_WRITE_BIT = 0x0002;
+constexpr GLbitfield GL_MAP_INVALIDATE_RANGE_BIT = 0x0004;
+constexpr GLbitfield GL_MAP_UNSYNCHRONIZED_BIT = 0x0020;
+constexpr GLbitfield GL_MAP_PERSISTENT_BIT = 0x0040;
+constexpr GLbitfield GL_MAP_COHERENT_BIT = 0x0080;
+
+// Everything the renderer calls as (return type, name, parameters)
+#define RENDERER_GL_FUNCTIONS(X) \
+    X(void, glGetIntegerv, (GLenum, GLint*)) \
+    X(GLboolean, glIsEnabled, (GLenum)) \
+    X(void, glEnable, (GLenum)) \
+    X(void, glDisable, (GLenum)) \
+    X(void, glViewport, (GLint, GLint, GLsizei, GLsizei)) \
+    X(void, glClearColor, (GLfloat, GLfloat, GLfloat, GLfloat)) \
+    X(void, glClear, (GLbitfield)) \
+    X(void, glGenTextures, (GLsizei, GLuint*)) \
+    X(void, glBindTexture, (GLenum, GLuint)) \
+    X(void, glTexParameteri, (GLenum, GLenum, GLint)) \
+    X(void, glTexImage2D, (GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const void*)) \
+    X(void, glDeleteTextures, (GLsizei, const GLuint*)) \
+    X(GLuint, glCreateShader, (GLenum)) \
+    X(void, glShaderSource, (GLuint, GLsizei, const GLchar* const*, const GLint*)) \
+    X(void, glCompileShader, (GLuint)) \
+    X(void, glGetShaderiv, (GLuint, GLenum, GLint*)) \
+    X(void, glGetShaderInfoLog, (GLuint, GLsizei, GLsizei*, GLchar*)) \
+    X(void, glDeleteShader, (GLuint)) \
+    X(GLuint, glCreateProgram, ()) \
+    X(void, glAttachShader, (GLuint, GLuint)) \
+    X(void, glLinkProgram, (GLuint)) \
+    X(void, glGetProgramiv, (GLuint, GLenum, GLint*)) \
+    X(void, glGetProgramInfoLog, (GLuint, GLsizei, GLsizei*, GLchar*)) \
+    X(void, glDeleteProgram, (GLuint)) \
+    X(void, glUseProgram, (GLuint)) \
+    X(GLint, glGetUniformLocation, (GLuint, const GLchar*)) \
+    X(void, glUniform1i, (GLint, GLint)) \
+    X(void, glUniform1f, (GLint, GLfloat)) \
+    X(void, glUniform2f, (GLint, GLfloat, GLfloat)) \
+    X(void, glUniform4f, (GLint, GLfloat, GLfloat, GLfloat, GLfloat)) \
+    X(void, glUniform4fv, (GLint, GLsizei, const GLfloat*)) \
+    X(void, glGenVertexArrays, (GLsizei, GLuint*)) \
+    X(void, glBindVertexArray, (GLuint)) \
+    X(void, glDeleteVertexArrays, (GLsizei, const GLuint*)) \
+    X(void, glGenBuffers, (GLsizei, GLuint*)) \
+    X(void, glBindBuffer, (GLenum, GLuint)) \
+    X(void, glBufferData, (GLenum, GLsizeiptr, const void*, GLenum)) \
+    X(void, glDeleteBuffers, (GLsizei, const GLuint*)) \
+    X(void*, glMapBufferRange, (GLenum, GLintptr, GLsizeiptr, GLbitfield)) \
+    X(GLboolean, glUnmapBuffer, (GLenum)) \
+    X(void, glVertexAttribPointer, (GLuint, GLint, GLenum, GLboolean, GLsizei, const void*)) \
+    X(void, glVertexAttribIPointer, (GLuint, GLint, GLenum, GLsizei, const void*)) \
+    X(void, glEnableVertexAttribArray, (GLuint)) \
+    X(void, glVertexAttribDivisor, (GLuint, GLuint)) \
+    X(void, glDrawArraysInstanced, (GLenum, GLint, GLsizei, GLsizei)) \
+    X(void, glGenFramebuffers, (GLsizei, GLuint*)) \
+    X(void, glBindFramebuffer, (GLenum, GLuint)) \
+    X(void, glFramebufferTexture2D, (GLenum, GLenum, GLenum, GLuint, GLint)) \
+    X(GLenum, glCheckFramebufferStatus, (GLenum)) \
+    X(void, glDeleteFramebuffers, (GLsizei, const GLuint*)) \
+    X(GLsync, glFenceSync, (GLenum, GLbitfield)) \
+    X(GLenum, glClientWaitSync, (GLsync, GLbitfield, GLuint64)) \
+    X(void, glDeleteSync, (GLsync))
+
+struct GlFunctions {
+#define RENDERER_GL_MEMBER(ret, name, params) ret (RENDERER_GL_APIENTRY* name) params = nullptr;
+    RENDERER_GL_FUNCTIONS(RENDERER_GL_MEMBER)
+#undef RENDERER_GL_MEMBER
+    // GL 4.4 / ARB_buffer_storage; optional
+    void (RENDERER_GL_APIENTRY* glBufferStorage)(GLenum, GLsizeiptr, const void*, GLbitfield) = nullptr;
+
+    bool Load() {
+        bool complete = true;
+#define RENDERER_GL_LOAD(ret, name, params) \
+        name = reinterpret_cast<decltype(name)>(glfwGetProcAddress(#name)); \
+        complete = complete && name != nullptr;
+        RENDERER_GL_FUNCTIONS(RENDERER_GL_LOAD)
+#undef RENDERER_GL_LOAD
+        glBufferStorage = reinterpret_cast<decltype(glBufferStorage)>(glfwGetProcAddress("glBufferStorage"));
+        return complete;
+    }
+};
+
+GlFunctions gl;
+
+constexpr size_t REGION_BYTES = Renderer::INSTANCES_PER_FRAME * sizeof(Renderer::Instance);
+
+// One quad per instance, expanded from gl_VertexID as a triangle strip; y grows downwards
+constexpr const char* VERTEX_SHADER = R"(#version 330 core
+layout(location = 0) in vec4 aRect;
+layout(location = 1) in uint aColor;
+uniform vec2 uViewport;
+out vec2 vLocal;
+out vec2 vSize;
+flat out uint vColor;
+void main() {
+    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));
+    vLocal = corner * aRect.zw;
+    vSize = aRect.zw;
+    vColor = aColor;
+    vec2 pixel = aRect.xy + vLocal;
+    gl_Position = vec4(pixel.x / uViewport.x * 2.0 - 1.0, 1.0 - pixel.y / uViewport.y * 2.0, 0.0, 1.0);
+}
+)";
+
+constexpr const char* FRAGMENT_SHADER = R"(#version 330 core
+uniform vec4 uPalette[16];
+uniform vec4 uOutline;
+uniform float uOutlineWidth;
+uniform int uShape;
+in vec2 vLocal;
+in vec2 vSize;
+flat in uint vColor;
+out vec4 fragColor;
+void main() {
+    vec4 color = uPalette[min(vColor, 15u)];
+    if (uShape == 1) {
+        float radius = min(vSize.x, vSize.y) * 0.5;
+        float dist = length(vLocal - vSize * 0.5);
+        float coverage = clamp(radius - dist + 0.5, 0.0, 1.0);
+        if (coverage <= 0.0) {
+            discard;
+        }
+        if (dist > radius - uOutlineWidth) {
+            color = uOutline;
+        }
+        fragColor = vec4(color.rgb, color.a * coverage);
+    } else {
+        vec2 edge = min(vLocal, vSize - vLocal);
+        if (min(edge.x, edge.y) < uOutlineWidth) {
+            color = uOutline;
+        }
+        fragColor = color;
+    }
 }
+)";
 
-void Renderer::Render() {
-    // TODO: Implement custom rendering
+static_assert(Renderer::PALETTE_SIZE == 16, "FRAGMENT_SHADER declares the palette size");
+
+unsigned int CompileShader(GLenum type, const char* source) {
+    const GLuint shader = gl.glCreateShader(type);
+    gl.glShaderSource(shader, 1, &source, nullptr);
+    gl.glCompileShader(shader);
+    GLint compiled = GL_FALSE;
+    gl.glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    if (compiled != GL_TRUE) {
+        char log[1024] = {};
+        gl.glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+        fmt::print(stderr, "Renderer: shader compilation failed: {}\n", log);
+        gl.glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+// ImGui's backend sets up its own state before drawing, but not the framebuffer,
+// and other code between here and there may rely on the rest
+struct GlStateBackup {
+    GLint framebuffer = 0;
+    GLint viewport[4] = {};
+    GLint program = 0;
+    GLint vertexArray = 0;
+    GLint arrayBuffer = 0;
+    GLint texture = 0;
+    GLboolean blend = GL_FALSE;
+    GLboolean scissor = GL_FALSE;
+    GLboolean depth = GL_FALSE;
+
+    GlStateBackup() {
+        gl.glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+        gl.glGetIntegerv(GL_VIEWPORT, viewport);
+        gl.glGetIntegerv(GL_CURRENT_PROGRAM, &program);
+        gl.glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &vertexArray);
+        gl.glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &arrayBuffer);
+        gl.glGetIntegerv(GL_TEXTURE_BINDING_2D, &texture);
+        blend = gl.glIsEnabled(GL_BLEND);
+        scissor = gl.glIsEnabled(GL_SCISSOR_TEST);
+        depth = gl.glIsEnabled(GL_DEPTH_TEST);
+    }
+
+    ~GlStateBackup() {
+        gl.glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(framebuffer));
+        gl.glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+        gl.glUseProgram(static_cast<GLuint>(program));
+        gl.glBindVertexArray(static_cast<GLuint>(vertexArray));
+        gl.glBindBuffer(GL_ARRAY_BUFFER, static_cast<GLuint>(arrayBuffer));
+        gl.glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(texture));
+        Restore(GL_BLEND, blend);
+        Restore(GL_SCISSOR_TEST, scissor);
+        Restore(GL_DEPTH_TEST, depth);
+    }
+
+    static void Restore(GLenum capability, GLboolean enabled) {
+        if (enabled) {
+            gl.glEnable(capability);
+        } else {
+            gl.glDisable(capability);
+        }
+    }
+};
+
+} // namespace
+
+bool Renderer::Initialize() {
+    PROFILE_SCOPE("Renderer::Initialize");
+    if (m_initialized) {
+        return true;
+    }
+    if (!gl.Load()) {
+        fmt::print(stderr, "Renderer: OpenGL 3.3 functions unavailable, drawing through ImGui\n");
+        return false;
+    }
+    if (!CreateProgram() || !CreateStreamBuffer()) {
+        Shutdown();
+        return false;
+    }
+    m_initialized = true;
+    fmt::print("Renderer: instanced, {} stream buffer\n", m_persistent ? "persistent-mapped" : "unsynchronized-mapped");
+    return true;
+}
+
+bool Renderer::CreateProgram() {
+    const GLuint vertexShader = CompileShader(GL_VERTEX_SHADER, VERTEX_SHADER);
+    const GLuint fragmentShader = CompileShader(GL_FRAGMENT_SHADER, FRAGMENT_SHADER);
+    if (vertexShader == 0 || fragmentShader == 0) {
+        if (vertexShader != 0) gl.glDeleteShader(vertexShader);
+        if (fragmentShader != 0) gl.glDeleteShader(fragmentShader);
+        return false;
+    }
+
+    m_program = gl.glCreateProgram();
+    gl.glAttachShader(m_program, vertexShader);
+    gl.glAttachShader(m_program, fragmentShader);
+    gl.glLinkProgram(m_program);
+    gl.glDeleteShader(vertexShader);
+    gl.glDeleteShader(fragmentShader);
+
+    GLint linked = GL_FALSE;
+    gl.glGetProgramiv(m_program, GL_LINK_STATUS, &linked);
+    if (linked != GL_TRUE) {
+        char log[1024] = {};
+        gl.glGetProgramInfoLog(m_program, sizeof(log), nullptr, log);
+        fmt::print(stderr, "Renderer: program link failed: {}\n", log);
+        return false;
+    }
+
+    m_viewportLocation = gl.glGetUniformLocation(m_program, "uViewport");
+    m_paletteLocation = gl.glGetUniformLocation(m_program, "uPalette");
+    m_outlineLocation = gl.glGetUniformLocation(m_program, "uOutline");
+    m_outlineWidthLocation = gl.glGetUniformLocation(m_program, "uOutlineWidth");
+    m_shapeLocation = gl.glGetUniformLocation(m_program, "uShape");
+    return true;
+}
+
+bool Renderer::CreateStreamBuffer() {
+    GLint previousVertexArray = 0;
+    GLint previousBuffer = 0;
+    gl.glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &previousVertexArray);
+    gl.glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &previousBuffer);
+
+    gl.glGenVertexArrays(1, &m_vertexArray);
+    gl.glGenBuffers(1, &m_buffer);
+    gl.glBindVertexArray(m_vertexArray);
+    gl.glBindBuffer(GL_ARRAY_BUFFER, m_buffer);
+
+    const auto totalBytes = static_cast<GLsizeiptr>(REGION_BYTES * REGION_COUNT);
+    if (gl.glBufferStorage) {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        gl.glBufferStorage(GL_ARRAY_BUFFER, totalBytes, nullptr, flags);
+        m_mapped = gl.glMapBufferRange(GL_ARRAY_BUFFER, 0, totalBytes, flags);
+        m_persistent = m_mapped != nullptr;
+    }
+    if (!m_persistent) {
+        // Immutable storage cannot be respecified, so a failed persistent map needs a new buffer
+        if (gl.glBufferStorage) {
+            gl.glDeleteBuffers(1, &m_buffer);
+            gl.glGenBuffers(1, &m_buffer);
+            gl.glBindBuffer(GL_ARRAY_BUFFER, m_buffer);
+        }
+        gl.glBufferData(GL_ARRAY_BUFFER, totalBytes, nullptr, GL_STREAM_DRAW);
+    }
+
+    // Attributes advance per instance; the pointers are rebased on every draw
+    gl.glEnableVertexAttribArray(0);
+    gl.glVertexAttribDivisor(0, 1);
+    gl.glEnableVertexAttribArray(1);
+    gl.glVertexAttribDivisor(1, 1);
+
+    gl.glBindVertexArray(static_cast<GLuint>(previousVertexArray));
+    gl.glBindBuffer(GL_ARRAY_BUFFER, static_cast<GLuint>(previousBuffer));
+    return true;
+}
+
+void Renderer::BeginFrame() {
+    PROFILE_SCOPE("Renderer::BeginFrame");
+    m_lastFrameStats = m_frameStats;
+    m_frameStats.batches = 0;
+    m_frameStats.instances = 0;
+    m_targetsUsed = 0;
+    if (!m_initialized || m_regionUsed == 0) {
+        return;
+    }
+
+    // The region just written is free again once the GPU passes this fence
+    m_fences[m_region] = gl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    m_region = (m_region + 1) % REGION_COUNT;
+    m_regionUsed = 0;
+
+    if (GLsync fence = static_cast<GLsync>(m_fences[m_region])) {
+        GLenum result = gl.glClientWaitSync(fence, 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED) {
+            m_frameStats.stalls++;
+            do {
+                result = gl.glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1 ms
+            } while (result == GL_TIMEOUT_EXPIRED);
+        }
+        gl.glDeleteSync(fence);
+        m_fences[m_region] = nullptr;
+    }
+}
+
+Renderer::Target* Renderer::AcquireTarget(int width, int height) {
+    if (m_targetsUsed == m_targets.size()) {
+        Target target;
+        gl.glGenFramebuffers(1, &target.framebuffer);
+        gl.glGenTextures(1, &target.texture);
+        gl.glBindTexture(GL_TEXTURE_2D, target.texture);
+        gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        m_targets.push_back(target);
+    }
+
+    Target& target = m_targets[m_targetsUsed++];
+    gl.glBindFramebuffer(GL_FRAMEBUFFER, target.framebuffer);
+    if (target.width != width || target.height != height) {
+        gl.glBindTexture(GL_TEXTURE_2D, target.texture);
+        gl.glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        gl.glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target.texture, 0);
+        target.width = width;
+        target.height = height;
+        if (gl.glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            target.width = 0; // Retried at the next size change
+            return nullptr;
+        }
+    }
+    return &target;
+}
+
+size_t Renderer::Stream(std::span<const Instance> instances) {
+    const size_t offset = m_region * REGION_BYTES + m_regionUsed * sizeof(Instance);
+    const size_t bytes = instances.size_bytes();
+    if (m_persistent) {
+        std::memcpy(static_cast<char*>(m_mapped) + offset, instances.data(), bytes);
+    } else {
+        // The fence in BeginFrame already guarantees the GPU is done with this range
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT;
+        void* destination = gl.glMapBufferRange(GL_ARRAY_BUFFER, static_cast<GLintptr>(offset),
+                                                static_cast<GLsizeiptr>(bytes), flags);
+        if (destination) {
+            std::memcpy(destination, instances.data(), bytes);
+            gl.glUnmapBuffer(GL_ARRAY_BUFFER);
+        }
+    }
+    m_regionUsed += instances.size();
+    return offset;
+}
+
+void Renderer::Draw(ImDrawList* drawList, const ImVec2& pos, const ImVec2& size, const Batch& batch) {
+    PROFILE_SCOPE("Renderer::Draw");
+    if (batch.instances.empty() || size.x < 1.0f || size.y < 1.0f) {
+        return;
+    }
+    if (!m_initialized) {
+        DrawWithImGui(drawList, pos, batch);
+        return;
+    }
+
+    std::span<const Instance> instances = batch.instances;
+    const size_t room = INSTANCES_PER_FRAME - m_regionUsed;
+    if (instances.size() > room) {
+        m_frameStats.truncated += instances.size() - room;
+        instances = instances.first(room);
+        if (instances.empty()) {
+            return;
+        }
+    }
+
+    // Render at framebuffer resolution so bars stay crisp on high-DPI displays
+    const ImVec2 scale = ImGui::GetIO().DisplayFramebufferScale;
+    const int width = std::max(1, static_cast<int>(size.x * scale.x + 0.5f));
+    const int height = std::max(1, static_cast<int>(size.y * scale.y + 0.5f));
+
+    GlStateBackup backup;
+    const Target* target = AcquireTarget(width, height);
+    if (!target) {
+        DrawWithImGui(drawList, pos, batch);
+        return;
+    }
+    gl.glViewport(0, 0, width, height);
+    gl.glDisable(GL_BLEND);
+    gl.glDisable(GL_SCISSOR_TEST);
+    gl.glDisable(GL_DEPTH_TEST);
+    gl.glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    gl.glClear(GL_COLOR_BUFFER_BIT);
+
+    gl.glUseProgram(m_program);
+    gl.glBindVertexArray(m_vertexArray);
+    gl.glBindBuffer(GL_ARRAY_BUFFER, m_buffer);
+    const size_t offset = Stream(instances);
+    gl.glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(Instance),
+                             reinterpret_cast<const void*>(offset + offsetof(Instance, x)));
+    gl.glVertexAttribIPointer(1, 1, GL_UNSIGNED_INT, sizeof(Instance),
+                              reinterpret_cast<const void*>(offset + offsetof(Instance, colorIndex)));
+
+    float palette[PALETTE_SIZE * 4] = {};
+    const size_t colors = std::min(batch.palette.size(), PALETTE_SIZE);
+    for (size_t i = 0; i < colors; ++i) {
+        const ImVec4 color = ImGui::ColorConvertU32ToFloat4(batch.palette[i]);
+        std::memcpy(&palette[i * 4], &color, sizeof(color));
+    }
+    const ImVec4 outline = ImGui::ColorConvertU32ToFloat4(batch.outlineColor);
+    gl.glUniform2f(m_viewportLocation, size.x, size.y);
+    gl.glUniform4fv(m_paletteLocation, static_cast<GLsizei>(PALETTE_SIZE), palette);
+    gl.glUniform4f(m_outlineLocation, outline.x, outline.y, outline.z, outline.w);
+    gl.glUniform1f(m_outlineWidthLocation, batch.outlineWidth);
+    gl.glUniform1i(m_shapeLocation, static_cast<GLint>(batch.shape));
+    gl.glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(instances.size()));
+
+    m_frameStats.batches++;
+    m_frameStats.instances += static_cast<uint32_t>(instances.size());
+
+    // GL textures are bottom-up, hence the flipped V
+    drawList->AddImage((ImTextureID)(intptr_t)target->texture, pos, ImVec2(pos.x + size.x, pos.y + size.y),
+                       ImVec2(0.0f, 1.0f), ImVec2(1.0f, 0.0f));
+}
+
+void Renderer::DrawWithImGui(ImDrawList* drawList, const ImVec2& pos, const Batch& batch) {
+    const bool outlined = batch.outlineWidth > 0.0f;
+    for (const Instance& instance : batch.instances) {
+        const ImU32 color = instance.colorIndex < batch.palette.size() ? batch.palette[instance.colorIndex] : 0;
+        const ImVec2 min(pos.x + instance.x, pos.y + instance.y);
+        const ImVec2 max(min.x + instance.width, min.y + instance.height);
+        if (batch.shape == Shape::Circle) {
+            const ImVec2 center((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f);
+            const float radius = std::min(instance.width, instance.height) * 0.5f;
+            drawList->AddCircleFilled(center, radius, color);
+            if (outlined) {
+                drawList->AddCircle(center, radius - batch.outlineWidth * 0.5f, batch.outlineColor, 0, batch.outlineWidth);
+            }
+        } else {
+            drawList->AddRectFilled(min, max, color);
+            if (outlined) {
+                drawList->AddRect(min, max, batch.outlineColor, 0.0f, 0, batch.outlineWidth);
+            }
+        }
+    }
 }
 
 void Renderer::Shutdown() {
-    // TODO: Cleanup rendering resources
+    for (void*& fence : m_fences) {
+        if (fence) {
+            gl.glDeleteSync(static_cast<GLsync>(fence));
+            fence = nullptr;
+        }
+    }
+    for (const Target& target : m_targets) {
+        gl.glDeleteFramebuffers(1, &target.framebuffer);
+        gl.glDeleteTextures(1, &target.texture);
+    }
+    m_targets.clear();
+    if (m_buffer != 0) {
+        if (m_mapped) {
+            gl.glBindBuffer(GL_ARRAY_BUFFER, m_buffer);
+            gl.glUnmapBuffer(GL_ARRAY_BUFFER);
+            m_mapped = nullptr;
+        }
+        gl.glDeleteBuffers(1, &m_buffer);
+        m_buffer = 0;
+    }
+    if (m_vertexArray != 0) {
+        gl.glDeleteVertexArrays(1, &m_vertexArray);
+        m_vertexArray = 0;
+    }
+    if (m_program != 0) {
+        gl.glDeleteProgram(m_program);
+        m_program = 0;
+    }
+    m_initialized = false;
+    m_persistent = false;
+}
+
+Renderer::Stats Renderer::GetStats() const {
+    Stats stats = m_lastFrameStats;
+    stats.truncated = m_frameStats.truncated;
+    stats.stalls = m_frameStats.stalls;
+    stats.persistentMapped = m_persistent;
+    stats.gpu = m_initialized;
+    return stats;
 }
 
-} // namespace AlgorithmVisualizer 
\ No newline at end of file
+} // namespace AlgorithmVisualizer
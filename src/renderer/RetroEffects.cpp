@@ -0,0 +1,168 @@
+#include "renderer/RetroEffects.h"
+#include "utils/Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+// GLFW defines APIENTRY and WINGDIAPI, which the Windows gl.h needs, before including it
+#include <GLFW/glfw3.h>
+#if defined(__APPLE__)
+#include <OpenGL/gl.h>
+#else
+#include <GL/gl.h>
+#endif
+
+namespace AlgorithmVisualizer {
+
+namespace {
+
+constexpr int SCANLINE_TILE = 63;      // Rows; lines every SCANLINE_SPACING, one brightness ripple per tile
+constexpr int SCANLINE_SPACING = 3;
+constexpr float SCANLINE_SPEED = 30.0f; // Pixels per second
+constexpr int DOT_TILE = 256;
+constexpr int DOTS_PER_TILE = 4;        // Each tile is drawn twice, offset by half a tile, as two twinkling layers
+constexpr float TWO_PI = 6.28318530718f;
+
+ImTextureID ToTextureId(unsigned int texture) {
+    return (ImTextureID)(intptr_t)texture;
+}
+
+ImU32 Cyan(float alpha) {
+    return IM_COL32(0, 255, 255, static_cast<int>(std::clamp(alpha, 0.0f, 1.0f) * 255.0f));
+}
+
+} // namespace
+
+void RetroEffects::DrawScanlines(ImDrawList* drawList, const ImVec2& pos, const ImVec2& size, float intensity, float time) {
+    PROFILE_SCOPE("RetroEffects::DrawScanlines");
+    if (m_quality == Quality::Off || size.x <= 0.0f || size.y <= 0.0f) {
+        return;
+    }
+    // Lines drift downwards by scrolling the tile
+    const float scroll = IsAnimated() ? std::fmod(time * SCANLINE_SPEED, static_cast<float>(SCANLINE_TILE)) : 0.0f;
+    const ImVec2 uv0(0.0f, -scroll / SCANLINE_TILE);
+    const ImVec2 uv1(size.x, (size.y - scroll) / SCANLINE_TILE);
+    drawList->AddImage(ToTextureId(GetScanlineTexture()), pos, ImVec2(pos.x + size.x, pos.y + size.y), uv0, uv1, Cyan(intensity));
+}
+
+void RetroEffects::DrawGrid(ImDrawList* drawList, const ImVec2& pos, const ImVec2& size, float spacing, float alpha, float time) {
+    PROFILE_SCOPE("RetroEffects::DrawGrid");
+    const int tile = static_cast<int>(std::lround(spacing));
+    if (m_quality == Quality::Off || tile < 2 || size.x <= 0.0f || size.y <= 0.0f) {
+        return;
+    }
+    const float pulse = IsAnimated() ? 0.3f + 0.2f * std::sin(time * 2.0f) : 0.3f;
+    const ImVec2 uv1(size.x / tile, size.y / tile);
+    drawList->AddImage(ToTextureId(GetGridTexture(tile)), pos, ImVec2(pos.x + size.x, pos.y + size.y), ImVec2(0.0f, 0.0f), uv1,
+                       Cyan(alpha * pulse));
+}
+
+void RetroEffects::DrawDots(ImDrawList* drawList, const ImVec2& pos, const ImVec2& size, int count, float time) {
+    PROFILE_SCOPE("RetroEffects::DrawDots");
+    if (m_quality == Quality::Off || count <= 0 || size.x <= 0.0f || size.y <= 0.0f) {
+        return;
+    }
+    // Stretch the tile so that two layers of it hold about count dots over the area
+    const float tileSide = std::sqrt(2.0f * DOTS_PER_TILE * size.x * size.y / count);
+    const ImVec2 uv1(size.x / tileSide, size.y / tileSide);
+    const ImVec2 max(pos.x + size.x, pos.y + size.y);
+    const float phase = IsAnimated() ? (std::sin(time * 2.0f) + 1.0f) * 0.5f : 0.5f;
+    const ImTextureID texture = ToTextureId(GetDotTexture());
+    drawList->AddImage(texture, pos, max, ImVec2(0.0f, 0.0f), uv1, Cyan(0.3f * phase));
+    drawList->AddImage(texture, pos, max, ImVec2(0.5f, 0.5f), ImVec2(uv1.x + 0.5f, uv1.y + 0.5f), Cyan(0.3f * (1.0f - phase)));
+}
+
+void RetroEffects::Shutdown() {
+    std::vector<GLuint> textures;
+    if (m_scanlineTexture) textures.push_back(m_scanlineTexture);
+    if (m_dotTexture) textures.push_back(m_dotTexture);
+    for (const auto& [spacing, texture] : m_gridTextures) {
+        textures.push_back(texture);
+    }
+    if (!textures.empty()) {
+        glDeleteTextures(static_cast<GLsizei>(textures.size()), textures.data());
+    }
+    m_scanlineTexture = 0;
+    m_dotTexture = 0;
+    m_gridTextures.clear();
+}
+
+const char* RetroEffects::QualityName(Quality quality) {
+    switch (quality) {
+        case Quality::Off: return "Off";
+        case Quality::Low: return "Low";
+        case Quality::High: return "High";
+    }
+    return "Unknown";
+}
+
+unsigned int RetroEffects::GetScanlineTexture() {
+    if (!m_scanlineTexture) {
+        // One pixel wide; every third row lit, brightness rippling once over the tile
+        std::vector<unsigned char> alpha(SCANLINE_TILE, 0);
+        for (int y = 0; y < SCANLINE_TILE; y += SCANLINE_SPACING) {
+            const float level = 0.5f + 0.3f * std::sin(TWO_PI * y / SCANLINE_TILE);
+            alpha[y] = static_cast<unsigned char>(level * 255.0f);
+        }
+        m_scanlineTexture = CreateTexture(1, SCANLINE_TILE, alpha, false);
+    }
+    return m_scanlineTexture;
+}
+
+unsigned int RetroEffects::GetGridTexture(int spacing) {
+    auto it = std::find_if(m_gridTextures.begin(), m_gridTextures.end(),
+                           [spacing](const auto& entry) { return entry.first == spacing; });
+    if (it != m_gridTextures.end()) {
+        return it->second;
+    }
+    // One cell: its top row and left column are the grid lines
+    std::vector<unsigned char> alpha(static_cast<size_t>(spacing) * spacing, 0);
+    for (int i = 0; i < spacing; ++i) {
+        alpha[i] = 255;
+        alpha[static_cast<size_t>(i) * spacing] = 255;
+    }
+    const unsigned int texture = CreateTexture(spacing, spacing, alpha, false);
+    m_gridTextures.emplace_back(spacing, texture);
+    return texture;
+}
+
+unsigned int RetroEffects::GetDotTexture() {
+    if (!m_dotTexture) {
+        std::vector<unsigned char> alpha(static_cast<size_t>(DOT_TILE) * DOT_TILE, 0);
+        for (int i = 0; i < DOTS_PER_TILE; ++i) {
+            // Same spread as a multiplicative hash, kept away from the tile edge
+            const int cx = 8 + (i * 97 + 31) * 61 % (DOT_TILE - 16);
+            const int cy = 8 + (i * 71 + 17) * 43 % (DOT_TILE - 16);
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    const bool centre = dx == 0 && dy == 0;
+                    alpha[static_cast<size_t>(cy + dy) * DOT_TILE + (cx + dx)] = centre ? 255 : 96;
+                }
+            }
+        }
+        m_dotTexture = CreateTexture(DOT_TILE, DOT_TILE, alpha, true);
+    }
+    return m_dotTexture;
+}
+
+unsigned int RetroEffects::CreateTexture(int width, int height, const std::vector<unsigned char>& alpha, bool smooth) {
+    std::vector<uint32_t> pixels(alpha.size());
+    std::transform(alpha.begin(), alpha.end(), pixels.begin(),
+                   [](unsigned char a) { return IM_COL32(255, 255, 255, a); });
+
+    GLint previous = 0;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, smooth ? GL_LINEAR : GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, smooth ? GL_LINEAR : GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(previous));
+    return texture;
+}
+
+} // namespace AlgorithmVisualizer
@@ -0,0 +1,257 @@
+#include "utils/Profiler.h"
+#include "audio/SpscQueue.h"
+#include <fmt/format.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+namespace AlgorithmVisualizer {
+
+namespace {
+
+struct ThreadBuffer {
+    SpscQueue<Profiler::Zone, Profiler::ZONES_PER_THREAD> zones;
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<bool> retired{false}; // Owner thread exited; the buffer may be handed to a new thread once drained
+    uint32_t index = 0;
+};
+
+struct Registry {
+    std::mutex mutex; // Guards buffers and names; taken once per thread, and once per frame by EndFrame
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::vector<std::string> names;
+    std::deque<Profiler::Frame> frames; // UI thread only
+    int64_t frameStartNs = 0;
+    uint64_t droppedTotal = 0;
+    
+    // Trace capture, UI thread only
+    TraceWriter trace;
+    std::vector<TraceWriter::Event> pendingSpans;
+    uint64_t frameNumber = 0;
+};
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+const auto g_epoch = std::chrono::steady_clock::now();
+std::atomic<bool> g_enabled{true};
+
+// Marks the thread's buffer as free when the thread exits
+struct ThreadSlot {
+    ThreadBuffer* buffer = nullptr;
+    uint32_t depth = 0;
+    ~ThreadSlot() {
+        if (buffer) {
+            buffer->retired.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local ThreadSlot t_slot;
+
+ThreadBuffer& AcquireThreadBuffer() {
+    if (t_slot.buffer) {
+        return *t_slot.buffer;
+    }
+
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    // Reuse the buffer of a thread that has exited, once everything it wrote has been drained
+    for (auto& buffer : registry.buffers) {
+        if (buffer->retired.load(std::memory_order_acquire) && buffer->zones.SizeApprox() == 0) {
+            buffer->retired.store(false, std::memory_order_relaxed);
+            registry.names[buffer->index] = "Thread " + std::to_string(buffer->index);
+            t_slot.buffer = buffer.get();
+            return *t_slot.buffer;
+        }
+    }
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->index = static_cast<uint32_t>(registry.buffers.size());
+    registry.names.push_back("Thread " + std::to_string(buffer->index));
+    t_slot.buffer = buffer.get();
+    registry.buffers.push_back(std::move(buffer));
+    return *t_slot.buffer;
+}
+
+} // namespace
+
+void Profiler::SetEnabled(bool enabled) {
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Profiler::IsEnabled() {
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+void Profiler::SetThreadName(const char* name) {
+    ThreadBuffer& buffer = AcquireThreadBuffer();
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.names[buffer.index] = name;
+}
+
+int64_t Profiler::NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - g_epoch).count();
+}
+
+void Profiler::Record(const char* name, int64_t startNs, int64_t endNs, uint32_t depth) {
+    ThreadBuffer& buffer = AcquireThreadBuffer();
+    if (!buffer.zones.TryPush(Zone{name, startNs, endNs, depth, buffer.index})) {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void Profiler::EndFrame() {
+    Registry& registry = GetRegistry();
+    const int64_t now = NowNs();
+    
+    // Paused: keep the history as it is, and discard zones that were still open when recording stopped
+    if (!IsEnabled()) {
+        registry.frameStartNs = now;
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        Zone zone;
+        for (auto& buffer : registry.buffers) {
+            while (buffer->zones.TryPop(zone)) {
+            }
+        }
+        return;
+    }
+
+    // Recycle the oldest frame's storage rather than allocating a new one
+    Frame frame;
+    if (registry.frames.size() >= HISTORY_FRAMES) {
+        frame = std::move(registry.frames.front());
+        registry.frames.pop_front();
+        frame.zones.clear();
+    }
+    frame.startNs = registry.frameStartNs;
+    frame.endNs = now;
+    registry.frameStartNs = now;
+
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        uint64_t dropped = 0;
+        for (auto& buffer : registry.buffers) {
+            Zone zone;
+            while (buffer->zones.TryPop(zone)) {
+                frame.zones.push_back(zone);
+            }
+            dropped += buffer->dropped.load(std::memory_order_relaxed);
+        }
+        registry.droppedTotal = dropped;
+    }
+    
+    if (registry.trace.IsOpen()) {
+        std::vector<TraceWriter::Event> batch = std::move(registry.pendingSpans);
+        registry.pendingSpans.clear();
+        batch.reserve(batch.size() + frame.zones.size() + 1);
+        for (const Zone& zone : frame.zones) {
+            TraceWriter::Event event;
+            event.name = zone.name;
+            event.startNs = zone.startNs;
+            event.durationNs = zone.endNs - zone.startNs;
+            event.thread = zone.thread;
+            batch.push_back(std::move(event));
+        }
+        TraceWriter::Event frameEvent;
+        frameEvent.name = "Frame";
+        frameEvent.category = "frame";
+        frameEvent.startNs = frame.startNs;
+        frameEvent.durationNs = frame.endNs - frame.startNs;
+        frameEvent.thread = FRAME_TRACK;
+        frameEvent.args = fmt::format("\"frame\": {}, \"zones\": {}", registry.frameNumber, frame.zones.size());
+        batch.push_back(std::move(frameEvent));
+        registry.trace.Submit(std::move(batch));
+    }
+    registry.frameNumber++;
+    registry.frames.push_back(std::move(frame));
+}
+
+bool Profiler::StartTrace(const std::string& path) {
+    Registry& registry = GetRegistry();
+    if (!registry.trace.Open(path)) {
+        return false;
+    }
+    registry.pendingSpans.clear();
+    SetEnabled(true);
+    return true;
+}
+
+void Profiler::StopTrace() {
+    Registry& registry = GetRegistry();
+    if (!registry.trace.IsOpen()) {
+        return;
+    }
+    // Spans reported since the last frame would otherwise be lost
+    registry.trace.Submit(std::move(registry.pendingSpans));
+    registry.pendingSpans.clear();
+    
+    std::vector<std::pair<uint32_t, std::string>> tracks;
+    const std::vector<std::string> names = ThreadNames();
+    for (size_t i = 0; i < names.size(); ++i) {
+        tracks.emplace_back(static_cast<uint32_t>(i), names[i]);
+    }
+    tracks.emplace_back(FRAME_TRACK, "Frames");
+    tracks.emplace_back(SPAN_TRACK, "Algorithm runs");
+    registry.trace.Close(tracks);
+}
+
+bool Profiler::IsTracing() {
+    return GetRegistry().trace.IsOpen();
+}
+
+TraceWriter::Stats Profiler::GetTraceStats() {
+    return GetRegistry().trace.GetStats();
+}
+
+const std::string& Profiler::GetTracePath() {
+    return GetRegistry().trace.GetPath();
+}
+
+void Profiler::TraceSpan(std::string label, const char* category, int64_t startNs, int64_t endNs, std::string args) {
+    Registry& registry = GetRegistry();
+    if (!registry.trace.IsOpen()) {
+        return;
+    }
+    TraceWriter::Event event;
+    event.label = std::move(label);
+    event.category = category;
+    event.startNs = startNs;
+    event.durationNs = endNs - startNs;
+    event.thread = SPAN_TRACK;
+    event.args = std::move(args);
+    registry.pendingSpans.push_back(std::move(event));
+}
+
+const std::deque<Profiler::Frame>& Profiler::Frames() {
+    return GetRegistry().frames;
+}
+
+std::vector<std::string> Profiler::ThreadNames() {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.names;
+}
+
+uint64_t Profiler::DroppedZones() {
+    return GetRegistry().droppedTotal;
+}
+
+ProfileZone::ProfileZone(const char* name) : m_name(name), m_active(Profiler::IsEnabled()) {
+    if (m_active) {
+        m_depth = t_slot.depth++;
+        m_startNs = Profiler::NowNs();
+    }
+}
+
+ProfileZone::~ProfileZone() {
+    if (m_active) {
+        Profiler::Record(m_name, m_startNs, Profiler::NowNs(), m_depth);
+        t_slot.depth--;
+    }
+}
+
+} // namespace AlgorithmVisualizer
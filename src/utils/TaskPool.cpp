@@ -0,0 +1,56 @@
+#include "utils/TaskPool.h"
+#include "utils/Profiler.h"
+#include <algorithm>
+
+namespace AlgorithmVisualizer {
+
+TaskPool::TaskPool(size_t threadCount) {
+    threadCount = std::max<size_t>(threadCount, 1);
+    m_threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        m_threads.emplace_back(&TaskPool::WorkerLoop, this);
+    }
+}
+
+TaskPool::~TaskPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+size_t TaskPool::DefaultThreadCount() {
+    const size_t hardware = std::thread::hardware_concurrency();
+    return std::clamp<size_t>(hardware > 1 ? hardware - 1 : 1, 1, 4);
+}
+
+void TaskPool::Enqueue(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(std::move(task));
+    }
+    m_wake.notify_one();
+}
+
+void TaskPool::WorkerLoop() {
+    Profiler::SetThreadName("Task pool");
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+            if (m_queue.empty()) {
+                return; // Stopping, and nothing left to run
+            }
+            task = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+        task();
+    }
+}
+
+} // namespace AlgorithmVisualizer
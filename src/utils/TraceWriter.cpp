@@ -0,0 +1,154 @@
+#include "utils/TraceWriter.h"
+#include "utils/Profiler.h"
+#include <fmt/format.h>
+#include <iterator>
+
+namespace AlgorithmVisualizer {
+
+namespace {
+
+void AppendEscaped(std::string& out, const char* text) {
+    for (; *text; ++text) {
+        const char c = *text;
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            fmt::format_to(std::back_inserter(out), "\\u{:04x}", static_cast<unsigned>(c));
+        } else {
+            out += c;
+        }
+    }
+}
+
+} // namespace
+
+TraceWriter::~TraceWriter() {
+    if (IsOpen()) {
+        Close({});
+    }
+}
+
+bool TraceWriter::Open(const std::string& path) {
+    if (IsOpen()) {
+        return false;
+    }
+    m_file = std::fopen(path.c_str(), "wb");
+    if (!m_file) {
+        fmt::print("Failed to open trace file {}\n", path);
+        return false;
+    }
+    m_path = path;
+    m_firstEvent = true;
+    m_batches.clear();
+    m_queuedEvents = 0;
+    m_written = 0;
+    m_dropped = 0;
+    m_stopping = false;
+    std::fputs("{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n", m_file);
+    m_writer = std::thread(&TraceWriter::WriterLoop, this);
+    return true;
+}
+
+void TraceWriter::Close(const std::vector<std::pair<uint32_t, std::string>>& trackNames) {
+    if (!IsOpen()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_one();
+    m_writer.join();
+
+    // Metadata goes last: names are known by now, and viewers accept it anywhere
+    std::string text;
+    for (const auto& [track, name] : trackNames) {
+        text += m_firstEvent ? "" : ",\n";
+        m_firstEvent = false;
+        fmt::format_to(std::back_inserter(text), R"({{"name": "thread_name", "ph": "M", "pid": 1, "tid": {}, "args": {{"name": ")", track);
+        AppendEscaped(text, name.c_str());
+        text += "\"}}";
+    }
+    text += "\n]}\n";
+    std::fwrite(text.data(), 1, text.size(), m_file);
+    std::fclose(m_file);
+    m_file = nullptr;
+    fmt::print("Trace written to {} ({} events, {} dropped)\n", m_path, m_written, m_dropped);
+}
+
+void TraceWriter::Submit(std::vector<Event>&& batch) {
+    if (batch.empty()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_queuedEvents + batch.size() > MAX_QUEUED_EVENTS) {
+            m_dropped += batch.size();
+            return;
+        }
+        m_queuedEvents += batch.size();
+        m_batches.push_back(std::move(batch));
+    }
+    m_wake.notify_one();
+}
+
+TraceWriter::Stats TraceWriter::GetStats() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return Stats{m_written, m_dropped, m_queuedEvents};
+}
+
+void TraceWriter::WriterLoop() {
+    Profiler::SetThreadName("Trace writer");
+    std::vector<std::vector<Event>> batches;
+    std::string text;
+    for (;;) {
+        bool stopping = false;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this] { return m_stopping || !m_batches.empty(); });
+            batches.swap(m_batches);
+            stopping = m_stopping;
+        }
+
+        size_t count = 0;
+        for (const std::vector<Event>& batch : batches) {
+            text.clear();
+            WriteBatch(batch, text);
+            std::fwrite(text.data(), 1, text.size(), m_file);
+            count += batch.size();
+        }
+        batches.clear();
+        std::fflush(m_file);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queuedEvents -= count;
+            m_written += count;
+        }
+        if (stopping) {
+            return; // Everything queued before Close has been written
+        }
+    }
+}
+
+void TraceWriter::WriteBatch(const std::vector<Event>& batch, std::string& text) {
+    auto out = std::back_inserter(text);
+    for (const Event& event : batch) {
+        text += m_firstEvent ? "" : ",\n";
+        m_firstEvent = false;
+        // Complete event; timestamps are microseconds
+        text += R"({"name": ")";
+        AppendEscaped(text, event.label.empty() ? event.name : event.label.c_str());
+        fmt::format_to(out, R"(", "cat": "{}", "ph": "X", "pid": 1, "tid": {}, "ts": {:.3f}, "dur": {:.3f})",
+                       event.category, event.thread, event.startNs * 1e-3, event.durationNs * 1e-3);
+        if (!event.args.empty()) {
+            text += ", \"args\": {";
+            text += event.args;
+            text += '}';
+        }
+        text += '}';
+    }
+}
+
+} // namespace AlgorithmVisualizer